@@ -0,0 +1,125 @@
+/**
+ *  @file ThreadPool.h
+ *  A small work-stealing thread pool used to evaluate independent tasks in
+ *  parallel (see \ref Cantera::ThreadPool).
+ */
+
+#ifndef CT_THREADPOOL_H
+#define CT_THREADPOOL_H
+
+#include "ct_defs.h"
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+
+namespace Cantera
+{
+
+//! A pool of worker threads for evaluating a set of independent tasks.
+/*!
+ * Each call to run() evaluates the tasks `0, ..., nTasks-1`. The tasks are
+ * initially split into contiguous blocks, one block per worker. Each worker
+ * takes tasks from the front of its own block, and once its block is
+ * exhausted, steals tasks from the back of the block belonging to the worker
+ * with the most remaining work. This keeps all threads busy when the cost of
+ * the individual tasks is very uneven (e.g. reactor integrations with
+ * different ignition delays) while keeping locality for tasks of similar
+ * cost.
+ *
+ * The task function is called with the task index and the index of the worker
+ * evaluating it. The worker index is in the range `0, ..., nThreads()-1` and
+ * can be used to select per-thread work objects, e.g. copies of a ThermoPhase
+ * and Kinetics object made with duplMyselfAsThermoPhase() and
+ * duplMyselfAsKinetics(). A given worker never evaluates two tasks
+ * concurrently. The thread calling run() acts as worker 0, so a pool created
+ * with a single thread evaluates all tasks serially on the calling thread.
+ *
+ * If any task throws an exception, the remaining tasks are still evaluated and
+ * the exception thrown by the task with the lowest index is rethrown by run(),
+ * so that the error reported does not depend on the thread scheduling.
+ *
+ * @code
+ * ThreadPool pool(4);
+ * vector_fp result(n);
+ * pool.run(n, [&](size_t i, size_t worker) {
+ *     result[i] = expensiveFunction(i, workspace[worker]);
+ * });
+ * @endcode
+ *
+ * @ingroup globalUtilFuncs
+ */
+class ThreadPool
+{
+public:
+    //! Create a pool with `nThreads` workers (including the calling thread).
+    //! If `nThreads` is zero, the number of hardware threads is used.
+    explicit ThreadPool(size_t nThreads=0);
+
+    //! Stops and joins the worker threads.
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    //! Number of workers, including the thread calling run()
+    size_t nThreads() const {
+        return m_queues.size();
+    }
+
+    //! Evaluate `task(i, worker)` for each `i` in `0, ..., nTasks-1`, and
+    //! return once all of the tasks have been completed. Calls to run() on
+    //! the same pool from different threads are serialized.
+    void run(size_t nTasks, const std::function<void(size_t, size_t)>& task);
+
+    //! The number of hardware threads, or 1 if this cannot be determined.
+    static size_t hardwareThreads();
+
+protected:
+    //! The range of task indices `[begin, end)` not yet claimed by any worker
+    struct TaskQueue {
+        std::mutex lock;
+        size_t begin;
+        size_t end;
+    };
+
+    //! Main loop for the background threads
+    void workerLoop(size_t worker);
+
+    //! Evaluate tasks until none are left in any of the queues
+    void work(size_t worker);
+
+    //! Claim a task from the front of the worker's own queue, or steal one
+    //! from the back of the longest other queue. Returns `npos` if no tasks
+    //! remain.
+    size_t nextTask(size_t worker);
+
+    std::vector<std::thread> m_threads;
+    std::vector<std::unique_ptr<TaskQueue>> m_queues;
+
+    //! The task function for the current call to run()
+    const std::function<void(size_t, size_t)>* m_task;
+
+    //! Incremented for each call to run() to wake up the workers
+    size_t m_generation;
+
+    //! Number of background workers that have not finished the current run
+    size_t m_active;
+
+    //! Set by the destructor to stop the background threads
+    bool m_stop;
+
+    //! Index of the lowest-numbered task that threw an exception
+    size_t m_errorTask;
+    std::exception_ptr m_error;
+
+    std::mutex m_mutex;
+    std::mutex m_run_mutex;
+    std::condition_variable m_start;
+    std::condition_variable m_done;
+};
+
+}
+
+#endif
@@ -705,6 +705,43 @@ std::string ct2ctml_string(const std::string& file);
  */
 std::string ct_string2ctml_string(const std::string& cti);
 
+//! Convert cti input to CTML by calling the `ctml_writer` module of the
+//! Cantera Python package in a separate Python process.
+/*!
+ * @param   text    Path to the input file, or a string containing the cti
+ *                  representation
+ * @param   isfile  `true` if *text* is the path to the input file
+ * @return  String containing the XML representation of the input
+ *
+ * @ingroup inputfiles
+ */
+std::string call_ctml_writer(const std::string& text, bool isfile);
+
+//! Convert cti input to CTML in-process, without calling Python.
+/*!
+ * The generated tree is the same as the tree created by `ctml_writer`, but
+ * only the subset of the cti format that consists of plain Python
+ * expressions is supported. Input which uses other Python statements
+ * (function definitions, loops, imports, etc.) or entry types that are not
+ * implemented is left to the Python converter. These are the phase types
+ * `ideal_gas`, `ideal_interface`, `stoichiometric_solid` and
+ * `stoichiometric_liquid`, and all of the gas-phase reaction types plus
+ * `surface_reaction`.
+ *
+ * @param   text    Path to the input file, or a string containing the cti
+ *                  representation
+ * @param   root    The CTML tree is added to this (empty) node, which is
+ *                  renamed to `ctml`
+ * @param   isfile  `true` if *text* is the path to the input file
+ * @return  `true` if the input was converted, or `false` if the input
+ *          requires the Python converter. In that case, *root* is not
+ *          modified.
+ *
+ * @ingroup inputfiles
+ */
+bool ct2ctml_native(const std::string& text, XML_Node& root,
+                    bool isfile=false);
+
 //! Convert a Chemkin-format mechanism into a CTI file.
 /*!
  * @param in_file         input file containing species and reactions
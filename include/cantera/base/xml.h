@@ -20,26 +20,35 @@ namespace Cantera
 {
 //!  Class XML_Reader reads an XML file into an XML_Node object.
 /*!
- *   Class XML_Reader is designed for internal use.
+ *   Class XML_Reader is designed for internal use. The remaining contents of
+ *   the input stream are read into a buffer when the reader is constructed,
+ *   and tags and values are then extracted directly from the buffer.
  */
 class XML_Reader
 {
 public:
     //! Sole Constructor for the XML_Reader class
     /*!
+     *  Reads the input stream to its end.
+     *
      *  @param input   Reference to the istream object containing the XML file
      */
     XML_Reader(std::istream& input);
 
-    //! Read a single character from the input stream and returns it
+    //! Read a single character from the input buffer and returns it
     /*!
-     * All low level reads occur through this function. The function also keeps
-     * track of the line numbers.
+     * The function also keeps track of the line numbers. If the end of the
+     * buffer has been reached, `ch` is left unchanged and eof() becomes true.
      *
      * @param ch   Character to be returned.
      */
     void getchr(char& ch);
 
+    //! True if an attempt has been made to read past the end of the input
+    bool eof() const {
+        return m_eof;
+    }
+
     //!  Searches a string for the first occurrence of a valid quoted string.
     /*!
      * Quotes can start with either a single quote or a double quote, but must
@@ -79,8 +88,24 @@ public:
     std::string readValue();
 
 protected:
-    //! Input stream containing the XML file
-    std::istream& m_s;
+    //! Read the remainder of a tag one character at a time, starting after
+    //! the opening '<'. Used for tags that readTag() does not handle directly,
+    //! such as those containing nested comment delimiters.
+    std::string readTagByChar(std::map<std::string, std::string>& attribs);
+
+    //! Fast version of parseTag() for tags whose attribute values are all
+    //! enclosed in double quotes. Falls back to parseTag() otherwise.
+    void parseTagFast(const std::string& tag, std::string& name,
+                      std::map<std::string, std::string>& attribs) const;
+
+    //! Contents of the input stream
+    std::string m_buf;
+
+    //! Position of the next character to be read from #m_buf
+    size_t m_pos;
+
+    //! True if an attempt has been made to read past the end of #m_buf
+    bool m_eof;
 
 public:
     //! Line count
@@ -0,0 +1,118 @@
+/**
+ *  @file BinaryMechanism.h
+ *   Reading and writing of gas phase mechanisms in a compiled binary format,
+ *   which can be loaded without parsing an XML input file.
+ */
+
+#ifndef CT_BINARYMECHANISM_H
+#define CT_BINARYMECHANISM_H
+
+#include "cantera/base/ct_defs.h"
+
+#include <cstdint>
+
+namespace Cantera
+{
+
+class ThermoPhase;
+class Kinetics;
+class Transport;
+
+//! Write an ideal gas phase and, optionally, its kinetics and transport
+//! managers to a binary mechanism file.
+/*!
+ * The file contains the elements and species of the phase (including the
+ * species thermodynamic and transport parameters), the reactions of the
+ * kinetics manager, and the polynomial fits computed by the transport
+ * manager, so that all of them can be restored by BinaryMechanism without
+ * reading the original input file or refitting the transport properties.
+ *
+ * The format is a sequence of native-endian records. It is intended as a
+ * cache of a mechanism for repeated loading on the same architecture, not
+ * as a portable input format. Files with a different byte order or format
+ * version are rejected when they are opened.
+ *
+ * @param filename  Name of the file to be written
+ * @param thermo    An IdealGasPhase object
+ * @param kin       A GasKinetics object for `thermo`, or 0
+ * @param tran      A mixture-averaged or multicomponent transport manager
+ *     for `thermo`, or 0
+ * @ingroup kineticsmgr
+ */
+void writeBinaryMechanism(const std::string& filename, ThermoPhase& thermo,
+                          Kinetics* kin=0, Transport* tran=0);
+
+//! A binary mechanism file created by writeBinaryMechanism().
+/*!
+ * The file is memory-mapped read-only, so that processes on the same host
+ * loading the same file share a single copy of its contents in the page
+ * cache, and the objects are initialized directly from the mapped records.
+ * Example:
+ *
+ *     BinaryMechanism mech("gri30.ctb");
+ *     IdealGasPhase gas;
+ *     GasKinetics kin;
+ *     mech.importPhase(gas);
+ *     mech.importKinetics(gas, kin);
+ *     std::unique_ptr<Transport> tran(mech.newTransport(gas));
+ *
+ * @ingroup kineticsmgr
+ */
+class BinaryMechanism
+{
+public:
+    //! Open and map the file `filename`, and check its header
+    explicit BinaryMechanism(const std::string& filename);
+    ~BinaryMechanism();
+    BinaryMechanism(const BinaryMechanism&) = delete;
+    BinaryMechanism& operator=(const BinaryMechanism&) = delete;
+
+    //! Add the elements and species to the empty IdealGasPhase object
+    //! `thermo`, and set its initial state.
+    void importPhase(ThermoPhase& thermo) const;
+
+    //! Add the phase `thermo` and the reactions to the empty GasKinetics
+    //! object `kin`. `thermo` must have been initialized using importPhase().
+    void importKinetics(ThermoPhase& thermo, Kinetics& kin) const;
+
+    //! Create a transport manager for the phase `thermo` using the stored
+    //! polynomial fits. `thermo` must have been initialized using
+    //! importPhase(). The caller is responsible for deleting the returned
+    //! object.
+    Transport* newTransport(ThermoPhase& thermo, int log_level=0) const;
+
+    //! True if the file contains reactions
+    bool hasKinetics() const {
+        return m_offsets[1] != 0;
+    }
+
+    //! True if the file contains transport property fits
+    bool hasTransport() const {
+        return m_offsets[2] != 0;
+    }
+
+protected:
+    //! Name of the mapped file
+    std::string m_filename;
+
+    //! Start of the file contents
+    const char* m_data;
+
+    //! Size of the file [bytes]
+    size_t m_size;
+
+    //! True if #m_data is a memory mapping of the file; otherwise, the file
+    //! has been read into #m_buffer.
+    bool m_mapped;
+
+    //! Contents of the file, if it could not be mapped
+    std::string m_buffer;
+
+    //! Offsets of the phase, kinetics and transport sections in the file,
+    //! or zero if a section is absent
+    uint64_t m_offsets[3];
+};
+
+}
+
+#endif
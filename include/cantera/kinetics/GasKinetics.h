@@ -47,6 +47,99 @@ public:
     virtual void getEquilibriumConstants(doublereal* kc);
     virtual void getFwdRateConstants(doublereal* kfwd);
 
+    //! Species net production rates for a batch of states.
+    /*!
+     * The rate constants, third-body concentrations, equilibrium constants
+     * and rates of progress are evaluated for all of the states together,
+     * with the innermost loops running over the states so that they can be
+     * vectorized. The thermodynamic properties and the falloff functions,
+     * P-log and Chebyshev rates are evaluated one state at a time.
+     */
+    virtual void getBatchNetProductionRates(size_t nStates, const double* T,
+                                            const double* P, const double* Y,
+                                            double* wdot);
+
+    //! @}
+    //! @name Derivatives of Species Production Rates
+    //! @{
+
+    //! Derivatives of the species net production rates with respect to the
+    //! species concentrations, at constant temperature.
+    /*!
+     * The derivatives of the concentration products and of the enhanced
+     * third-body concentrations are evaluated analytically, using the
+     * sparsity structure of the stoichiometry managers. The derivatives of
+     * the falloff functions with respect to the reduced pressure and of the
+     * P-log and Chebyshev rate constants with respect to pressure are
+     * evaluated by finite differences of those functions only. The pressure
+     * is assumed to vary with the total concentration according to the ideal
+     * gas law.
+     */
+    virtual void getNetProductionRates_ddC(SparseMatrix& dwdot);
+
+    //! Derivatives of the species net production rates with respect to
+    //! temperature, at constant species concentrations.
+    /*!
+     * Evaluated using a forward difference in temperature, which requires
+     * one additional evaluation of the rate constants.
+     */
+    virtual void getNetProductionRates_ddT(doublereal* dwdot);
+
+    //! @}
+    //! @name Dynamic Mechanism Reduction
+    //! @{
+
+    //! Enable or disable the evaluation of a reduced set of reactions.
+    /*!
+     * The set of active reactions is determined from the rates of progress
+     * at the current state using the directed relation graph (DRG) method.
+     * The interaction coefficient of species A with species B is
+     * \f[
+     *     r_{AB} = \frac{\sum_i |\nu_{A,i} \omega_i \delta_{B,i}|}
+     *                   {\sum_i |\nu_{A,i} \omega_i|}
+     * \f]
+     * where \f$ \omega_i \f$ is the net rate of progress of reaction *i* and
+     * \f$ \delta_{B,i} \f$ is 1 if species B participates in reaction *i* and
+     * 0 otherwise. The species which can be reached from the target species
+     * through interaction coefficients greater than or equal to `tol` are
+     * kept, and the reactions which involve only kept species are active.
+     *
+     * The rate constants of the elementary and three-body reactions and the
+     * equilibrium constants are evaluated only for the active reactions, and
+     * the rates of progress of the inactive reactions are set to zero. The
+     * active set is updated from an evaluation of the full mechanism after
+     * every `interval` evaluations of the rates of progress.
+     * getFwdRateConstants() still reports the rate constants of all
+     * reactions, while the reverse rate constants of inactive reactions are
+     * zero.
+     *
+     * Each update of the active set can switch reactions on or off, so the
+     * production rates are discontinuous functions of the state and time.
+     * An ODE integrator using these rates may need to reduce its step size
+     * or reject steps after an update. Its Jacobian may also no longer match
+     * the right-hand side.
+     *
+     * @param tol  Threshold for the interaction coefficients. A value less
+     *     than or equal to zero disables the reduction.
+     * @param targets  Names of the target species
+     * @param interval  Number of evaluations of the rates of progress
+     *     between updates of the active set
+     */
+    void setDynamicReduction(double tol,
+                             const std::vector<std::string>& targets,
+                             size_t interval=20);
+
+    //! Update the set of active reactions from the rates of progress of the
+    //! full mechanism at the current state.
+    void updateActiveReactions();
+
+    //! Number of reactions in the active set. Equal to nReactions() if the
+    //! dynamic reduction is disabled.
+    size_t nActiveReactions() const;
+
+    //! True if reaction `i` is in the active set
+    bool isActiveReaction(size_t i) const;
+
     //! @}
     //! @name Reaction Mechanism Setup Routines
     //! @{
@@ -120,6 +213,110 @@ protected:
     //! Update the equilibrium constants in molar units.
     void updateKc();
 
+    //! Set up the sparsity patterns used by getNetProductionRates_ddC()
+    void setupDerivatives();
+
+    //! Allocate the work arrays used by updateActiveReactions()
+    void setupReduction();
+
+    //! @name Derivative data
+    //!@{
+
+    //! Derivatives of the net rates of progress with respect to the species
+    //! concentrations. Size nReactions() by m_kk.
+    SparseMatrix m_ropnet_ddC;
+
+    //! Derivatives of the net production rates with respect to the species
+    //! concentrations. Size m_kk by m_kk.
+    SparseMatrix m_wdot_ddC;
+
+    //! Work arrays of length nReactions() used to compute derivatives
+    vector_fp m_kf_work, m_kr_work, m_q_work;
+
+    //! Work arrays of length equal to the number of falloff reactions used to
+    //! compute derivatives of the falloff functions
+    vector_fp m_pr_work, m_falloff_work0, m_falloff_work1;
+    //!@}
+
+    //! Work array used by updateKc() for the reciprocal equilibrium constants
+    //! of the reversible reactions
+    vector_fp m_kc_work;
+
+    //! @name Batch evaluation data
+    //! Work arrays used by getBatchNetProductionRates(). Per-species and
+    //! per-reaction quantities are stored with the values for all states
+    //! contiguous, i.e. the value for species or reaction `i` in state `m` is
+    //! at index `i*nStates + m`.
+    //!@{
+
+    //! Log of the temperature, reciprocal temperature, total concentration
+    //! and log of the standard concentration for each state
+    vector_fp m_batch_logT, m_batch_recipT, m_batch_ctot, m_batch_logStandConc;
+
+    //! Species concentrations and nondimensional standard chemical
+    //! potentials. The latter array is also used for the production rates.
+    vector_fp m_batch_conc, m_batch_grt;
+
+    //! Forward and reverse rates of progress and reciprocal equilibrium
+    //! constants
+    vector_fp m_batch_ropf, m_batch_ropr, m_batch_rkcn;
+
+    //! Enhanced third-body concentrations for three-body and falloff
+    //! reactions
+    vector_fp m_batch_concm_3b, m_batch_concm_falloff;
+
+    //! Low- and high-pressure limit rate constants for falloff reactions
+    vector_fp m_batch_rfn_low, m_batch_rfn_high;
+
+    //! Per-state work arrays for the falloff functions and P-log and
+    //! Chebyshev rates
+    vector_fp m_batch_pr, m_batch_falloff_work, m_batch_kf;
+
+    //! Indices of P-log and Chebyshev reactions
+    std::vector<size_t> m_batch_pdep;
+    //!@}
+
+    //! @name Dynamic reduction data
+    //!@{
+
+    //! Threshold for the DRG interaction coefficients. Zero if the dynamic
+    //! reduction is disabled.
+    double m_drg_tol;
+
+    //! Number of evaluations of the rates of progress between updates of
+    //! the active set
+    size_t m_drg_interval;
+
+    //! Number of evaluations of the rates of progress since the last update
+    //! of the active set
+    size_t m_drg_count;
+
+    //! True if only the rates of the active reactions are being evaluated
+    bool m_drg_reduced;
+
+    //! Kinetics species indices of the target species
+    std::vector<size_t> m_drg_targets;
+
+    //! Flags for the kept species and the active reactions
+    std::vector<char> m_drg_keep, m_drg_active;
+
+    //! Indices of the inactive reactions
+    std::vector<size_t> m_drg_inactive;
+
+    //! Indices of the active reversible reactions
+    std::vector<size_t> m_drg_rev;
+
+    //! Rate expressions for the active elementary and three-body reactions
+    Rate1<Arrhenius> m_drg_rates;
+
+    //! Work arrays of length m_kk holding the denominators and numerators of
+    //! the interaction coefficients
+    vector_fp m_drg_denom, m_drg_rab;
+
+    //! Stack of species to visit in the graph search
+    std::vector<size_t> m_drg_stack;
+    //!@}
+
     bool m_finalized;
 };
 }
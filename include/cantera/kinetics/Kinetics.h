@@ -14,6 +14,7 @@
 #include "StoichManager.h"
 #include "cantera/thermo/mix_defs.h"
 #include "cantera/kinetics/Reaction.h"
+#include "cantera/numerics/SparseMatrix.h"
 #include "cantera/base/global.h"
 
 namespace Cantera
@@ -569,6 +570,50 @@ public:
      */
     virtual void getNetProductionRates(doublereal* wdot);
 
+    /**
+     * Species net production rates [kmol/m^3/s or kmol/m^2/s] for a batch of
+     * states of the phase where the reactions occur. This is equivalent to
+     * calling ThermoPhase::setState_TPY() and getNetProductionRates() for
+     * each state, but derived classes may evaluate the rates for all of the
+     * states together. On return, the phase is left in the last state of the
+     * batch.
+     *
+     * @param nStates  Number of states *M*
+     * @param T     Temperature of each state [K]. Length: *M*.
+     * @param P     Pressure of each state [Pa]. Length: *M*.
+     * @param Y     Mass fractions of the species in the reacting phase, with
+     *     the mass fractions for state *m* starting at `Y[m*nSpecies]`.
+     * @param wdot  Output array of net production rates, with the rates for
+     *     state *m* starting at `wdot[m*m_kk]`. Length: *M* * m_kk.
+     */
+    virtual void getBatchNetProductionRates(size_t nStates, const double* T,
+                                            const double* P, const double* Y,
+                                            double* wdot);
+
+    /**
+     * Derivatives of the species net production rates with respect to the
+     * species concentrations, at constant temperature. On return, entry
+     * `(k,j)` of `dwdot` contains \f$ \partial \dot\omega_k / \partial C_j
+     * \f$ [1/s or kmol/m^2/s per kmol/m^3]. The matrix is resized and its
+     * sparsity pattern is set as needed.
+     *
+     * @param dwdot  Output sparse matrix of derivatives. Size m_kk by m_kk.
+     */
+    virtual void getNetProductionRates_ddC(SparseMatrix& dwdot) {
+        throw NotImplementedError("Kinetics::getNetProductionRates_ddC");
+    }
+
+    /**
+     * Derivatives of the species net production rates with respect to
+     * temperature, at constant species concentrations [kmol/m^3/s/K or
+     * kmol/m^2/s/K].
+     *
+     * @param dwdot  Output vector of derivatives. Length: m_kk.
+     */
+    virtual void getNetProductionRates_ddT(doublereal* dwdot) {
+        throw NotImplementedError("Kinetics::getNetProductionRates_ddT");
+    }
+
     //! @}
     //! @name Reaction Mechanism Informational Query Routines
     //! @{
@@ -881,6 +926,25 @@ protected:
 
     //! Stoichiometry manager for the products of irreversible reactions
     StoichManagerN m_irrevProductStoich;
+
+    //! Update #m_netStoich, #m_netStoichT and the species-major views of the
+    //! stoichiometry managers after reactions have been added
+    void updateStoich();
+
+    //! Net stoichiometric coefficients. Size m_kk by nReactions(), so that
+    //! the species of each reaction are stored together. The pattern includes
+    //! every species which appears in a reaction, even if its net coefficient
+    //! is zero.
+    SparseMatrix m_netStoich;
+
+    //! Transpose of #m_netStoich, of size nReactions() by m_kk, so that the
+    //! reactions of each species are stored together. Used by
+    //! getNetProductionRates().
+    SparseMatrix m_netStoichT;
+
+    //! `true` if the stoichiometric data computed by updateStoich() are up
+    //! to date
+    bool m_stoich_ok;
     //@}
 
     //! The number of species in all of the phases
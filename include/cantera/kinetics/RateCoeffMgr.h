@@ -8,6 +8,7 @@
 #define CT_RATECOEFF_MGR_H
 
 #include "RxnRates.h"
+#include "cantera/base/utilities.h"
 
 namespace Cantera
 {
@@ -118,6 +119,226 @@ protected:
     std::map<size_t, size_t> m_indices;
 };
 
+//! Rate coefficient manager specialized for the modified Arrhenius form.
+/*!
+ * The parameters of all installed reactions are stored in contiguous arrays
+ * (structure-of-arrays layout) rather than as a vector of Arrhenius objects,
+ * so that the exponent and exponential evaluations in update() are simple
+ * loops over contiguous data. The exponent loop can be vectorized by the
+ * compiler; the calls to std::exp are only vectorized if the compiler is
+ * allowed to substitute a vector math library (e.g. with `-ffast-math`),
+ * which is not the case with the default build flags. Reactions are sorted
+ * into separate groups depending on which terms of the rate expression are
+ * needed:
+ *
+ * - constant rates, where both b and Ea are zero, for which the value of A
+ *   is copied directly;
+ * - rates where Ea is zero, for which only $ A T^b $ is evaluated;
+ * - rates where b is zero, for which only $ A \exp(-E_a/RT) $ is
+ *   evaluated;
+ * - rates where all three parameters are needed.
+ *
+ * The results are identical to those of calling Arrhenius::updateRC for each
+ * reaction.
+ */
+template<>
+class Rate1<Arrhenius>
+{
+public:
+    Rate1() {}
+    virtual ~Rate1() {}
+
+    /**
+     * Install a rate coefficient calculator.
+     * @param rxnNumber the reaction number
+     * @param rate rate coefficient specification for the reaction
+     */
+    void install(size_t rxnNumber, const Arrhenius& rate) {
+        m_rxn.push_back(rxnNumber);
+        m_rates.push_back(rate);
+        m_indices[rxnNumber] = m_rxn.size() - 1;
+        addToGroup(rxnNumber, rate);
+    }
+
+    //! Replace an existing rate coefficient calculator
+    void replace(size_t rxnNumber, const Arrhenius& rate) {
+        size_t i = m_indices[rxnNumber];
+        m_rates[i] = rate;
+
+        // The new parameters may belong to a different group, so the grouped
+        // arrays are rebuilt from scratch.
+        m_const_rxn.clear();
+        m_const_A.clear();
+        m_Tb_rxn.clear();
+        m_Tb_A.clear();
+        m_Tb_b.clear();
+        m_Ea_rxn.clear();
+        m_Ea_A.clear();
+        m_Ea_E.clear();
+        m_gen_rxn.clear();
+        m_gen_A.clear();
+        m_gen_b.clear();
+        m_gen_E.clear();
+        for (size_t j = 0; j < m_rates.size(); j++) {
+            addToGroup(m_rxn[j], m_rates[j]);
+        }
+    }
+
+    //! Arrhenius rates have no concentration-dependent parts, so this method
+    //! does nothing.
+    void update_C(const doublereal* c) {}
+
+    /**
+     * Write the rate coefficients into array values. Each calculator writes one
+     * entry in values, at the location specified by the reaction number when it
+     * was installed.
+     */
+    void update(doublereal T, doublereal logT, doublereal* values) {
+        doublereal recipT = 1.0/T;
+        doublereal* work = m_work.data();
+
+        size_t n = m_gen_rxn.size();
+        for (size_t i = 0; i < n; i++) {
+            work[i] = m_gen_b[i]*logT - m_gen_E[i]*recipT;
+        }
+        for (size_t i = 0; i < n; i++) {
+            work[i] = m_gen_A[i] * std::exp(work[i]);
+        }
+        scatter_copy(work, work + n, values, m_gen_rxn.begin());
+
+        n = m_Tb_rxn.size();
+        for (size_t i = 0; i < n; i++) {
+            work[i] = m_Tb_A[i] * std::exp(m_Tb_b[i]*logT);
+        }
+        scatter_copy(work, work + n, values, m_Tb_rxn.begin());
+
+        n = m_Ea_rxn.size();
+        for (size_t i = 0; i < n; i++) {
+            work[i] = m_Ea_A[i] * std::exp(-m_Ea_E[i]*recipT);
+        }
+        scatter_copy(work, work + n, values, m_Ea_rxn.begin());
+
+        scatter_copy(m_const_A.begin(), m_const_A.end(), values,
+                     m_const_rxn.begin());
+    }
+
+    /**
+     * Write the rate coefficients for a batch of `nStates` states into array
+     * values. The rate coefficient for the reaction with index `i` in state
+     * `m` is written to `values[i*nStates + m]`.
+     *
+     * @param nStates  Number of states
+     * @param logT  Natural logarithm of the temperature of each state
+     * @param recipT  Reciprocal of the temperature of each state
+     * @param values  Output array
+     */
+    void update(size_t nStates, const doublereal* logT,
+                const doublereal* recipT, doublereal* values) {
+        for (size_t i = 0; i < m_gen_rxn.size(); i++) {
+            double A = m_gen_A[i];
+            double b = m_gen_b[i];
+            double E = m_gen_E[i];
+            double* v = values + m_gen_rxn[i] * nStates;
+            for (size_t m = 0; m < nStates; m++) {
+                v[m] = A * std::exp(b*logT[m] - E*recipT[m]);
+            }
+        }
+        for (size_t i = 0; i < m_Tb_rxn.size(); i++) {
+            double A = m_Tb_A[i];
+            double b = m_Tb_b[i];
+            double* v = values + m_Tb_rxn[i] * nStates;
+            for (size_t m = 0; m < nStates; m++) {
+                v[m] = A * std::exp(b*logT[m]);
+            }
+        }
+        for (size_t i = 0; i < m_Ea_rxn.size(); i++) {
+            double A = m_Ea_A[i];
+            double E = m_Ea_E[i];
+            double* v = values + m_Ea_rxn[i] * nStates;
+            for (size_t m = 0; m < nStates; m++) {
+                v[m] = A * std::exp(-E*recipT[m]);
+            }
+        }
+        for (size_t i = 0; i < m_const_rxn.size(); i++) {
+            double* v = values + m_const_rxn[i] * nStates;
+            std::fill(v, v + nStates, m_const_A[i]);
+        }
+    }
+
+    size_t nReactions() const {
+        return m_rates.size();
+    }
+
+    //! Return effective preexponent for the specified reaction.
+    double effectivePreExponentialFactor(size_t irxn) {
+        return m_rates[irxn].preExponentialFactor();
+    }
+
+    //! Return effective activation energy for the specified reaction.
+    double effectiveActivationEnergy_R(size_t irxn) {
+        return m_rates[irxn].activationEnergy_R();
+    }
+
+    //! Return effective temperature exponent for the specified  reaction.
+    double effectiveTemperatureExponent(size_t irxn) {
+        return m_rates[irxn].temperatureExponent();
+    }
+
+protected:
+    //! Add the parameters of a rate expression to the group of rates which
+    //! require the same terms to be evaluated.
+    void addToGroup(size_t rxnNumber, const Arrhenius& rate) {
+        double A = rate.preExponentialFactor();
+        double b = rate.temperatureExponent();
+        double E = rate.activationEnergy_R();
+        if (b == 0.0 && E == 0.0) {
+            m_const_rxn.push_back(rxnNumber);
+            m_const_A.push_back(A);
+        } else if (E == 0.0) {
+            m_Tb_rxn.push_back(rxnNumber);
+            m_Tb_A.push_back(A);
+            m_Tb_b.push_back(b);
+        } else if (b == 0.0) {
+            m_Ea_rxn.push_back(rxnNumber);
+            m_Ea_A.push_back(A);
+            m_Ea_E.push_back(E);
+        } else {
+            m_gen_rxn.push_back(rxnNumber);
+            m_gen_A.push_back(A);
+            m_gen_b.push_back(b);
+            m_gen_E.push_back(E);
+        }
+        m_work.resize(m_rates.size());
+    }
+
+    std::vector<Arrhenius> m_rates;
+    std::vector<size_t> m_rxn;
+
+    //! map reaction number to index in m_rxn / m_rates
+    std::map<size_t, size_t> m_indices;
+
+    //! @name Grouped rate parameters
+    //! For each group, the reaction numbers (`*_rxn`), pre-exponential factors
+    //! (`*_A`), temperature exponents (`*_b`) and activation temperatures
+    //! (`*_E`) that are needed to evaluate the rates in that group.
+    //! @{
+    std::vector<size_t> m_const_rxn; //!< Rates with b = 0 and Ea = 0
+    vector_fp m_const_A;
+
+    std::vector<size_t> m_Tb_rxn; //!< Rates with Ea = 0
+    vector_fp m_Tb_A, m_Tb_b;
+
+    std::vector<size_t> m_Ea_rxn; //!< Rates with b = 0
+    vector_fp m_Ea_A, m_Ea_E;
+
+    std::vector<size_t> m_gen_rxn; //!< Rates with nonzero b and Ea
+    vector_fp m_gen_A, m_gen_b, m_gen_E;
+    //! @}
+
+    //! Work array used to hold intermediate values during update()
+    vector_fp m_work;
+};
+
 }
 
 #endif
@@ -9,6 +9,7 @@
 
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/ctexceptions.h"
+#include "cantera/numerics/SparseMatrix.h"
 
 namespace Cantera
 {
@@ -168,6 +169,50 @@ public:
         R[m_rxn] -= S[m_ic0];
     }
 
+    void incrementSpecies(const doublereal* R, doublereal* S,
+                          size_t nStates) const {
+        const doublereal* r = R + m_rxn*nStates;
+        doublereal* s0 = S + m_ic0*nStates;
+        for (size_t m = 0; m < nStates; m++) {
+            s0[m] += r[m];
+        }
+    }
+
+    void decrementSpecies(const doublereal* R, doublereal* S,
+                          size_t nStates) const {
+        const doublereal* r = R + m_rxn*nStates;
+        doublereal* s0 = S + m_ic0*nStates;
+        for (size_t m = 0; m < nStates; m++) {
+            s0[m] -= r[m];
+        }
+    }
+
+    void multiply(const doublereal* S, doublereal* R, size_t nStates) const {
+        doublereal* r = R + m_rxn*nStates;
+        const doublereal* s0 = S + m_ic0*nStates;
+        for (size_t m = 0; m < nStates; m++) {
+            r[m] *= s0[m];
+        }
+    }
+
+    void incrementReaction(const doublereal* S, doublereal* R,
+                           size_t nStates) const {
+        doublereal* r = R + m_rxn*nStates;
+        const doublereal* s0 = S + m_ic0*nStates;
+        for (size_t m = 0; m < nStates; m++) {
+            r[m] += s0[m];
+        }
+    }
+
+    void decrementReaction(const doublereal* S, doublereal* R,
+                           size_t nStates) const {
+        doublereal* r = R + m_rxn*nStates;
+        const doublereal* s0 = S + m_ic0*nStates;
+        for (size_t m = 0; m < nStates; m++) {
+            r[m] -= s0[m];
+        }
+    }
+
     size_t rxnNumber() const {
         return m_rxn;
     }
@@ -178,6 +223,15 @@ public:
         return 1;
     }
 
+    void derivatives(const doublereal* S, const doublereal* R,
+                     SparseMatrix& jac) const {
+        jac(m_rxn, m_ic0) += R[m_rxn];
+    }
+
+    void derivativePattern(std::vector<std::pair<size_t, size_t> >& p) const {
+        p.emplace_back(m_rxn, m_ic0);
+    }
+
 private:
     //! Reaction number
     size_t m_rxn;
@@ -229,6 +283,61 @@ public:
         R[m_rxn] -= (S[m_ic0] + S[m_ic1]);
     }
 
+    void incrementSpecies(const doublereal* R, doublereal* S,
+                          size_t nStates) const {
+        const doublereal* r = R + m_rxn*nStates;
+        doublereal* s0 = S + m_ic0*nStates;
+        doublereal* s1 = S + m_ic1*nStates;
+        for (size_t m = 0; m < nStates; m++) {
+            s0[m] += r[m];
+            s1[m] += r[m];
+        }
+    }
+
+    void decrementSpecies(const doublereal* R, doublereal* S,
+                          size_t nStates) const {
+        const doublereal* r = R + m_rxn*nStates;
+        doublereal* s0 = S + m_ic0*nStates;
+        doublereal* s1 = S + m_ic1*nStates;
+        for (size_t m = 0; m < nStates; m++) {
+            s0[m] -= r[m];
+            s1[m] -= r[m];
+        }
+    }
+
+    void multiply(const doublereal* S, doublereal* R, size_t nStates) const {
+        doublereal* r = R + m_rxn*nStates;
+        const doublereal* s0 = S + m_ic0*nStates;
+        const doublereal* s1 = S + m_ic1*nStates;
+        for (size_t m = 0; m < nStates; m++) {
+            if (s0[m] < 0 && s1[m] < 0) {
+                r[m] = 0;
+            } else {
+                r[m] *= s0[m] * s1[m];
+            }
+        }
+    }
+
+    void incrementReaction(const doublereal* S, doublereal* R,
+                           size_t nStates) const {
+        doublereal* r = R + m_rxn*nStates;
+        const doublereal* s0 = S + m_ic0*nStates;
+        const doublereal* s1 = S + m_ic1*nStates;
+        for (size_t m = 0; m < nStates; m++) {
+            r[m] += s0[m] + s1[m];
+        }
+    }
+
+    void decrementReaction(const doublereal* S, doublereal* R,
+                           size_t nStates) const {
+        doublereal* r = R + m_rxn*nStates;
+        const doublereal* s0 = S + m_ic0*nStates;
+        const doublereal* s1 = S + m_ic1*nStates;
+        for (size_t m = 0; m < nStates; m++) {
+            r[m] -= (s0[m] + s1[m]);
+        }
+    }
+
     size_t rxnNumber() const {
         return m_rxn;
     }
@@ -239,6 +348,17 @@ public:
         return 2;
     }
 
+    void derivatives(const doublereal* S, const doublereal* R,
+                     SparseMatrix& jac) const {
+        jac(m_rxn, m_ic0) += R[m_rxn] * S[m_ic1];
+        jac(m_rxn, m_ic1) += R[m_rxn] * S[m_ic0];
+    }
+
+    void derivativePattern(std::vector<std::pair<size_t, size_t> >& p) const {
+        p.emplace_back(m_rxn, m_ic0);
+        p.emplace_back(m_rxn, m_ic1);
+    }
+
 private:
     //! Reaction index -> index into the ROP vector
     size_t m_rxn;
@@ -295,6 +415,69 @@ public:
         R[m_rxn] -= (S[m_ic0] + S[m_ic1] + S[m_ic2]);
     }
 
+    void incrementSpecies(const doublereal* R, doublereal* S,
+                          size_t nStates) const {
+        const doublereal* r = R + m_rxn*nStates;
+        doublereal* s0 = S + m_ic0*nStates;
+        doublereal* s1 = S + m_ic1*nStates;
+        doublereal* s2 = S + m_ic2*nStates;
+        for (size_t m = 0; m < nStates; m++) {
+            s0[m] += r[m];
+            s1[m] += r[m];
+            s2[m] += r[m];
+        }
+    }
+
+    void decrementSpecies(const doublereal* R, doublereal* S,
+                          size_t nStates) const {
+        const doublereal* r = R + m_rxn*nStates;
+        doublereal* s0 = S + m_ic0*nStates;
+        doublereal* s1 = S + m_ic1*nStates;
+        doublereal* s2 = S + m_ic2*nStates;
+        for (size_t m = 0; m < nStates; m++) {
+            s0[m] -= r[m];
+            s1[m] -= r[m];
+            s2[m] -= r[m];
+        }
+    }
+
+    void multiply(const doublereal* S, doublereal* R, size_t nStates) const {
+        doublereal* r = R + m_rxn*nStates;
+        const doublereal* s0 = S + m_ic0*nStates;
+        const doublereal* s1 = S + m_ic1*nStates;
+        const doublereal* s2 = S + m_ic2*nStates;
+        for (size_t m = 0; m < nStates; m++) {
+            if ((s0[m] < 0 && (s1[m] < 0 || s2[m] < 0)) ||
+                (s1[m] < 0 && s2[m] < 0)) {
+                r[m] = 0;
+            } else {
+                r[m] *= s0[m] * s1[m] * s2[m];
+            }
+        }
+    }
+
+    void incrementReaction(const doublereal* S, doublereal* R,
+                           size_t nStates) const {
+        doublereal* r = R + m_rxn*nStates;
+        const doublereal* s0 = S + m_ic0*nStates;
+        const doublereal* s1 = S + m_ic1*nStates;
+        const doublereal* s2 = S + m_ic2*nStates;
+        for (size_t m = 0; m < nStates; m++) {
+            r[m] += s0[m] + s1[m] + s2[m];
+        }
+    }
+
+    void decrementReaction(const doublereal* S, doublereal* R,
+                           size_t nStates) const {
+        doublereal* r = R + m_rxn*nStates;
+        const doublereal* s0 = S + m_ic0*nStates;
+        const doublereal* s1 = S + m_ic1*nStates;
+        const doublereal* s2 = S + m_ic2*nStates;
+        for (size_t m = 0; m < nStates; m++) {
+            r[m] -= (s0[m] + s1[m] + s2[m]);
+        }
+    }
+
     size_t rxnNumber() const {
         return m_rxn;
     }
@@ -305,6 +488,19 @@ public:
         return 3;
     }
 
+    void derivatives(const doublereal* S, const doublereal* R,
+                     SparseMatrix& jac) const {
+        jac(m_rxn, m_ic0) += R[m_rxn] * S[m_ic1] * S[m_ic2];
+        jac(m_rxn, m_ic1) += R[m_rxn] * S[m_ic0] * S[m_ic2];
+        jac(m_rxn, m_ic2) += R[m_rxn] * S[m_ic0] * S[m_ic1];
+    }
+
+    void derivativePattern(std::vector<std::pair<size_t, size_t> >& p) const {
+        p.emplace_back(m_rxn, m_ic0);
+        p.emplace_back(m_rxn, m_ic1);
+        p.emplace_back(m_rxn, m_ic2);
+    }
+
 private:
     size_t m_rxn;
     size_t m_ic0;
@@ -405,6 +601,99 @@ public:
         }
     }
 
+    void multiply(const doublereal* input, doublereal* output,
+                  size_t nStates) const {
+        doublereal* r = output + m_rxn*nStates;
+        for (size_t m = 0; m < nStates; m++) {
+            int neg_count = 0;
+            for (size_t n = 0; n < m_n; n++) {
+                doublereal oo = m_order[n];
+                if (oo != 0.0) {
+                    doublereal c = input[m_ic[n]*nStates + m];
+                    if (c < 0) {
+                        neg_count++;
+                    }
+                    r[m] *= ppow(c, oo);
+                }
+            }
+            if (neg_count > 1) {
+                r[m] = 0;
+            }
+        }
+    }
+
+    void incrementSpecies(const doublereal* input, doublereal* output,
+                          size_t nStates) const {
+        const doublereal* r = input + m_rxn*nStates;
+        for (size_t n = 0; n < m_n; n++) {
+            doublereal* s = output + m_ic[n]*nStates;
+            for (size_t m = 0; m < nStates; m++) {
+                s[m] += m_stoich[n]*r[m];
+            }
+        }
+    }
+
+    void decrementSpecies(const doublereal* input, doublereal* output,
+                          size_t nStates) const {
+        const doublereal* r = input + m_rxn*nStates;
+        for (size_t n = 0; n < m_n; n++) {
+            doublereal* s = output + m_ic[n]*nStates;
+            for (size_t m = 0; m < nStates; m++) {
+                s[m] -= m_stoich[n]*r[m];
+            }
+        }
+    }
+
+    void incrementReaction(const doublereal* input, doublereal* output,
+                           size_t nStates) const {
+        doublereal* r = output + m_rxn*nStates;
+        for (size_t n = 0; n < m_n; n++) {
+            const doublereal* s = input + m_ic[n]*nStates;
+            for (size_t m = 0; m < nStates; m++) {
+                r[m] += m_stoich[n]*s[m];
+            }
+        }
+    }
+
+    void decrementReaction(const doublereal* input, doublereal* output,
+                           size_t nStates) const {
+        doublereal* r = output + m_rxn*nStates;
+        for (size_t n = 0; n < m_n; n++) {
+            const doublereal* s = input + m_ic[n]*nStates;
+            for (size_t m = 0; m < nStates; m++) {
+                r[m] -= m_stoich[n]*s[m];
+            }
+        }
+    }
+
+    void derivatives(const doublereal* input, const doublereal* rates,
+                     SparseMatrix& jac) const {
+        for (size_t n = 0; n < m_n; n++) {
+            if (m_order[n] == 0.0) {
+                continue;
+            }
+            // d(c_n^o_n)/dc_n = o_n * c_n^(o_n-1)
+            double d = rates[m_rxn] * m_order[n];
+            if (m_order[n] != 1.0) {
+                d *= ppow(input[m_ic[n]], m_order[n] - 1.0);
+            }
+            for (size_t m = 0; m < m_n; m++) {
+                if (m != n && m_order[m] != 0.0) {
+                    d *= ppow(input[m_ic[m]], m_order[m]);
+                }
+            }
+            jac(m_rxn, m_ic[n]) += d;
+        }
+    }
+
+    void derivativePattern(std::vector<std::pair<size_t, size_t> >& p) const {
+        for (size_t n = 0; n < m_n; n++) {
+            if (m_order[n] != 0.0) {
+                p.emplace_back(m_rxn, m_ic[n]);
+            }
+        }
+    }
+
 private:
     //! Length of the m_ic vector
     /*!
@@ -526,6 +815,16 @@ inline static void _decrementReactions(InputIter begin,
  * S_k = R_{i1} + \dots + R_{iM}
  * \f]
  * where M is the number of molecules, and $\f i(m) \f$ is the
+ *
+ * In addition to the lists of C1, C2, C3 and C_AnyN objects, N is stored in
+ * compressed sparse form, both by reaction and by species. By default,
+ * incrementSpecies() and decrementSpecies() use the species-major view, so
+ * that each species rate is accumulated in a single loop which gathers the
+ * rates of the reactions in which it participates, instead of being updated
+ * from scattered locations. The operations which run over reactions use the
+ * lists, which have fixed, unrolled loops for the common cases of one to
+ * three species.
+ *
  * See @ref Stoichiometry
  * @ingroup Stoichiometry
  */
@@ -545,7 +844,11 @@ public:
      * DGG - the problem is that the number of reactions and species are not
      * known initially.
      */
-    StoichManagerN() {
+    StoichManagerN() :
+        m_compressed(true),
+        m_ready(true),
+        m_rxn_start(1, 0),
+        m_sp_start(1, 0) {
     }
 
     /**
@@ -625,6 +928,57 @@ public:
                 m_cn_list.emplace_back(rxn, k, order, stoich);
             }
         }
+
+        // Reaction-major view of the nonzero coefficients
+        m_rxn_index.push_back(rxn);
+        for (size_t n = 0; n < k.size(); n++) {
+            if (stoich[n] != 0.0) {
+                m_rxn_species.push_back(k[n]);
+                m_rxn_stoich.push_back(stoich[n]);
+            }
+        }
+        m_rxn_start.push_back(m_rxn_species.size());
+        m_ready = false;
+    }
+
+    //! Select whether the species-major compressed representation (the
+    //! default) or the lists of C1, C2, C3 and C_AnyN objects are used by
+    //! incrementSpecies() and decrementSpecies() for single states. The
+    //! results differ only by round-off error.
+    void setCompressed(bool compressed) {
+        m_compressed = compressed;
+    }
+
+    //! Build the species-major view of the stoichiometric coefficients used
+    //! by incrementSpecies() and decrementSpecies(). Until this is called
+    //! after adding reactions, those methods use the lists of C1, C2, C3
+    //! and C_AnyN objects.
+    void finalize() {
+        if (m_ready) {
+            return;
+        }
+        size_t nsp = 0;
+        for (size_t k : m_rxn_species) {
+            nsp = std::max(nsp, k + 1);
+        }
+        m_sp_start.assign(nsp + 1, 0);
+        for (size_t k : m_rxn_species) {
+            m_sp_start[k+1]++;
+        }
+        for (size_t k = 0; k < nsp; k++) {
+            m_sp_start[k+1] += m_sp_start[k];
+        }
+        m_sp_rxn.resize(m_rxn_species.size());
+        m_sp_stoich.resize(m_rxn_species.size());
+        std::vector<size_t> next(m_sp_start.begin(), m_sp_start.end() - 1);
+        for (size_t j = 0; j < m_rxn_index.size(); j++) {
+            for (size_t n = m_rxn_start[j]; n < m_rxn_start[j+1]; n++) {
+                size_t pos = next[m_rxn_species[n]]++;
+                m_sp_rxn[pos] = m_rxn_index[j];
+                m_sp_stoich[pos] = m_rxn_stoich[n];
+            }
+        }
+        m_ready = true;
     }
 
     void multiply(const doublereal* input, doublereal* output) const {
@@ -635,6 +989,10 @@ public:
     }
 
     void incrementSpecies(const doublereal* input, doublereal* output) const {
+        if (m_compressed && m_ready) {
+            speciesProduct(input, output, 1.0);
+            return;
+        }
         _incrementSpecies(m_c1_list.begin(), m_c1_list.end(), input, output);
         _incrementSpecies(m_c2_list.begin(), m_c2_list.end(), input, output);
         _incrementSpecies(m_c3_list.begin(), m_c3_list.end(), input, output);
@@ -642,6 +1000,10 @@ public:
     }
 
     void decrementSpecies(const doublereal* input, doublereal* output) const {
+        if (m_compressed && m_ready) {
+            speciesProduct(input, output, -1.0);
+            return;
+        }
         _decrementSpecies(m_c1_list.begin(), m_c1_list.end(), input, output);
         _decrementSpecies(m_c2_list.begin(), m_c2_list.end(), input, output);
         _decrementSpecies(m_c3_list.begin(), m_c3_list.end(), input, output);
@@ -662,11 +1024,205 @@ public:
         _decrementReactions(m_cn_list.begin(), m_cn_list.end(), input, output);
     }
 
+    //! @name Operations on batches of states
+    //!
+    //! These methods are equivalent to the methods of the same names above,
+    //! but operate on `nStates` independent states at once. The arrays are
+    //! stored by species or reaction, with the value for species (or
+    //! reaction) `k` in state `m` located at index `k*nStates + m`, so that
+    //! the innermost loops run over contiguous states.
+    //! @{
+
+    void multiply(const doublereal* input, doublereal* output,
+                  size_t nStates) const {
+        for (const auto& c : m_c1_list) {
+            c.multiply(input, output, nStates);
+        }
+        for (const auto& c : m_c2_list) {
+            c.multiply(input, output, nStates);
+        }
+        for (const auto& c : m_c3_list) {
+            c.multiply(input, output, nStates);
+        }
+        for (const auto& c : m_cn_list) {
+            c.multiply(input, output, nStates);
+        }
+    }
+
+    void incrementSpecies(const doublereal* input, doublereal* output,
+                          size_t nStates) const {
+        for (const auto& c : m_c1_list) {
+            c.incrementSpecies(input, output, nStates);
+        }
+        for (const auto& c : m_c2_list) {
+            c.incrementSpecies(input, output, nStates);
+        }
+        for (const auto& c : m_c3_list) {
+            c.incrementSpecies(input, output, nStates);
+        }
+        for (const auto& c : m_cn_list) {
+            c.incrementSpecies(input, output, nStates);
+        }
+    }
+
+    void decrementSpecies(const doublereal* input, doublereal* output,
+                          size_t nStates) const {
+        for (const auto& c : m_c1_list) {
+            c.decrementSpecies(input, output, nStates);
+        }
+        for (const auto& c : m_c2_list) {
+            c.decrementSpecies(input, output, nStates);
+        }
+        for (const auto& c : m_c3_list) {
+            c.decrementSpecies(input, output, nStates);
+        }
+        for (const auto& c : m_cn_list) {
+            c.decrementSpecies(input, output, nStates);
+        }
+    }
+
+    void incrementReactions(const doublereal* input, doublereal* output,
+                            size_t nStates) const {
+        for (const auto& c : m_c1_list) {
+            c.incrementReaction(input, output, nStates);
+        }
+        for (const auto& c : m_c2_list) {
+            c.incrementReaction(input, output, nStates);
+        }
+        for (const auto& c : m_c3_list) {
+            c.incrementReaction(input, output, nStates);
+        }
+        for (const auto& c : m_cn_list) {
+            c.incrementReaction(input, output, nStates);
+        }
+    }
+
+    void decrementReactions(const doublereal* input, doublereal* output,
+                            size_t nStates) const {
+        for (const auto& c : m_c1_list) {
+            c.decrementReaction(input, output, nStates);
+        }
+        for (const auto& c : m_c2_list) {
+            c.decrementReaction(input, output, nStates);
+        }
+        for (const auto& c : m_c3_list) {
+            c.decrementReaction(input, output, nStates);
+        }
+        for (const auto& c : m_cn_list) {
+            c.decrementReaction(input, output, nStates);
+        }
+    }
+    //! @}
+
+    /**
+     * Add the derivatives of the concentration products computed by
+     * multiply() with respect to the species concentrations to `jac`. For
+     * each reaction `i` and species `k`, `rates[i]` times the derivative of
+     * the product for reaction `i` with respect to `input[k]` is added to the
+     * entry `jac(i,k)`, which must be part of the sparsity pattern of `jac`
+     * (see getDerivativePattern()).
+     *
+     * The derivatives are those of the product of concentrations raised to
+     * the reaction orders, without the special handling of negative
+     * concentrations applied in multiply().
+     */
+    void derivatives(const doublereal* input, const doublereal* rates,
+                     SparseMatrix& jac) const {
+        for (const auto& c : m_c1_list) {
+            c.derivatives(input, rates, jac);
+        }
+        for (const auto& c : m_c2_list) {
+            c.derivatives(input, rates, jac);
+        }
+        for (const auto& c : m_c3_list) {
+            c.derivatives(input, rates, jac);
+        }
+        for (const auto& c : m_cn_list) {
+            c.derivatives(input, rates, jac);
+        }
+    }
+
+    //! Append the (reaction, species) index pairs for which the derivatives
+    //! computed by derivatives() may be nonzero to `pattern`.
+    void getDerivativePattern(std::vector<std::pair<size_t, size_t> >& pattern) const {
+        for (const auto& c : m_c1_list) {
+            c.derivativePattern(pattern);
+        }
+        for (const auto& c : m_c2_list) {
+            c.derivativePattern(pattern);
+        }
+        for (const auto& c : m_c3_list) {
+            c.derivativePattern(pattern);
+        }
+        for (const auto& c : m_cn_list) {
+            c.derivativePattern(pattern);
+        }
+    }
+
+    //! Add `sign` times the stoichiometric coefficients to `coeffs`, where
+    //! `coeffs[k][i]` is the coefficient of species `k` in reaction `i`
+    void addCoefficients(std::vector<std::map<size_t, double> >& coeffs,
+                         double sign) const {
+        for (size_t j = 0; j < m_rxn_index.size(); j++) {
+            for (size_t n = m_rxn_start[j]; n < m_rxn_start[j+1]; n++) {
+                coeffs[m_rxn_species[n]][m_rxn_index[j]] +=
+                    sign * m_rxn_stoich[n];
+            }
+        }
+    }
+
 private:
+    //! Add `sign` times the product of the stoichiometric coefficients and
+    //! the reaction rates `input` to the species rates `output`. Each species
+    //! rate is accumulated from the reactions in which it participates, so
+    //! there are no scattered updates.
+    void speciesProduct(const doublereal* input, doublereal* output,
+                        double sign) const {
+        size_t nsp = m_sp_start.size() - 1;
+        for (size_t k = 0; k < nsp; k++) {
+            // two partial sums, to shorten the chain of dependent additions
+            double sum0 = 0.0, sum1 = 0.0;
+            size_t n = m_sp_start[k];
+            size_t end = m_sp_start[k+1];
+            for (; n + 1 < end; n += 2) {
+                sum0 += m_sp_stoich[n] * input[m_sp_rxn[n]];
+                sum1 += m_sp_stoich[n+1] * input[m_sp_rxn[n+1]];
+            }
+            if (n < end) {
+                sum0 += m_sp_stoich[n] * input[m_sp_rxn[n]];
+            }
+            output[k] += sign * (sum0 + sum1);
+        }
+    }
+
     std::vector<C1> m_c1_list;
     std::vector<C2> m_c2_list;
     std::vector<C3> m_c3_list;
     std::vector<C_AnyN> m_cn_list;
+
+    //! @name Compressed sparse representation
+    //! @{
+
+    //! `true` if the species-major view is used by incrementSpecies() and
+    //! decrementSpecies()
+    bool m_compressed;
+
+    //! `true` if the species-major view is up to date. See finalize().
+    bool m_ready;
+
+    //! Reaction-major view: the nonzero stoichiometric coefficients of the
+    //! `j`th reaction added, with index `m_rxn_index[j]`, are
+    //! `m_rxn_stoich[n]` for species `m_rxn_species[n]`, where
+    //! `m_rxn_start[j] <= n < m_rxn_start[j+1]`.
+    std::vector<size_t> m_rxn_index, m_rxn_start, m_rxn_species;
+    vector_fp m_rxn_stoich;
+
+    //! Species-major view: the reactions in which species `k` participates
+    //! are `m_sp_rxn[n]` with coefficients `m_sp_stoich[n]`, where
+    //! `m_sp_start[k] <= n < m_sp_start[k+1]`.
+    std::vector<size_t> m_sp_start, m_sp_rxn;
+    vector_fp m_sp_stoich;
+    //! @}
 };
 
 }
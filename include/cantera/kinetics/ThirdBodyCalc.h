@@ -45,10 +45,60 @@ public:
                      output, m_reaction_index.begin());
     }
 
+    //! Compute the enhanced third-body concentrations for a batch of
+    //! `nStates` states. The concentration of species `k` in state `m` is
+    //! `conc[k*nStates + m]`, and the result for the `i`-th reaction handled
+    //! by this object is written to `work[i*nStates + m]`.
+    void update(size_t nStates, const double* conc, const double* ctot,
+                double* work) {
+        for (size_t i = 0; i < m_species.size(); i++) {
+            double* w = work + i*nStates;
+            for (size_t m = 0; m < nStates; m++) {
+                w[m] = m_default[i] * ctot[m];
+            }
+            for (size_t j = 0; j < m_species[i].size(); j++) {
+                double eff = m_eff[i][j];
+                const double* c = conc + m_species[i][j]*nStates;
+                for (size_t m = 0; m < nStates; m++) {
+                    w[m] += eff * c[m];
+                }
+            }
+        }
+    }
+
+    //! Multiply the rates for a batch of `nStates` states by the enhanced
+    //! third-body concentrations computed by update(). The rate of reaction
+    //! `i` in state `m` is `output[i*nStates + m]`.
+    void multiply(size_t nStates, double* output, const double* work) {
+        for (size_t i = 0; i < m_reaction_index.size(); i++) {
+            double* r = output + m_reaction_index[i]*nStates;
+            const double* w = work + i*nStates;
+            for (size_t m = 0; m < nStates; m++) {
+                r[m] *= w[m];
+            }
+        }
+    }
+
     size_t workSize() {
         return m_reaction_index.size();
     }
 
+    //! Index of the i-th reaction handled by this object, as specified when
+    //! the reaction was installed.
+    size_t reactionIndex(size_t i) const {
+        return m_reaction_index[i];
+    }
+
+    //! Get the third-body efficiency of each species for the i-th reaction
+    //! handled by this object, i.e. the derivative of the enhanced third-body
+    //! concentration with respect to the concentration of each species.
+    void getEfficiencies(size_t i, double* eff, size_t nSpecies) const {
+        std::fill(eff, eff + nSpecies, m_default[i]);
+        for (size_t j = 0; j < m_species[i].size(); j++) {
+            eff[m_species[i][j]] += m_eff[i][j];
+        }
+    }
+
 protected:
     //! Indices of third-body reactions within the full reaction array
     std::vector<size_t> m_reaction_index;
@@ -3,6 +3,9 @@
 
 #include "numerics/DenseMatrix.h"
 #include "numerics/BandMatrix.h"
+#include "numerics/BlockTridiagLU.h"
+#include "numerics/SparseMatrix.h"
+#include "numerics/SparseLU.h"
 #include "numerics/SquareMatrix.h"
 #include "numerics/NonlinearSolver.h"
 
@@ -0,0 +1,177 @@
+/**
+ *  @file BlockTridiagLU.h
+ *  Declarations for the class BlockTridiagLU, which stores block-tridiagonal
+ *  matrices and computes their LU factorizations (see \ref numerics and
+ *  \link Cantera::BlockTridiagLU BlockTridiagLU \endlink).
+ */
+
+#ifndef CT_BLOCKTRIDIAGLU_H
+#define CT_BLOCKTRIDIAGLU_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+//! A block-tridiagonal matrix and its LU factorization.
+/*!
+ * The matrix is partitioned into a sequence of square diagonal blocks
+ * \f$ D_j \f$ of size \f$ n_j \f$, which may differ from block to block. The
+ * only other nonzero blocks are the sub-diagonal blocks \f$ L_j \f$, coupling
+ * block \f$ j \f$ to block \f$ j-1 \f$, and the super-diagonal blocks
+ * \f$ U_j \f$, coupling block \f$ j \f$ to block \f$ j+1 \f$. This is the
+ * structure of the Jacobian of the 1D flame equations, where each block
+ * contains the components at one grid point. Only these blocks are stored,
+ * each one as a dense array in column-major order.
+ *
+ * The factorization uses the block Thomas algorithm:
+ * \f[
+ *     \hat{D}_0 = D_0, \quad
+ *     G_j = \hat{D}_j^{-1} U_j, \quad
+ *     \hat{D}_{j+1} = D_{j+1} - L_{j+1} G_j
+ * \f]
+ * where each \f$ \hat{D}_j \f$ is equilibrated by scaling its rows and
+ * columns, and factored using LU decomposition with partial pivoting (LAPACK
+ * DGETRF). The factors are stored separately, so the matrix itself is not
+ * modified. Since pivoting is only done within the diagonal blocks, the
+ * factorization fails for some nonsingular matrices which a banded LU
+ * decomposition would handle, and is inaccurate if a block
+ * \f$ \hat{D}_j \f$ is ill-conditioned. factor() therefore reports a
+ * failure if the estimated reciprocal condition number of any equilibrated
+ * block is smaller than a threshold (see setMinRcond). In return, the cost is
+ * proportional to \f$ \sum_j n_j^3 \f$, and no storage is needed for the
+ * zero entries within the band which are filled in by a banded LU
+ * decomposition.
+ *
+ * @ingroup numerics
+ */
+class BlockTridiagLU
+{
+public:
+    BlockTridiagLU();
+
+    //! Set the sizes of the diagonal blocks. Blocks with size zero are
+    //! allowed, and decouple the blocks on either side of them. All entries
+    //! of the matrix are set to zero.
+    void setBlockSizes(const std::vector<size_t>& sizes);
+
+    //! Set all entries of the matrix to zero
+    void zero();
+
+    //! Return a pointer to the block in block row `i` and block column `j`,
+    //! where `j` must be one of `i-1`, `i` or `i+1`. The block is stored in
+    //! column-major order, with leading dimension `blockSize(i)`.
+    double* block(size_t i, size_t j);
+    const double* block(size_t i, size_t j) const;
+
+    //! Return a changeable reference to element (i,j), where `i` and `j` are
+    //! the row and column of the whole matrix. For elements outside of the
+    //! block-tridiagonal structure, a reference to a zero is returned.
+    double& value(size_t i, size_t j);
+
+    //! Return the value of element (i,j), where `i` and `j` are the row and
+    //! column of the whole matrix.
+    double value(size_t i, size_t j) const;
+
+    //! Compute the LU factorization of the matrix.
+    /*!
+     * @returns 0 on success. If a diagonal block is singular, returns one
+     *     plus the index of the row where a zero pivot was found, following
+     *     the convention of BandMatrix::factor(). If a diagonal block is
+     *     ill-conditioned, returns one plus the index of its first row.
+     */
+    int factor();
+
+    //! Solve the system \f$ A x = b \f$ using the most recently computed
+    //! factorization.
+    /*!
+     * @param[in,out] b  On input, the right hand side vector. On return, the
+     *     solution vector.
+     */
+    void solve(double* b);
+
+    //! Set the smallest reciprocal condition number of an equilibrated
+    //! diagonal block \f$ \hat{D}_j \f$ (in the 1-norm, as estimated by
+    //! LAPACK DGECON) for which factor() succeeds. The default is 1.0e-10.
+    void setMinRcond(double rcond) {
+        m_minRcond = rcond;
+    }
+
+    //! Number of rows and columns in the matrix
+    size_t size() const {
+        return m_n;
+    }
+
+    //! Number of diagonal blocks
+    size_t nBlocks() const {
+        return m_size.size();
+    }
+
+    //! Number of rows and columns of diagonal block `j`
+    size_t blockSize(size_t j) const {
+        return m_size[j];
+    }
+
+    //! Index of the first row and column of diagonal block `j`
+    size_t blockStart(size_t j) const {
+        return m_loc[j];
+    }
+
+    //! Number of values stored for the matrix and its factorization
+    size_t nStored() const {
+        return m_diag.size() + m_lower.size() + m_upper.size() +
+               m_lu.size() + m_gain.size();
+    }
+
+protected:
+    //! Return the index of the block containing row or column `i`
+    size_t blockIndex(size_t i) const;
+
+    size_t m_n; //!< Number of rows and columns
+
+    //! Size of each diagonal block
+    std::vector<size_t> m_size;
+
+    //! Index of the first row and column of each diagonal block
+    std::vector<size_t> m_loc;
+
+    //! Diagonal blocks \f$ D_j \f$, starting at #m_diagStart
+    vector_fp m_diag;
+
+    //! Sub-diagonal blocks \f$ L_j \f$, starting at #m_lowerStart
+    vector_fp m_lower;
+
+    //! Super-diagonal blocks \f$ U_j \f$, starting at #m_upperStart
+    vector_fp m_upper;
+
+    //! LU factors of the modified diagonal blocks \f$ \hat{D}_j \f$,
+    //! starting at #m_diagStart
+    vector_fp m_lu;
+
+    //! Blocks \f$ G_j = \hat{D}_j^{-1} U_j \f$, starting at #m_upperStart
+    vector_fp m_gain;
+
+    std::vector<size_t> m_diagStart, m_lowerStart, m_upperStart;
+
+    //! Pivot indices for each diagonal block, starting at #m_loc
+    vector_int m_ipiv;
+
+    //! Scale factors \f$ R_j \f$ for the rows and \f$ C_j \f$ for the
+    //! columns of each block \f$ \hat{D}_j \f$, which is factored as
+    //! \f$ R_j \hat{D}_j C_j \f$, starting at #m_loc
+    vector_fp m_rowScale, m_colScale;
+
+    //! Work arrays for DGECON
+    vector_fp m_work;
+    vector_int m_iwork;
+
+    //! Smallest reciprocal condition number of a factored diagonal block
+    double m_minRcond;
+
+    //! Value returned for elements outside of the block-tridiagonal structure
+    double m_zero;
+};
+
+}
+
+#endif
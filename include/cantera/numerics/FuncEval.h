@@ -60,6 +60,49 @@ public:
     virtual size_t nparams() {
         return 0;
     }
+
+    //! Evaluate the Jacobian matrix of the right-hand-side function. Called
+    //! by integrators which use a direct linear solver with a user-supplied
+    //! Jacobian (problem type `DENSE + JAC`).
+    /*!
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq()
+     * @param[in] ydot right-hand-side function evaluated at (*t*, *y*),
+     *     length neq()
+     * @param[in] p sensitivity parameter vector, length nparams()
+     * @param[out] jac Jacobian matrix in column-major order. The derivative
+     *     of `ydot[i]` with respect to `y[j]` is stored in
+     *     `jac[i + neq()*j]`.
+     */
+    virtual void evalJacobian(double t, double* y, double* ydot, double* p,
+                              double* jac) {
+        throw NotImplementedError("FuncEval::evalJacobian");
+    }
+
+    //! Prepare the preconditioner for the Newton iteration matrix
+    //! \f$ I - \gamma J \f$. Called by integrators which use a preconditioned
+    //! iterative linear solver.
+    /*!
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq()
+     * @param[in] gamma scalar factor in the iteration matrix
+     * @param[in] reuseJacobian If `true`, the Jacobian from the previous call
+     *     may be reused, and only the factor *gamma* has changed.
+     */
+    virtual void preconditionerSetup(double t, double* y, double gamma,
+                                     bool reuseJacobian) {
+        throw NotImplementedError("FuncEval::preconditionerSetup");
+    }
+
+    //! Solve the preconditioner system \f$ P x = b \f$ using the
+    //! preconditioner prepared by the last call to preconditionerSetup().
+    /*!
+     * @param[in] rhs right hand side vector *b*, length neq()
+     * @param[out] x solution vector, length neq()
+     */
+    virtual void preconditionerSolve(const double* rhs, double* x) {
+        throw NotImplementedError("FuncEval::preconditionerSolve");
+    }
 };
 
 }
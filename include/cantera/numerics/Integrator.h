@@ -24,6 +24,11 @@ const int JAC = 8;
 const int GMRES = 16;
 const int BAND = 32;
 
+//! Used in combination with GMRES to specify that the FuncEval object
+//! provides a preconditioner through FuncEval::preconditionerSetup() and
+//! FuncEval::preconditionerSolve().
+const int PRECON = 64;
+
 /**
  * Specifies the method used to integrate the system of equations.
  * Not all methods are supported by all integrators.
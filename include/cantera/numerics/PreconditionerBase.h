@@ -0,0 +1,54 @@
+/**
+ *  @file PreconditionerBase.h
+ *  Declarations for the class PreconditionerBase, which is the abstract base
+ *  class for preconditioners used by iterative linear solvers (see \ref
+ *  numerics and \link Cantera::PreconditionerBase PreconditionerBase
+ *  \endlink).
+ */
+
+#ifndef CT_PRECONDITIONERBASE_H
+#define CT_PRECONDITIONERBASE_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+class SparseMatrix;
+
+//! Abstract base class for preconditioners of the Newton iteration matrix
+//! used by implicit ODE integrators.
+/*!
+ * A preconditioner approximates the inverse of the matrix \f$ P = I - \gamma
+ * J \f$, where \f$ J \f$ is (an approximation to) the Jacobian of the ODE
+ * right hand side and \f$ \gamma \f$ is a scalar which depends on the current
+ * step size and integration method. Derived classes may be provided by the
+ * user, e.g. through ReactorNet::setPreconditioner().
+ *
+ * @ingroup numerics
+ */
+class PreconditionerBase
+{
+public:
+    PreconditionerBase() {}
+    virtual ~PreconditionerBase() {}
+
+    //! Prepare the preconditioner for subsequent calls to solve().
+    /*!
+     * @param jac    Approximate Jacobian \f$ J \f$. The sparsity pattern of
+     *     this matrix is normally the same between successive calls.
+     * @param gamma  Scalar factor \f$ \gamma \f$ in the iteration matrix.
+     */
+    virtual void setup(const SparseMatrix& jac, double gamma) = 0;
+
+    //! Solve \f$ P x = b \f$ approximately.
+    /*!
+     * @param[in] rhs   Right hand side vector \f$ b \f$
+     * @param[out] x    Solution vector
+     */
+    virtual void solve(const double* rhs, double* x) = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,136 @@
+/**
+ *  @file SparseLU.h
+ *  Declarations for the classes SparseLU, which computes LU factorizations of
+ *  sparse matrices, and SparseLUPreconditioner (see \ref numerics and
+ *  \link Cantera::SparseLU SparseLU \endlink).
+ */
+
+#ifndef CT_SPARSELU_H
+#define CT_SPARSELU_H
+
+#include "cantera/numerics/SparseMatrix.h"
+#include "cantera/numerics/PreconditionerBase.h"
+
+namespace Cantera
+{
+
+//! LU factorization of a square sparse matrix.
+/*!
+ * The rows and columns of the matrix are symmetrically reordered using a
+ * minimum degree ordering of the graph of \f$ A + A^T \f$, which limits the
+ * fill-in for the kinds of matrices which arise from chemical kinetics. No
+ * pivoting is done beyond this ordering, so this class is intended for
+ * matrices with a nonzero diagonal which dominates the off-diagonal terms,
+ * such as the Newton iteration matrices used by implicit ODE integrators.
+ *
+ * The ordering and the sparsity pattern of the factors are computed only
+ * when the sparsity pattern of the matrix passed to factor() changes, so
+ * repeatedly factoring matrices with the same pattern is inexpensive.
+ *
+ * @ingroup numerics
+ */
+class SparseLU
+{
+public:
+    SparseLU();
+
+    //! Compute the LU factorization of the matrix `A`. Throws an exception if
+    //! a zero pivot is encountered.
+    void factor(const SparseMatrix& A);
+
+    //! Solve the system \f$ A x = b \f$ using the most recently computed
+    //! factorization.
+    /*!
+     * @param[in,out] b  On input, the right hand side vector. On return, the
+     *     solution vector.
+     */
+    void solve(double* b);
+
+    //! Number of rows and columns in the factored matrix
+    size_t size() const {
+        return m_n;
+    }
+
+    //! Number of entries in the combined sparsity pattern of the factors,
+    //! including fill-in
+    size_t nFactorNonzeros() const {
+        return m_colIndex.size();
+    }
+
+protected:
+    //! Compute the ordering and the sparsity pattern of the factors for the
+    //! matrix `A`
+    void analyze(const SparseMatrix& A);
+
+    size_t m_n; //!< Number of rows and columns
+
+    //! Original index of the row and column used as the *i*-th pivot
+    std::vector<size_t> m_perm;
+
+    //! Pivot position of each original row and column. Inverse of #m_perm.
+    std::vector<size_t> m_iperm;
+
+    //! Start of each row in #m_colIndex and #m_values. The factors are stored
+    //! by rows in pivot order, with the unit diagonal of L implied.
+    std::vector<size_t> m_rowStart;
+
+    //! Column (pivot) index of each entry of the factors, in increasing order
+    //! within each row
+    std::vector<size_t> m_colIndex;
+
+    //! Position of the diagonal entry of each row
+    std::vector<size_t> m_diag;
+
+    //! Values of the entries of the factors
+    vector_fp m_values;
+
+    //! Position in #m_values of each entry of the matrix being factored
+    std::vector<size_t> m_map;
+
+    //! Sparsity pattern of the matrix used in the last call to analyze()
+    std::vector<size_t> m_colStartA, m_rowIndexA;
+
+    //! Work array of length #m_n
+    vector_fp m_work;
+};
+
+//! Preconditioner which uses the exact LU factorization of the sparse
+//! iteration matrix \f$ P = I - \gamma J \f$.
+/*!
+ * When the Jacobian \f$ J \f$ neglects only weak couplings, the
+ * preconditioned iterative solver converges in a few iterations, and the
+ * cost of each step scales with the number of nonzero entries in \f$ J \f$
+ * rather than with the cube of the number of equations.
+ *
+ * @ingroup numerics
+ */
+class SparseLUPreconditioner : public PreconditionerBase
+{
+public:
+    virtual void setup(const SparseMatrix& jac, double gamma);
+    virtual void solve(const double* rhs, double* x);
+
+    //! The factorization of the most recent iteration matrix
+    const SparseLU& factorization() const {
+        return m_lu;
+    }
+
+protected:
+    //! The iteration matrix, which includes all diagonal entries
+    SparseMatrix m_P;
+
+    //! Position in the values of #m_P of each entry of the Jacobian
+    std::vector<size_t> m_map;
+
+    //! Position in the values of #m_P of each diagonal entry
+    std::vector<size_t> m_diag;
+
+    //! Sparsity pattern of the Jacobian used to construct #m_P
+    std::vector<size_t> m_colStartJ, m_rowIndexJ;
+
+    SparseLU m_lu;
+};
+
+}
+
+#endif
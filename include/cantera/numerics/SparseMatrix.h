@@ -0,0 +1,150 @@
+/**
+ *  @file SparseMatrix.h
+ *  Declarations for the class SparseMatrix, which stores sparse matrices in
+ *  compressed column format (see \ref numerics and
+ *  \link Cantera::SparseMatrix SparseMatrix \endlink).
+ */
+
+#ifndef CT_SPARSEMATRIX_H
+#define CT_SPARSEMATRIX_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+class DenseMatrix;
+
+//! A sparse matrix stored in compressed column format.
+/*!
+ * The sparsity pattern (the set of entries which may be nonzero) is fixed by
+ * one of the setPattern() methods, after which values may be assigned to or
+ * accumulated into any entry in the pattern. Within each column, the row
+ * indices are stored in increasing order. Entries are stored in the three
+ * arrays returned by columnStarts(), rowIndices() and values(), such that the
+ * entries of column `j` are at positions `columnStarts()[j]` through
+ * `columnStarts()[j+1]-1`.
+ *
+ * @ingroup numerics
+ */
+class SparseMatrix
+{
+public:
+    //! Default constructor. Creates an empty matrix.
+    SparseMatrix();
+
+    //! Create an `n` by `m` matrix with no nonzero entries.
+    SparseMatrix(size_t n, size_t m);
+
+    //! Resize the matrix to `n` rows by `m` columns. Any existing sparsity
+    //! pattern is discarded.
+    void resize(size_t n, size_t m);
+
+    //! Set the sparsity pattern of the matrix.
+    /*!
+     * @param entries  (row, column) index pairs of the entries which may be
+     *     nonzero. Duplicate entries are allowed, and are combined.
+     *
+     * All values are set to zero.
+     */
+    void setPattern(const std::vector<std::pair<size_t, size_t> >& entries);
+
+    //! Set the sparsity pattern of the matrix to that of the product `A*B`.
+    /*!
+     * The matrix is resized to `A.nRows()` by `B.nColumns()`. All values are
+     * set to zero.
+     */
+    void setProductPattern(const SparseMatrix& A, const SparseMatrix& B);
+
+    //! Set the values of the matrix to the product `A*B`.
+    /*!
+     * The sparsity pattern must have been set previously by a call to
+     * setProductPattern() with matrices having the same patterns as `A` and
+     * `B`.
+     */
+    void setProduct(const SparseMatrix& A, const SparseMatrix& B);
+
+    //! Return a reference to the entry in row `i` and column `j`. An exception
+    //! is thrown if this entry is not part of the sparsity pattern.
+    double& operator()(size_t i, size_t j);
+
+    //! Return the value of the entry in row `i` and column `j`. Returns zero
+    //! for entries which are not part of the sparsity pattern.
+    double value(size_t i, size_t j) const;
+
+    //! Return the position of the entry in row `i` and column `j` in the
+    //! array returned by values(), or `npos` if it is not part of the sparsity
+    //! pattern.
+    size_t index(size_t i, size_t j) const;
+
+    //! Set all values in the matrix to zero, retaining the sparsity pattern.
+    void zero();
+
+    //! Set this matrix equal to `other`. If both matrices already have the
+    //! same sparsity pattern, only the values are copied, without
+    //! reallocating the pattern.
+    void assign(const SparseMatrix& other);
+
+    //! Multiply the matrix by the vector `b` and write the result to `prod`.
+    void mult(const double* b, double* prod) const;
+
+    //! Copy the values of this matrix into the dense matrix `dense`, which is
+    //! resized to match.
+    void toDense(DenseMatrix& dense) const;
+
+    //! Number of rows
+    size_t nRows() const {
+        return m_nrows;
+    }
+
+    //! Number of columns
+    size_t nColumns() const {
+        return m_ncols;
+    }
+
+    //! Number of entries in the sparsity pattern
+    size_t nNonzeros() const {
+        return m_rowIndex.size();
+    }
+
+    //! Index of the first entry of each column. Length nColumns()+1.
+    const std::vector<size_t>& columnStarts() const {
+        return m_colStart;
+    }
+
+    //! Row index of each entry. Length nNonzeros().
+    const std::vector<size_t>& rowIndices() const {
+        return m_rowIndex;
+    }
+
+    //! Value of each entry. Length nNonzeros().
+    vector_fp& values() {
+        return m_values;
+    }
+
+    //! Value of each entry. Length nNonzeros().
+    const vector_fp& values() const {
+        return m_values;
+    }
+
+protected:
+    size_t m_nrows; //!< Number of rows
+    size_t m_ncols; //!< Number of columns
+
+    //! Index of the first entry of each column, with an extra entry at the
+    //! end equal to the total number of entries
+    std::vector<size_t> m_colStart;
+
+    //! Row index of each entry
+    std::vector<size_t> m_rowIndex;
+
+    //! Value of each entry
+    vector_fp m_values;
+
+    //! Work array used by setProduct(). Length nRows().
+    vector_fp m_work;
+};
+
+}
+
+#endif
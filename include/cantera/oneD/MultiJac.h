@@ -8,6 +8,7 @@
 #define CT_MULTIJAC_H
 
 #include "cantera/numerics/BandMatrix.h"
+#include "cantera/numerics/BlockTridiagLU.h"
 #include "OneDim.h"
 
 namespace Cantera
@@ -18,6 +19,13 @@ namespace Cantera
  * residual function supplied by an instance of class OneDim. The residual
  * function may consist of several linked 1D domains, with different variables
  * in each domain.
+ *
+ * The Jacobian is stored in the banded storage of BandMatrix or, if the
+ * block-tridiagonal solver is enabled (see OneDim::setBlockTridiagonalSolver),
+ * in a BlockTridiagLU object with one block for each grid point. In the
+ * latter case, the banded storage is only allocated while the block
+ * factorization fails, and its elements are accessed with value() or
+ * operator().
  * @ingroup onedim
  */
 class MultiJac : public BandMatrix
@@ -30,10 +38,25 @@ public:
      * which must be supplied on input. The third parameter 'rdt' is the
      * reciprocal of the time step. If zero, the steady-state Jacobian is
      * evaluated.
+     *
+     * The Jacobian is computed by finite differences. Since the residual at
+     * each point depends only on the solution at the adjacent points, the
+     * columns for points which are three points apart are computed together
+     * from a single evaluation of the residual at all points (see
+     * OneDim::evalJacobianResidual), which can use multiple threads. The
+     * first and last points of each domain are always perturbed separately.
+     * Since the points adjacent to the perturbed points cover the whole grid,
+     * the residual is still evaluated about three times per point and
+     * component; the serial savings come from the properties computed at the
+     * points next to the evaluated ones, which a single-point evaluation
+     * must also update. Coloring can be disabled with
+     * OneDim::setJacobianColoring, in which case each column is computed
+     * from a residual evaluation at the points adjacent to the perturbed
+     * point.
      */
     void eval(doublereal* x0, doublereal* resid0, double rdt);
 
-    //! Elapsed CPU time spent computing the Jacobian.
+    //! Elapsed wall clock time spent computing the Jacobian.
     doublereal elapsedTime() const {
         return m_elapsed;
     }
@@ -43,6 +66,22 @@ public:
         return m_nevals;
     }
 
+    //! Elapsed wall clock time spent factoring the Jacobian.
+    doublereal factorTime() const {
+        return m_factorElapsed;
+    }
+
+    //! Elapsed wall clock time spent solving linear systems with the factored
+    //! Jacobian, not including the factorization.
+    doublereal solveTime() const {
+        return m_solveElapsed;
+    }
+
+    //! Number of factorizations of the Jacobian.
+    int nFactors() const {
+        return m_nfactors;
+    }
+
     //! Number of times 'incrementAge' has been called since the last evaluation
     int age() const {
         return m_age;
@@ -66,7 +105,60 @@ public:
 
     void incrementDiagonal(int j, doublereal d);
 
+    //! Return a changeable reference to element (i,j) of the Jacobian
+    doublereal& value(size_t i, size_t j);
+
+    //! Return the value of element (i,j) of the Jacobian
+    doublereal value(size_t i, size_t j) const;
+
+    doublereal& operator()(size_t i, size_t j) {
+        return value(i, j);
+    }
+
+    doublereal operator()(size_t i, size_t j) const {
+        return value(i, j);
+    }
+
+    //! Solve the matrix problem Ax = b
+    /*!
+     * If the block-tridiagonal solver is enabled (see setBlockTridiagonal),
+     * the matrix is factored using BlockTridiagLU. If a diagonal block is
+     * singular or ill-conditioned, the Jacobian is copied to the banded
+     * storage and the banded LU factorization of BandMatrix is used instead.
+     * The banded storage is released again after the next successful block
+     * factorization.
+     *
+     * @param b  INPUT RHS of the problem
+     * @param x  OUTPUT solution to the problem
+     * @return a success flag. 0 indicates a success; ~0 indicates some error
+     *     occurred, see BandMatrix::solve
+     */
+    int solve(const doublereal* const b, doublereal* const x);
+
+    //! Enable or disable the block-tridiagonal solver, copying the current
+    //! Jacobian to the storage used by the selected solver. See
+    //! OneDim::setBlockTridiagonalSolver.
+    void setBlockTridiagonal(bool blocks);
+
+    //! True if the current factorization is the block-tridiagonal one, false
+    //! if the banded LU factorization is used
+    bool blockFactored() const {
+        return m_blockFactored;
+    }
+
 protected:
+    //! Compute the column `ipt` of the Jacobian, for a component at point `j`,
+    //! from the perturbed residual #m_r1 and the perturbation `m_dx[ipt]`
+    void setColumn(size_t j, size_t ipt, const doublereal* resid0);
+
+    //! Copy the Jacobian from #m_blockLU to the banded storage, allocating
+    //! it if needed (`toBand` = true), or from the banded storage to
+    //! #m_blockLU (`toBand` = false).
+    void copyJacobian(bool toBand);
+
+    //! Release the banded storage of the Jacobian and its LU factors
+    void releaseBand();
+
     //! Residual evaluator for this Jacobian
     /*!
      * This is a pointer to the residual evaluator. This object isn't owned by
@@ -75,11 +167,35 @@ protected:
     OneDim* m_resid;
 
     vector_fp m_r1;
+
+    //! Perturbation applied to each component of the solution
+    vector_fp m_dx;
+
+    //! Unperturbed values of the components perturbed together
+    vector_fp m_xsave;
+
+    //! Points where the components are perturbed one at a time
+    std::vector<bool> m_single;
+
+    //! Jacobian stored as a block-tridiagonal matrix with one block for each
+    //! point, and its factorization. Only used with the block-tridiagonal
+    //! solver.
+    BlockTridiagLU m_blockLU;
+
+    //! True if the block-tridiagonal solver is used
+    bool m_blockSolver;
+
+    //! True if the current factorization is the block-tridiagonal one
+    bool m_blockFactored;
+
     doublereal m_rtol, m_atol;
     doublereal m_elapsed;
+    doublereal m_factorElapsed;
+    doublereal m_solveElapsed;
     vector_fp m_ssdiag;
     vector_int m_mask;
     int m_nevals;
+    int m_nfactors;
     int m_age;
     size_t m_size;
     size_t m_points;
@@ -68,6 +68,39 @@ public:
         m_maxAge = maxJacAge;
     }
 
+    //! Use the rate of convergence of the Newton iteration to decide when to
+    //! re-evaluate the Jacobian.
+    /*!
+     * The convergence rate is the ratio of the norm of the undamped step at
+     * the new solution to that of the previous undamped step. If `adaptive`
+     * is true, the Jacobian is kept beyond the maximum age set with
+     * setOptions() as long as the convergence rate is less than `maxRate`,
+     * and it is re-evaluated as soon as the convergence rate exceeds
+     * `maxRate`, instead of after the damped Newton step fails. This is
+     * disabled by default.
+     */
+    void setAdaptiveJacobian(bool adaptive, double maxRate=0.5) {
+        m_adaptiveJac = adaptive;
+        m_maxRate = maxRate;
+    }
+
+    //! Number of Newton steps taken since the last call to clearStats()
+    int nSteps() const {
+        return m_nsteps;
+    }
+
+    //! Number of Jacobian re-evaluations triggered by a slow convergence rate
+    //! since the last call to clearStats(). See setAdaptiveJacobian().
+    int nRateJacobians() const {
+        return m_nRateJac;
+    }
+
+    //! Reset the counters returned by nSteps() and nRateJacobians()
+    void clearStats() {
+        m_nsteps = 0;
+        m_nRateJac = 0;
+    }
+
     /// Change the problem size.
     void resize(size_t points);
 
@@ -75,8 +108,24 @@ protected:
     //! Work arrays of size #m_n used in solve().
     vector_fp m_x, m_stp, m_stp1;
 
+    //! Work array of size #m_n used for the residual when logging
+    vector_fp m_resid;
+
     int m_maxAge;
 
+    //! If true, the convergence rate is used to decide when to re-evaluate
+    //! the Jacobian. See setAdaptiveJacobian().
+    bool m_adaptiveJac;
+
+    //! Maximum convergence rate for reusing the Jacobian
+    double m_maxRate;
+
+    //! Number of Newton steps taken
+    int m_nsteps;
+
+    //! Number of Jacobian re-evaluations triggered by slow convergence
+    int m_nRateJac;
+
     //! number of variables
     size_t m_n;
 
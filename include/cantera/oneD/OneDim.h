@@ -169,6 +169,62 @@ public:
     void eval(size_t j, double* x, double* r, doublereal rdt=-1.0,
               int count = 1);
 
+    /**
+     * Evaluate the residual function at all grid points, using the same
+     * approximations that are made when evaluating the residual at a single
+     * point for computing a column of the Jacobian: the steady-state residual
+     * is evaluated and properties which are held constant while computing the
+     * Jacobian (e.g. transport properties) are not updated. This is used by
+     * MultiJac to compute several columns of the Jacobian with one residual
+     * evaluation.
+     *
+     * @param x       solution vector
+     * @param r       on return, contains the residual vector
+     */
+    void evalJacobianResidual(double* x, double* r);
+
+    //! True while evalJacobianResidual() is evaluating the residual. Domains
+    //! should then make the same approximations as when #eval is called for
+    //! a single point.
+    bool evaluatingJacobian() const {
+        return m_jac_eval;
+    }
+
+    //! Enable or disable the evaluation of several columns of the Jacobian at
+    //! once (enabled by default). Coloring should be disabled if the residual
+    //! of any domain depends on the solution at points that are not adjacent
+    //! to it, other than the first and last points of a domain. See
+    //! MultiJac::eval.
+    void setJacobianColoring(bool coloring) {
+        m_jac_coloring = coloring;
+    }
+
+    //! True if several columns of the Jacobian are evaluated at once
+    bool jacobianColoring() const {
+        return m_jac_coloring;
+    }
+
+    //! Enable or disable the block-tridiagonal LU factorization of the
+    //! Jacobian (disabled by default). Its cost grows with the cube of the
+    //! number of components at each point, while the cost of the banded LU
+    //! factorization grows with the cube of the bandwidth, which is about
+    //! twice as large. However, pivoting is only done within the diagonal
+    //! blocks, so the banded factorization is used instead if a diagonal
+    //! block is singular or ill-conditioned. When enabled, the Jacobian is
+    //! stored as dense blocks for each grid point, without the zeros within
+    //! the band that are stored for the banded LU factorization. See
+    //! MultiJac::solve.
+    void setBlockTridiagonalSolver(bool blocks);
+
+    //! True if the block-tridiagonal solver is used
+    bool blockTridiagonalSolver() const {
+        return m_block_solver;
+    }
+
+    //! Use the rate of convergence of the Newton iteration to decide when to
+    //! re-evaluate the Jacobian. See MultiNewton::setAdaptiveJacobian.
+    void setAdaptiveJacobian(bool adaptive, double maxRate=0.5);
+
     //! Return a pointer to the domain global point *i* belongs to.
     /*!
      * The domains are scanned right-to-left, and the first one with starting
@@ -234,15 +290,95 @@ public:
      *
      * - number of grid points
      * - number of Jacobian evaluations
-     * - CPU time spent evaluating Jacobians
+     * - wall clock time spent evaluating Jacobians
      * - number of non-Jacobian function evaluations
-     * - CPU time spent evaluating functions
+     * - wall clock time spent evaluating functions
      */
     void saveStats();
 
     //! Clear saved statistics
     void clearStats();
 
+    //! @name Solver statistics
+    //!
+    //! Each of these methods returns one value for each grid for which
+    //! statistics were saved by saveStats(), which is called when the grid
+    //! changes and when the problem definition changes. Wall clock times are in
+    //! seconds.
+    //! @{
+
+    //! Return total grid size for each grid
+    const std::vector<size_t>& gridSizeStats() {
+        saveStats();
+        return m_gridpts;
+    }
+
+    //! Return number of non-Jacobian function evaluations for each grid
+    const vector_int& evalCountStats() {
+        saveStats();
+        return m_funcEvals;
+    }
+
+    //! Return wall clock time spent on non-Jacobian function evaluations for
+    //! each grid
+    const vector_fp& evalTimeStats() {
+        saveStats();
+        return m_funcElapsed;
+    }
+
+    //! Return number of Jacobian evaluations for each grid
+    const vector_int& jacobianCountStats() {
+        saveStats();
+        return m_jacEvals;
+    }
+
+    //! Return wall clock time spent evaluating Jacobians for each grid
+    const vector_fp& jacobianTimeStats() {
+        saveStats();
+        return m_jacElapsed;
+    }
+
+    //! Return wall clock time spent factoring Jacobians for each grid
+    const vector_fp& factorTimeStats() {
+        saveStats();
+        return m_factorElapsed;
+    }
+
+    //! Return wall clock time spent solving linear systems with the factored
+    //! Jacobians for each grid
+    const vector_fp& solveTimeStats() {
+        saveStats();
+        return m_solveElapsed;
+    }
+
+    //! Return number of Newton steps taken for each grid
+    const vector_int& newtonStepStats() {
+        saveStats();
+        return m_newtonSteps;
+    }
+
+    //! Return number of time steps taken for each grid
+    const vector_int& timeStepStats() {
+        saveStats();
+        return m_timeSteps;
+    }
+
+    //! Return wall clock time spent time stepping for each grid, including the
+    //! function evaluations, Jacobian evaluations and linear solves done
+    //! while time stepping
+    const vector_fp& timeStepTimeStats() {
+        saveStats();
+        return m_timeStepElapsed;
+    }
+
+    //! Return wall clock time spent on the grid refinement which created each
+    //! grid
+    const vector_fp& refineTimeStats() {
+        saveStats();
+        return m_refineElapsed;
+    }
+    //! @}
+
     //! Set a function that will be called every time #eval is called.
     //! Can be used to provide keyboard interrupt support in the high-level
     //! language interfaces.
@@ -263,6 +399,9 @@ protected:
     std::unique_ptr<MultiNewton> m_newt; //!< Newton iterator
     doublereal m_rdt; //!< reciprocal of time step
     bool m_jac_ok; //!< if true, Jacobian is current
+    bool m_jac_eval; //!< true while in evalJacobianResidual()
+    bool m_jac_coloring; //!< if true, Jacobian columns are evaluated by color
+    bool m_block_solver; //!< if true, use the block-tridiagonal solver
 
     size_t m_bw; //!< Jacobian bandwidth
     size_t m_size; //!< solution vector size
@@ -282,6 +421,10 @@ protected:
     //! Function called at the start of every call to #eval.
     Func1* m_interrupt;
 
+    //! Wall clock time spent refining the grid since statistics were last
+    //! saved
+    doublereal m_refinetime;
+
 private:
     // statistics
     int m_nevals;
@@ -291,6 +434,19 @@ private:
     vector_fp m_jacElapsed;
     vector_int m_funcEvals;
     vector_fp m_funcElapsed;
+    vector_fp m_factorElapsed;
+    vector_fp m_solveElapsed;
+    vector_int m_newtonSteps;
+
+    //! Number of time steps taken since statistics were last saved
+    int m_nsteps;
+
+    //! Wall clock time spent time stepping since statistics were last saved
+    doublereal m_timesteptime;
+
+    vector_int m_timeSteps;
+    vector_fp m_timeStepElapsed;
+    vector_fp m_refineElapsed;
 };
 
 }
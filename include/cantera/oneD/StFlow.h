@@ -9,6 +9,8 @@
 #include "cantera/base/Array.h"
 #include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/kinetics/Kinetics.h"
+#include "cantera/transport/TransportBase.h"
+#include "cantera/base/ThreadPool.h"
 
 namespace Cantera
 {
@@ -29,8 +31,6 @@ const int c_Mixav_Transport = 0;
 const int c_Multi_Transport = 1;
 const int c_Soret = 2;
 
-class Transport;
-
 /**
  *  This class represents 1D flow domains that satisfy the one-dimensional
  *  similarity solution for chemically-reacting, axisymmetric flows.
@@ -50,6 +50,8 @@ public:
     //! @param points Initial number of grid points
     StFlow(IdealGasPhase* ph = 0, size_t nsp = 1, size_t points = 1);
 
+    virtual ~StFlow();
+
     //! @name Problem Specification
     //! @{
 
@@ -71,11 +73,15 @@ public:
      */
     void setThermo(IdealGasPhase& th) {
         m_thermo = &th;
+        m_work.resize(1);
+        m_work[0].thermo = &th;
     }
 
     //! Set the kinetics manager. The kinetics manager must
     void setKinetics(Kinetics& kin) {
         m_kin = &kin;
+        m_work.resize(1);
+        m_work[0].kin = &kin;
     }
 
     //! set the transport manager
@@ -85,6 +91,24 @@ public:
         return m_do_soret;
     }
 
+    //! Set the number of threads used to evaluate the residual.
+    /*!
+     *  When evaluating the residual at all grid points, the thermodynamic
+     *  properties, production rates and transport properties at each point
+     *  are evaluated in parallel, which gives the same residual as the serial
+     *  evaluation. Each additional thread uses its own copies of the phase,
+     *  kinetics and transport objects, which are created when the residual is
+     *  next evaluated. Apart from the reaction rate multipliers, later changes
+     *  to these objects are not seen by the copies unless this method is
+     *  called again. If `n` is zero, the number of hardware threads is used.
+     */
+    void setNumThreads(size_t n);
+
+    //! Number of threads used to evaluate the residual
+    size_t numThreads() const {
+        return m_pool ? m_pool->nThreads() : 1;
+    }
+
     //! Set the pressure. Since the flow equations are for the limit of small
     //! Mach number, the pressure is very nearly constant throughout the flow.
     void setPressure(doublereal p) {
@@ -304,23 +328,59 @@ protected:
 
     //! Write the net production rates at point `j` into array `m_wdot`
     void getWdot(doublereal* x, size_t j) {
-        setGas(x,j);
-        m_kin->getNetProductionRates(&m_wdot(0,j));
+        getWdot(x, j, m_work[0]);
     }
 
     /**
      * Update the thermodynamic properties from point j0 to point j1
      * (inclusive), based on solution x.
      */
-    void updateThermo(const doublereal* x, size_t j0, size_t j1) {
-        for (size_t j = j0; j <= j1; j++) {
-            setGas(x,j);
-            m_rho[j] = m_thermo->density();
-            m_wtm[j] = m_thermo->meanMolecularWeight();
-            m_cp[j] = m_thermo->cp_mass();
-        }
+    void updateThermo(const doublereal* x, size_t j0, size_t j1);
+
+    //! The objects used by one thread to evaluate properties at a grid point.
+    //! The first workspace uses the objects passed to setThermo(),
+    //! setKinetics() and setTransport(); the others use copies of them.
+    struct Workspace {
+        Workspace() : thermo(0), kin(0), trans(0) {}
+        IdealGasPhase* thermo;
+        Kinetics* kin;
+        Transport* trans;
+        vector_fp ybar;
+        std::unique_ptr<IdealGasPhase> thermoCopy;
+        std::unique_ptr<Kinetics> kinCopy;
+        std::unique_ptr<Transport> transCopy;
+    };
+
+    //! Set the state of the phase used by workspace `ws` to the solution at
+    //! point j.
+    void setGas(const doublereal* x, size_t j, Workspace& ws);
+
+    //! Set the state of the phase used by workspace `ws` to the midpoint
+    //! between j and j + 1.
+    void setGasAtMidpoint(const doublereal* x, size_t j, Workspace& ws);
+
+    //! Write the net production rates at point `j` into array `m_wdot`,
+    //! using the objects of workspace `ws`.
+    void getWdot(doublereal* x, size_t j, Workspace& ws) {
+        setGas(x, j, ws);
+        ws.kin->getNetProductionRates(&m_wdot(0,j));
     }
 
+    //! Evaluate the residual equations at point `j`, using the objects of
+    //! workspace `ws`.
+    void evalPoint(size_t j, doublereal* x, doublereal* rsd, integer* diag,
+                   doublereal rdt, Workspace& ws);
+
+    //! Call `f(j, ws)` for each grid point `j` from `j0` to `j1 - 1`. If more
+    //! than one thread is being used, the points are distributed over the
+    //! threads, each of which uses its own Workspace.
+    void forEachPoint(size_t j0, size_t j1,
+                      const std::function<void(size_t, Workspace&)>& f);
+
+    //! Create or update the copies of the phase, kinetics and transport
+    //! objects used by each thread
+    void updateWorkspaces();
+
     //--------------------------------
     // central-differenced derivatives
     //--------------------------------
@@ -490,8 +550,12 @@ protected:
     //! to `j1`, based on solution `x`.
     void updateTransport(doublereal* x, size_t j0, size_t j1);
 
-private:
-    vector_fp m_ybar;
+    //! Pool used for parallel evaluation of the residual. Not allocated if
+    //! only one thread is used.
+    std::unique_ptr<ThreadPool> m_pool;
+
+    //! Objects used by each thread to evaluate properties at grid points
+    std::vector<Workspace> m_work;
 };
 
 /**
@@ -78,6 +78,17 @@ public:
 
     virtual void modifyOneHf298(const size_t k, const doublereal Hf298New);
 
+    //! Coefficients of the species using NasaPoly2, in the order used by
+    //! NasaPoly2. `nasaCoeffs()[j][nasaIndex(k)]` is coefficient `j` of
+    //! species `k`. The coefficients are updated by modifyOneHf298().
+    const std::vector<vector_fp>& nasaCoeffs() const {
+        return m_nasa;
+    }
+
+    //! Position of species `k` in the arrays returned by nasaCoeffs(), or
+    //! npos if the species does not use NasaPoly2.
+    size_t nasaIndex(size_t k) const;
+
 private:
     //! Provide the SpeciesthermoInterpType object
     /*!
@@ -87,6 +98,24 @@ private:
     SpeciesThermoInterpType* provideSTIT(size_t k);
     const SpeciesThermoInterpType* provideSTIT(size_t k) const;
 
+    //! Store the coefficients of a species using NasaPoly2 in #m_nasa
+    /*!
+     * @param i   position of the species in `m_sp[NASA2]`
+     */
+    void storeNasaCoeffs(size_t i);
+
+    //! Evaluate the properties of all species using NasaPoly2
+    /*!
+     * The coefficients for each species are read from #m_nasa, and the
+     * temperature range is selected without branching, so that the loop over
+     * species can be vectorized by the compiler.
+     *
+     * @param tt  Temperature polynomial, as computed by
+     *     NasaPoly2::updateTemperaturePoly()
+     */
+    void updateNasa(const double* tt, double* cp_R, double* h_RT,
+                    double* s_R) const;
+
 protected:
     typedef std::pair<size_t, shared_ptr<SpeciesThermoInterpType> > index_STIT;
     typedef std::map<int, std::vector<index_STIT> > STIT_map;
@@ -103,6 +132,21 @@ protected:
 
     std::map<size_t, std::pair<int, size_t> > m_speciesLoc;
 
+    //! Coefficients of the species using NasaPoly2, in the order used by
+    //! NasaPoly2 (midpoint temperature, high temperature range, low
+    //! temperature range). `m_nasa[j][i]` is coefficient `j` of the species
+    //! `m_sp[NASA2][i]`.
+    std::vector<vector_fp> m_nasa;
+
+    //! True if the species in `m_sp[NASA2]` have consecutive indices, in
+    //! which case updateNasa() writes the properties directly to the output
+    //! arrays
+    bool m_nasa_consecutive;
+
+    //! Work array for updateNasa(), used if the species using NasaPoly2 are
+    //! not consecutive. Length 3 * `m_sp[NASA2].size()`.
+    mutable vector_fp m_nasa_work;
+
     //! Maximum value of the lowest temperature
     doublereal m_tlow_max;
 
@@ -59,6 +59,11 @@ public:
 
     virtual int reportType() const;
 
+    //! Number of temperature regions
+    size_t nRegions() const {
+        return m_regionPts.size();
+    }
+
     virtual size_t temperaturePolySize() const { return 7; }
     virtual void updateTemperaturePoly(double T, double* T_poly) const;
 
@@ -145,6 +145,8 @@ public:
         h = mnp_high.reportHf298(0);
         hnew = h + delH;
         mnp_high.modifyOneHf298(k, hnew);
+        m_coeff[6] += delH / GasConstant;
+        m_coeff[13] += delH / GasConstant;
     }
 
     void validate(const std::string& name);
@@ -203,6 +203,22 @@ void importPhase(XML_Node& phase, ThermoPhase* th);
 //! Add the elements given in an XML_Node tree to the specified phase
 void installElements(Phase& th, const XML_Node& phaseNode);
 
+//! Set the number of threads used by importPhase() and importKinetics() to
+//! create Species and Reaction objects from their XML definitions.
+/*!
+ * With more than one thread, all of the species of a phase (or the reactions
+ * of a reactionArray) are created in parallel before any of them are added to
+ * the phase or kinetics manager. They are added in the same order as when
+ * they are created serially, and if a definition is invalid, the exception
+ * thrown is the one for the first invalid entry, as in the serial case.
+ * Warnings issued while creating the objects may be reported in a different
+ * order. Zero uses one thread per hardware thread. The default is one thread.
+ */
+void setImportThreads(size_t n);
+
+//! The number of threads set by setImportThreads()
+size_t importThreads();
+
 //!  Search an XML tree for species data.
 /*!
  * This utility routine will search the XML tree for the species named by the
@@ -12,6 +12,35 @@ namespace Cantera
 {
 
 class MMCollisionInt;
+class ThreadPool;
+
+//! Polynomial fits computed during the initialization of a GasTransport
+//! object. See GasTransport::getFits() and GasTransport::setFits().
+struct GasTransportFits
+{
+    GasTransportFits() : mode(0) {}
+
+    //! Type of the polynomial fits to temperature (see GasTransport::m_mode)
+    int mode;
+
+    //! Fits to the species viscosities. Length nsp.
+    std::vector<vector_fp> visccoeffs;
+
+    //! Fits to the species thermal conductivities. Length nsp.
+    std::vector<vector_fp> condcoeffs;
+
+    //! Fits to the binary diffusion coefficients. Length nsp*(nsp+1)/2.
+    std::vector<vector_fp> diffcoeffs;
+
+    //! Index of the collision integral fits for each species pair
+    std::vector<vector_int> poly;
+
+    //! Fits to the collision integrals, indexed using #poly
+    std::vector<vector_fp> omega22;
+    std::vector<vector_fp> astar;
+    std::vector<vector_fp> bstar;
+    std::vector<vector_fp> cstar;
+};
 
 //! Class GasTransport implements some functions and properties that are
 //! shared by the MixTransport and MultiTransport classes.
@@ -109,6 +138,118 @@ public:
 
     virtual void init(thermo_t* thermo, int mode=0, int log_level=0);
 
+    //! Evaluate the temperature-dependent species properties by
+    //! interpolation in a table instead of from the polynomial fits.
+    /*!
+     * If `tabulate` is true, the pure species viscosities and thermal
+     * conductivities and the binary diffusion coefficients are tabulated
+     * between the minimum and maximum temperatures of the phase, on a grid
+     * which is uniform in log(T). Between the grid points, the values are
+     * found by cubic interpolation. The grid is refined until the relative
+     * error of the interpolated species properties with respect to the
+     * polynomial fits is less than `rtol` everywhere. At temperatures outside
+     * the tabulated range, the polynomial fits are used. Tabulation is
+     * disabled by default.
+     *
+     * This method must be called after init().
+     */
+    void setTabulation(bool tabulate, double rtol=1e-6);
+
+    //! Returns true if the temperature-dependent species properties are
+    //! interpolated from a table. See setTabulation().
+    bool tabulated() const {
+        return m_tabulate;
+    }
+
+    //! Number of temperatures in the table of species properties, or zero if
+    //! tabulation is disabled
+    size_t nTabulationPoints() const {
+        return (m_tabulate) ? m_table.size() / m_tab_width : 0;
+    }
+
+    //! Get the polynomial fits to the species properties and collision
+    //! integrals computed by init().
+    void getFits(GasTransportFits& fits) const;
+
+    //! Use precomputed polynomial fits in the next call to init().
+    /*!
+     * Fitting the collision integrals and species properties is the most
+     * expensive part of initializing the transport manager for large
+     * mechanisms. If fits previously obtained from getFits() for the same
+     * phase and fitting mode are provided here, init() uses them instead of
+     * recomputing them. The fits are only used once.
+     */
+    void setFits(const GasTransportFits& fits);
+
+    //! Store the polynomial fits computed by init() in the directory `dir`,
+    //! and reuse them in later calls to init(), including in other processes.
+    /*!
+     * Each cache file is identified by the fitting mode, the temperature
+     * range of the phase, and the molecular weights, transport parameters
+     * and reference-state heat capacities of the species, which together
+     * determine the fits. Files which cannot be read or which do not match
+     * the phase are ignored, and the fits are recomputed. The directory must
+     * exist. An empty string disables the cache, which is the default.
+     * Applies to all GasTransport objects.
+     */
+    static void setFitCache(const std::string& dir);
+
+    //! The directory set with setFitCache(), or an empty string
+    static std::string fitCache();
+
+    //! The cache file from which the fits were read, or to which they were
+    //! written, by the last call to init(). Empty if the cache was not used.
+    const std::string& fitCacheFile() const {
+        return m_fitCacheFile;
+    }
+
+    //! Set the number of threads used by init() to compute the polynomial
+    //! fits if they are not found in the cache. Zero uses the number of
+    //! hardware threads. The default is one. The fits do not depend on the
+    //! number of threads. Applies to all GasTransport objects.
+    static void setFitThreads(size_t n);
+
+    //! @name Batched evaluation
+    //!
+    //! These methods evaluate transport properties for many states at once,
+    //! without using or modifying the state of the associated ThermoPhase
+    //! object. The states are processed in blocks, and the polynomial fits
+    //! for each species or species pair are evaluated for all states in a
+    //! block in a single loop. If tabulation is enabled (see
+    //! setTabulation()), the species properties are interpolated from the
+    //! table for the states within the tabulated range, as they are for a
+    //! single state, and the polynomial fits are used for all other states.
+    //!
+    //! The mole fractions of state `i` are given by `X[i*m_nsp + k]`, and are
+    //! normalized before use.
+    //! @{
+
+    //! Mixture viscosities (Pa-s) for `n` states, computed using the Wilke
+    //! mixture rule as in viscosity()
+    /*!
+     * @param n     Number of states
+     * @param T     Temperatures [K]. Length `n`.
+     * @param X     Mole fractions. Length `n*m_nsp`.
+     * @param visc  Output mixture viscosities. Length `n`.
+     */
+    void getBatchViscosity(size_t n, const double* T, const double* X,
+                           double* visc);
+
+    //! Mixture-averaged diffusion coefficients [m^2/s] for `n` states,
+    //! computed as in getMixDiffCoeffs()
+    /*!
+     * @param n     Number of states
+     * @param T     Temperatures [K]. Length `n`.
+     * @param P     Pressures [Pa]. Length `n`.
+     * @param X     Mole fractions. Length `n*m_nsp`.
+     * @param d     Output mixture diffusion coefficients, where `d[i*m_nsp +
+     *     k]` is the coefficient for species `k` in state `i`. Length
+     *     `n*m_nsp`.
+     */
+    void getBatchMixDiffCoeffs(size_t n, const double* T, const double* P,
+                               const double* X, double* d);
+    //! @}
+
 protected:
     GasTransport(ThermoPhase* thermo=0);
 
@@ -141,6 +282,22 @@ protected:
      */
     virtual void updateDiff_T();
 
+    //! Evaluate the binary diffusion coefficients at unit pressure for the
+    //! species pairs (i, j) with j >= i, and store them in `d[j-i]`
+    void evalBinaryDiffRow(size_t i, double* d) const;
+
+    //! Update the sums used for the mixture-averaged diffusion coefficients
+    /*!
+     * Computes the sums over species \f$ j \ne k \f$ of \f$ X_j / D_{kj} \f$
+     * and, if `weighted` is true, of \f$ X_j M_j / D_{kj} \f$, which are
+     * stored in #m_diffsum1 and #m_diffsum2. The binary diffusion
+     * coefficients are traversed once in the packed order of
+     * #m_diffcoeffs. If #m_bdiff_rinv is out of date, each row is evaluated
+     * from the fits and accumulated while it is in cache, so the full matrix
+     * #m_bdiff is never formed.
+     */
+    void updateMixDiffSums(bool weighted);
+
     //! @name Initialization
     //! @{
 
@@ -177,8 +334,10 @@ protected:
     //! Generate polynomial fits to collision integrals
     /*!
      * @param integrals interpolator for the collision integrals
+     * @param pool  If not null, the fits for different values of delta* are
+     *     computed in parallel using this pool
      */
-    void fitCollisionIntegrals(MMCollisionInt& integrals);
+    void fitCollisionIntegrals(MMCollisionInt& integrals, ThreadPool* pool=0);
 
     //! Generate polynomial fits to the viscosity, conductivity, and
     //! the binary diffusion coefficients
@@ -201,8 +360,30 @@ protected:
      * \f]
      *
      * @param integrals interpolator for the collision integrals
+     * @param cp_R  reference-state heat capacities at the temperatures used
+     *     for the fits (see fitHeatCapacities())
+     * @param pool  If not null, the fits for different species and species
+     *     pairs are computed in parallel using this pool
      */
-    void fitProperties(MMCollisionInt& integrals);
+    void fitProperties(MMCollisionInt& integrals, const vector_fp& cp_R,
+                       ThreadPool* pool=0);
+
+    //! Reference-state heat capacities of all species at the temperatures
+    //! used by fitProperties(), with species `k` at temperature `n` in
+    //! element `n*m_nsp + k`. Leaves the phase at the highest of these
+    //! temperatures.
+    vector_fp fitHeatCapacities();
+
+    //! The data which determine the polynomial fits, used to identify the
+    //! files of the fit cache (see setFitCache())
+    vector_fp fitCacheKey(const vector_fp& cp_R) const;
+
+    //! True if `fits` have the dimensions required for the current phase and
+    //! fitting mode
+    bool checkFits(const GasTransportFits& fits) const;
+
+    //! Replace the polynomial fits by `fits`, which are left empty
+    void useFits(GasTransportFits& fits);
 
     //! Second-order correction to the binary diffusion coefficients
     /*!
@@ -232,6 +413,129 @@ protected:
 
     //! @}
 
+    //! Number of states evaluated together by the batched methods
+    static const size_t BatchSize = 64;
+
+    //! Evaluate the polynomial fit with coefficients `c` for `nb` states
+    /*!
+     * In CK mode, the exponential of the polynomial is returned, and the
+     * values computed are the fitted properties. Otherwise, the polynomial
+     * is returned, which must be multiplied by the appropriate power of the
+     * temperature (see fitProperties()).
+     *
+     * If tabulation is enabled, the values for the states with
+     * `j0[i] != npos` are instead interpolated from column `col` of #m_table.
+     *
+     * @param c     polynomial coefficients
+     * @param col   column of #m_table containing the same property
+     * @param nb    number of states
+     * @param logt  log of the temperature of each state
+     * @param j0    first table row used for each state, from
+     *     tableWeightsBatch(). Not used if tabulation is disabled.
+     * @param w     interpolation weights for each state, from
+     *     tableWeightsBatch(). Not used if tabulation is disabled.
+     * @param out   output values for each state
+     */
+    void evalFitBatch(const vector_fp& c, size_t col, size_t nb,
+                      const double* logt, const size_t* j0, const double* w,
+                      double* out) const;
+
+    //! Compute the table rows and interpolation weights used to evaluate
+    //! the species properties for a block of `nb` states, if tabulation is
+    //! enabled.
+    /*!
+     * @param nb    number of states
+     * @param logt  log of the temperature of each state
+     * @param j0    output index of the first of the four table rows used for
+     *     each state, or `npos` if the temperature is outside the tabulated
+     *     range. Length `nb`.
+     * @param w     output interpolation weights for each state, with the
+     *     weights for state `i` in `w[4*i]` to `w[4*i+3]`. Length `4*nb`.
+     */
+    void tableWeightsBatch(size_t nb, const double* logt, size_t* j0,
+                           double* w) const;
+
+    //! Prepare a block of states for batched evaluation
+    /*!
+     * @param nb    number of states in the block
+     * @param T     temperatures
+     * @param X     mole fractions, as for the batched methods
+     * @param logt  output log of each temperature. Length `nb`.
+     * @param xb    output normalized mole fractions, with species `k` in
+     *     state `i` at `xb[k*nb + i]`, and offset to be at least *Tiny*
+     *     as for #m_molefracs. Length `nb*m_nsp`.
+     * @param mmw   output mean molecular weight of each state, computed from
+     *     the normalized mole fractions without the offset. Length `nb`.
+     */
+    void prepareBatch(size_t nb, const double* T, const double* X,
+                      double* logt, double* xb, double* mmw) const;
+
+    //! @name Tabulation of the species properties
+    //! @{
+
+    //! Evaluate the tabulated species properties directly from the
+    //! polynomial fits at the temperature with logarithm `logt`.
+    /*!
+     * @param logt  log of the temperature
+     * @param g     output array of length #m_tab_width, containing the parts
+     *     of the species viscosities, the species thermal conductivities and
+     *     the binary diffusion coefficients which are fitted by polynomials,
+     *     in that order. The binary diffusion coefficients are ordered as in
+     *     #m_diffcoeffs.
+     */
+    void evalPropertyFits(double logt, double* g) const;
+
+    //! Compute the index of the first of the four table rows used for cubic
+    //! interpolation at the temperature with logarithm `logt`, and the
+    //! interpolation weights for those rows. Returns false if `logt` is
+    //! outside the tabulated range.
+    bool interpolationWeights(double logt, size_t& j0, double* w) const;
+
+    //! Interpolate `n` consecutive columns of the table, starting with
+    //! column `start`, using the weights for the current temperature.
+    void interpolate(size_t start, size_t n, double* out) const {
+        const double* r0 = m_table.data() + m_tab_j0 * m_tab_width + start;
+        const double* r1 = r0 + m_tab_width;
+        const double* r2 = r1 + m_tab_width;
+        const double* r3 = r2 + m_tab_width;
+        const double w0 = m_tab_w[0], w1 = m_tab_w[1], w2 = m_tab_w[2],
+            w3 = m_tab_w[3];
+        for (size_t k = 0; k < n; k++) {
+            out[k] = w0 * r0[k] + w1 * r1[k] + w2 * r2[k] + w3 * r3[k];
+        }
+    }
+
+    //! True if the species properties are interpolated from #m_table
+    bool m_tabulate;
+
+    //! True if the current temperature is within the tabulated range
+    bool m_tab_inrange;
+
+    //! Number of columns in #m_table
+    size_t m_tab_width;
+
+    //! Table of species properties, with #m_tab_width values for each
+    //! temperature, ordered as in evalPropertyFits()
+    vector_fp m_table;
+
+    //! Log of the lowest temperature in #m_table
+    double m_tab_logtmin;
+
+    //! Spacing of the temperatures in #m_table, in log(T)
+    double m_tab_dlogt;
+
+    //! First row of #m_table used for interpolation at the current
+    //! temperature
+    size_t m_tab_j0;
+
+    //! Interpolation weights at the current temperature
+    double m_tab_w[4];
+
+    //! Work array for the interpolated binary diffusion coefficients
+    vector_fp m_tab_work;
+
+    //! @}
+
     //! Vector of species mole fractions. These are processed so that all mole
     //! fractions are >= *Tiny*. Length = m_kk.
     vector_fp m_molefracs;
@@ -251,6 +555,9 @@ protected:
     //! Update boolean for the binary diffusivities at unit pressure
     bool m_bindiff_ok;
 
+    //! Update boolean for #m_bdiff_rinv
+    bool m_bdiff_rinv_ok;
+
     //! Type of the polynomial fits to temperature. CK_Mode means Chemkin mode.
     //! Currently CA_Mode is used which are different types of fits to temperature.
     int m_mode;
@@ -338,6 +645,14 @@ protected:
     //! the current temperature Size is nsp x nsp.
     DenseMatrix m_bdiff;
 
+    //! Reciprocals of the binary diffusion coefficients at the reference
+    //! pressure and the current temperature, for the species pairs (i, j >=
+    //! i) in the packed order of #m_diffcoeffs. Length nsp*(nsp+1)/2.
+    vector_fp m_bdiff_rinv;
+
+    //! Sums over species computed by updateMixDiffSums(). Length nsp.
+    vector_fp m_diffsum1, m_diffsum2;
+
     //! temperature fits of the heat conduction
     /*!
      *  Dimensions are number of species (nsp) polynomial order of the collision
@@ -480,6 +795,12 @@ protected:
 
     //! Level of verbose printing during initialization
     int m_log_level;
+
+    //! Fits to be used by the next call to init(). See setFits().
+    GasTransportFits m_presetFits;
+
+    //! See fitCacheFile()
+    std::string m_fitCacheFile;
 };
 
 } // namespace Cantera
@@ -99,6 +99,20 @@ public:
      */
     virtual doublereal thermalConductivity();
 
+    //! Mixture thermal conductivities [W/m/K] for `n` states, computed as in
+    //! thermalConductivity()
+    /*!
+     * @param n     Number of states
+     * @param T     Temperatures [K]. Length `n`.
+     * @param X     Mole fractions, with `X[i*m_nsp + k]` for species `k` in
+     *     state `i`. Length `n*m_nsp`.
+     * @param cond  Output thermal conductivities. Length `n`.
+     *
+     * @see GasTransport::getBatchViscosity
+     */
+    void getBatchThermalConductivity(size_t n, const double* T,
+                                     const double* X, double* cond);
+
     //! Get the Electrical mobilities (m^2/V/s).
     /*!
      * This function returns the mobilities. In some formulations this is equal
@@ -32,6 +32,8 @@ public:
      */
     MultiTransport(thermo_t* thermo=0);
 
+    virtual Transport* duplMyselfAsTransport() const;
+
     virtual int model() const {
         if (m_mode == CK_Mode) {
             return CK_Multicomponent;
@@ -113,6 +115,33 @@ public:
 
     virtual void init(ThermoPhase* thermo, int mode=0, int log_level=0);
 
+    //! Reuse the factorization of the L matrix from a previous state
+    /*!
+     * If `reuse` is true, the L matrix equation is solved by iterative
+     * refinement, starting from the previous solution and using the most
+     * recent LU factorization of the L matrix as the preconditioner. A new
+     * factorization is computed only if the iteration fails to reduce the
+     * relative size of the correction below `rtol` within a few iterations.
+     * This is effective when the composition and temperature change only
+     * slightly between evaluations, as they do between neighboring grid
+     * points or successive Newton iterations of a 1D flame. Disabled by
+     * default.
+     */
+    void setLMatrixReuse(bool reuse, double rtol=1e-8) {
+        m_lmatrix_reuse = reuse;
+        m_lmatrix_rtol = rtol;
+    }
+
+    //! Number of LU factorizations of the L matrix computed so far
+    int nLMatrixFactorizations() const {
+        return m_nfactor;
+    }
+
+    //! Number of solutions of the L matrix equation computed so far
+    int nLMatrixSolves() const {
+        return m_nsolve;
+    }
+
 protected:
     //! Update basic temperature-dependent quantities if the temperature has
     //! changed.
@@ -150,11 +179,58 @@ protected:
     doublereal m_lambda;
 
     // L matrix quantities
+
+    //! The blocks of the L matrix for the translational energy equations.
+    //! The L00,00, L00,10, L10,00 and L10,10 blocks occupy the upper-left,
+    //! upper-right, lower-left and lower-right quarters, respectively. After
+    //! solveLMatrixEquation(), the lower-right block contains the Schur
+    //! complement of the L01,01 block. Size is 2*m_nsp x 2*m_nsp.
     DenseMatrix m_Lmatrix;
+
+    //! The columns of the L10,01 block for the species with internal modes,
+    //! in the order of #m_internal. The L01,10 block is the transpose of
+    //! this block.
+    DenseMatrix m_L1001;
+
+    //! The diagonal of the L01,01 block for the species with internal modes,
+    //! in the order of #m_internal. All off-diagonal terms of this block are
+    //! zero.
+    vector_fp m_L0101;
+
+    //! Indices of the species with internal energy modes. The internal
+    //! energy equations for the remaining species are eliminated.
+    std::vector<size_t> m_internal;
+
     SquareMatrix m_aa;
+
+    //! Solution of the L matrix equation, of length 3*m_nsp. The last block
+    //! is zero for species without internal modes.
     vector_fp m_a;
+
+    //! Right hand side of the L matrix equation, of length 3*m_nsp
     vector_fp m_b;
 
+    //! LU factorization of #m_Lmatrix used by the most recent solution of
+    //! the L matrix equation
+    SquareMatrix m_Lfactor;
+
+    //! True if #m_Lfactor holds a valid factorization
+    bool m_lfactor_ok;
+
+    //! See setLMatrixReuse()
+    bool m_lmatrix_reuse;
+
+    //! Relative tolerance for iterative refinement. See setLMatrixReuse()
+    double m_lmatrix_rtol;
+
+    //! Counters for nLMatrixFactorizations() and nLMatrixSolves()
+    int m_nfactor, m_nsolve;
+
+    //! Work arrays for the reduced L matrix equation. #m_lrhs and #m_lresid
+    //! have length 2*m_nsp, and #m_lwork holds a matrix of the same size as
+    //! #m_L1001.
+    vector_fp m_lrhs, m_lresid, m_lwork;
+
     // work space
     vector_fp m_spwork1, m_spwork2, m_spwork3;
 
@@ -175,21 +251,34 @@ protected:
      */
     void eval_L0000(const doublereal* const x);
 
-    //! Evaluate the L0010 matrices
+    //! Evaluate the L0010 and L1000 matrices
     /*!
+     *  The L10,00 block is the transpose of the L00,10 block, and both are
+     *  evaluated together.
      *  @param x vector of species mole fractions
      */
     void eval_L0010(const doublereal* const x);
 
-    //! Evaluate the L1000 matrices
-    void eval_L1000();
-
-    void eval_L0100();
-    void eval_L0001();
+    //! Evaluate the L1010 matrices
+    /*!
+     *  @param x vector of species mole fractions
+     */
     void eval_L1010(const doublereal* x);
+
+    //! Evaluate the columns of the L1001 matrices for the species with
+    //! internal modes
+    /*!
+     *  @param x vector of species mole fractions
+     */
     void eval_L1001(const doublereal* x);
-    void eval_L0110();
+
+    //! Evaluate the diagonal of the L0101 matrices for the species with
+    //! internal modes
+    /*!
+     *  @param x vector of species mole fractions
+     */
     void eval_L0101(const doublereal* x);
+
     bool hasInternalModes(size_t j);
 
     doublereal pressure_ig() {
@@ -197,6 +286,11 @@ protected:
     }
 
     virtual void solveLMatrixEquation();
+
+    //! Update the solution of the reduced L matrix equation in #m_a by
+    //! iterative refinement using the factorization in #m_Lfactor. Returns
+    //! true if the iteration converged. See setLMatrixReuse().
+    bool refineLMatrixSolution();
     DenseMatrix incl;
     bool m_debug;
 };
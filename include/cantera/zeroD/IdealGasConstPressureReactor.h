@@ -39,6 +39,11 @@ public:
 
     virtual void updateState(doublereal* y);
 
+    virtual bool hasChemistryJacobian() const {
+        return true;
+    }
+    virtual void addChemistryJacobian(double* jac, size_t ld, size_t start);
+
     //! Return the index in the solution vector for this reactor of the
     //! component named *nm*. Possible values for *nm* are "mass",
     //! "temperature", the name of a homogeneous phase species, or the name of a
@@ -7,10 +7,13 @@
 
 #include "ReactorBase.h"
 #include "cantera/kinetics/Kinetics.h"
+#include "cantera/numerics/SparseMatrix.h"
 
 namespace Cantera
 {
 
+class GeneralSpeciesThermo;
+
 /**
  * Class Reactor is a general-purpose class for stirred reactors. The reactor
  * may have an arbitrary number of inlets and outlets, each of which may be
@@ -64,6 +67,7 @@ public:
     //! Disable changes in reactor composition due to chemical reactions.
     void disableChemistry() {
         m_chem = false;
+        std::fill(m_wdot.begin(), m_wdot.end(), 0.0);
     }
 
     //! Enable changes in reactor composition due to chemical reactions.
@@ -71,6 +75,12 @@ public:
         m_chem = true;
     }
 
+    //! True if changes in the reactor composition due to chemical reactions
+    //! are enabled.
+    bool chemistryEnabled() const {
+        return m_chem;
+    }
+
     //! Set the energy equation on or off.
     void setEnergy(int eflag = 1) {
         if (eflag > 0) {
@@ -152,6 +162,63 @@ public:
     //! surface species.
     virtual size_t componentIndex(const std::string& nm) const;
 
+    //! Get the sparsity pattern of the approximate Jacobian computed by
+    //! evalJacobianElements().
+    /*!
+     *  @param[out] pattern (row, column) indices of the entries of the
+     *      Jacobian are appended to this vector
+     *  @param[in] start Index of the first state variable of this reactor in
+     *      the global state vector
+     */
+    virtual void getJacobianPattern(
+        std::vector<std::pair<size_t, size_t> >& pattern, size_t start);
+
+    //! Add the elements of an approximate Jacobian of the governing equations
+    //! to the matrix *jac*, which must include the pattern returned by
+    //! getJacobianPattern().
+    /*!
+     *  Only the dependence of the species equations on the species mass
+     *  fractions due to homogeneous reactions at constant temperature and
+     *  density is included. This captures the stiff part of the system, and
+     *  is used to construct preconditioners for iterative linear solvers.
+     *  The state of the reactor should have been set by updateState().
+     *
+     *  @param[in,out] jac Jacobian for the global state vector
+     *  @param[in] start Index of the first state variable of this reactor in
+     *      the global state vector
+     */
+    virtual void evalJacobianElements(SparseMatrix& jac, size_t start);
+
+    //! True if addChemistryJacobian() is implemented for this type of
+    //! reactor.
+    virtual bool hasChemistryJacobian() const {
+        return false;
+    }
+
+    //! Add the derivatives of the homogeneous reaction terms of the governing
+    //! equations with respect to the state variables of this reactor to the
+    //! dense matrix *jac*.
+    /*!
+     *  The derivatives of the production rates with respect to the species
+     *  concentrations and the temperature are provided by
+     *  Kinetics::getNetProductionRates_ddC() and
+     *  Kinetics::getNetProductionRates_ddT(), and are combined with the
+     *  derivatives of the concentrations and of the thermodynamic properties
+     *  with respect to the state variables. Used by
+     *  ReactorNet::evalJacobian(), which computes the remaining terms by
+     *  finite differences with the chemistry disabled. The state of the
+     *  reactor should have been set by updateState().
+     *
+     *  @param[in,out] jac Jacobian for the global state vector, in
+     *      column-major order
+     *  @param[in] ld Leading dimension of *jac*
+     *  @param[in] start Index of the first state variable of this reactor in
+     *      the global state vector
+     */
+    virtual void addChemistryJacobian(double* jac, size_t ld, size_t start) {
+        throw NotImplementedError("Reactor::addChemistryJacobian");
+    }
+
 protected:
     //! Set reaction rate multipliers based on the sensitivity variables in
     //! *params*.
@@ -165,6 +232,14 @@ protected:
     //! specific reactor implementations.
     virtual size_t speciesIndex(const std::string& nm) const;
 
+    //! Evaluate the species production rates and their derivatives with
+    //! respect to the species concentrations and temperature, which are
+    //! stored in #m_wdot, #m_wdot_ddC and #m_wdot_ddT. Also evaluates the
+    //! concentrations (#m_conc), the partial molar heat capacities (#m_cpk)
+    //! and the sums \f$ \sum_j C_j \partial \dot{\omega}_k / \partial C_j
+    //! \f$ (#m_dwdot_dlnc). Used to implement addChemistryJacobian().
+    void evalChemistryDerivatives();
+
     //! Evaluate terms related to Walls. Calculates #m_vdot and #m_Q based on
     //! wall movement and heat transfer.
     //! @param t     the current time
@@ -183,6 +258,23 @@ protected:
     //! Get initial conditions for SurfPhase objects attached to this reactor
     virtual void getSurfaceInitialConditions(double* y);
 
+    //! Set up the data used by idealGasTemperature(). Called by initialize().
+    void setupIdealGasTemperature();
+
+    //! Find the temperature at which the specific internal energy of the
+    //! contents, at the current composition, is *u* [J/kg].
+    /*!
+     * Used by updateState() if the contents are an ideal gas and the
+     * thermodynamic properties of all species are given by NASA polynomials.
+     * The polynomials are first summed over the species, weighted by the
+     * moles per unit mass of each species, giving one polynomial for each
+     * temperature range. Each Newton iteration then evaluates the internal
+     * energy and heat capacity of the mixture from these polynomials, without
+     * setting the state of the ThermoPhase object or evaluating the
+     * properties of each species.
+     */
+    double idealGasTemperature(double u);
+
     //! Pointer to the homogeneous Kinetics object that handles the reactions
     Kinetics* m_kin;
 
@@ -196,6 +288,29 @@ protected:
 
     vector_fp m_wdot; //!< Species net molar production rates
     vector_fp m_uk; //!< Species molar internal energies
+
+    //! Species thermo manager of the contents, which holds the NASA
+    //! polynomial coefficients of all species. 0 if idealGasTemperature() is
+    //! not used.
+    const GeneralSpeciesThermo* m_nasaThermo;
+
+    //! Indices of the species, grouped by midpoint temperature
+    std::vector<size_t> m_nasaSpecies;
+
+    //! Position of each species of #m_nasaSpecies in the coefficient arrays
+    //! of #m_nasaThermo
+    std::vector<size_t> m_nasaIndex;
+
+    //! Distinct midpoint temperatures of the NASA polynomials
+    vector_fp m_nasaTmid;
+
+    //! The species with midpoint temperature `m_nasaTmid[g]` are those from
+    //! `m_nasaStart[g]` to `m_nasaStart[g+1]-1` in #m_nasaSpecies
+    std::vector<size_t> m_nasaStart;
+
+    //! Mixture polynomial coefficients for each midpoint temperature, for
+    //! the high and low temperature ranges. Length 12 * m_nasaTmid.size().
+    vector_fp m_nasaMix;
     bool m_chem;
     bool m_energy;
     size_t m_nv;
@@ -204,6 +319,17 @@ protected:
     std::vector<size_t> m_pnum;
     std::vector<size_t> m_nsens_wall;
     vector_fp m_mult_save;
+
+    //! Derivatives of the species production rates with respect to the
+    //! species concentrations
+    SparseMatrix m_wdot_ddC;
+
+    //! Derivatives of the species production rates with respect to
+    //! temperature
+    vector_fp m_wdot_ddT;
+
+    //! Work arrays of length m_nsp used by addChemistryJacobian()
+    vector_fp m_conc, m_cpk, m_dwdot_dlnc;
 };
 }
 
@@ -0,0 +1,233 @@
+//! @file ReactorISAT.h
+
+#ifndef CT_REACTORISAT_H
+#define CT_REACTORISAT_H
+
+#include "cantera/zeroD/IdealGasConstPressureReactor.h"
+#include "cantera/zeroD/ReactorNet.h"
+
+#include <list>
+
+namespace Cantera
+{
+
+//! In-situ adaptive tabulation (ISAT) of the reaction mapping of a constant
+//! pressure ideal gas reactor.
+/*!
+ *  The reaction mapping takes the composition `x = (T, Y_1, ..., Y_K)` of
+ *  an adiabatic constant pressure reactor to the composition after a fixed
+ *  time step. This is the operation required for each cell of an operator
+ *  split reacting flow calculation, where the same mapping is evaluated many
+ *  times for very similar states.
+ *
+ *  Each record in the table stores a composition `x0`, the mapping `x1` of
+ *  `x0`, the gradient `A` of the mapping and an ellipsoid of accuracy (EOA)
+ *  `{x : (x - x0)^T M (x - x0) <= 1}`, within which the linear approximation
+ *  `x1 + A (x - x0)` is assumed to be accurate to within the tolerance. The
+ *  errors are measured with the 2-norm of the scaled compositions, where the
+ *  temperature is divided by a reference temperature and the mass fractions
+ *  are not scaled. For each query, advance():
+ *
+ *   - finds a record by descending a binary tree, where each node stores
+ *     the plane bisecting the compositions of two records;
+ *   - returns the linear approximation if the query is inside the EOA of
+ *     that record (*retrieval*);
+ *   - otherwise, integrates the reactor directly. If the linear
+ *     approximation is still accurate, the EOA is enlarged to include the
+ *     query (*growth*), and if not, a new record is added (*addition*). The
+ *     gradient for a new record is computed with forward differences, which
+ *     requires one additional integration per component.
+ *
+ *  The memory used by the table is limited by setMemoryLimit(). When the
+ *  limit is reached, the least recently used record is removed before a new
+ *  record is added.
+ *
+ *  The records are only valid for one time step and pressure, and the table
+ *  is cleared if either of these is changed.
+ *
+ *  @code
+ *  ReactorISAT isat(gas, kin);
+ *  isat.setTimeStep(1e-5);
+ *  isat.setTolerance(1e-4);
+ *  for (size_t i = 0; i < nCells; i++) {
+ *      gas.setState_TPY(T[i], P, &Y[i*nsp]);
+ *      isat.advance();
+ *      T[i] = gas.temperature();
+ *      gas.getMassFractions(&Y[i*nsp]);
+ *  }
+ *  @endcode
+ *
+ *  @ingroup reactor0
+ */
+class ReactorISAT
+{
+public:
+    //! @param thermo  Ideal gas phase used as the reactor contents. The state
+    //!     of this phase is the input and output of advance().
+    //! @param kin  Kinetics manager for the single phase `thermo`
+    ReactorISAT(ThermoPhase& thermo, Kinetics& kin);
+
+    virtual ~ReactorISAT() {}
+
+    //! Set the time step of the reaction mapping. Clears the table if the
+    //! time step is changed.
+    void setTimeStep(double dt);
+
+    //! Set the error tolerance of the tabulated mapping
+    void setTolerance(double tol) {
+        m_tol = tol;
+    }
+
+    //! Set the reference temperature [K] used to scale the temperature. The
+    //! default is 1000 K. Clears the table.
+    void setTemperatureScale(double Tscale);
+
+    //! Set the maximum length of the semi-axes of the initial EOA of each
+    //! record, in scaled units. The default is 0.01.
+    void setMaxRadius(double r) {
+        m_maxRadius = r;
+    }
+
+    //! Set the relative and absolute tolerances of the direct integrations
+    void setIntegratorTolerances(double rtol, double atol) {
+        m_net.setTolerances(rtol, atol);
+    }
+
+    //! Set the maximum memory [bytes] used by the records of the table. The
+    //! default is 100 MB.
+    void setMemoryLimit(size_t bytes) {
+        m_memoryLimit = bytes;
+    }
+
+    //! Advance the state of the phase by one time step at constant pressure
+    //! and enthalpy.
+    void advance();
+
+    //! Remove all of the records from the table. The counters are not reset.
+    void clear();
+
+    //! @name Statistics
+    //! @{
+
+    //! Number of records in the table
+    size_t nRecords() const {
+        return m_nRecords;
+    }
+
+    //! Approximate memory [bytes] used by the records
+    size_t memoryUsage() const {
+        return m_nRecords * recordSize();
+    }
+
+    //! Number of queries answered by retrieval
+    size_t nRetrieved() const {
+        return m_nRetrieved;
+    }
+
+    //! Number of queries which required a direct integration, i.e. the sum
+    //! of nGrown() and nAdded()
+    size_t nDirect() const {
+        return m_nGrown + m_nAdded;
+    }
+
+    //! Number of queries answered by growing the EOA of a record
+    size_t nGrown() const {
+        return m_nGrown;
+    }
+
+    //! Number of records added
+    size_t nAdded() const {
+        return m_nAdded;
+    }
+
+    //! Number of records removed because of the memory limit
+    size_t nEvicted() const {
+        return m_nEvicted;
+    }
+
+    //! Reset all of the counters to zero
+    void resetCounters() {
+        m_nRetrieved = m_nGrown = m_nAdded = m_nEvicted = 0;
+    }
+    //! @}
+
+protected:
+    //! Compute the reaction mapping of the scaled composition `z0`, and
+    //! store the result in `z`. Integrates the reactor directly.
+    virtual void integrate(const double* z0, double* z);
+
+    //! Compute the mapping `z1` of `z0` and its gradient `A`, stored in
+    //! column-major order.
+    void mappingGradient(const double* z0, const double* z1, double* A);
+
+    //! Index of the record reached by descending the tree from the root
+    size_t findLeaf(const double* z) const;
+
+    //! Add a record for the composition `z0`, with the mapping `z1`
+    void addRecord(const double* z0, const double* z1);
+
+    //! Remove the least recently used record
+    void evict();
+
+    //! Mark record `r` as the most recently used
+    void touch(size_t r);
+
+    //! Approximate memory used by one record
+    size_t recordSize() const;
+
+    //! A tabulated mapping
+    struct Record {
+        vector_fp z0; //!< Scaled composition
+        vector_fp z1; //!< Scaled mapping of z0
+        vector_fp A; //!< Gradient of the mapping (column-major)
+        vector_fp M; //!< Matrix defining the EOA (column-major)
+        int parent; //!< Index of the parent node, or -1 for the root
+        std::list<size_t>::iterator lru; //!< Position in #m_lru
+    };
+
+    //! A node of the binary tree, splitting the compositions with the plane
+    //! `v^T z = a`. Children with `v^T z > a` are on the right. Children are
+    //! encoded as node indices if non-negative and as `-1 - r` for record
+    //! `r`.
+    struct Node {
+        vector_fp v;
+        double a;
+        int left;
+        int right;
+        int parent; //!< Index of the parent node, or -1 for the root
+    };
+
+    //! Set the child `oldChild` of node `parent` (or the root, if `parent`
+    //! is -1) to `newChild`, and update the parent of `newChild`.
+    void replaceChild(int parent, int oldChild, int newChild);
+
+    ThermoPhase& m_thermo;
+    IdealGasConstPressureReactor m_reactor;
+    ReactorNet m_net;
+
+    size_t m_nv; //!< Number of components of the composition (K + 1)
+    double m_dt; //!< Time step
+    double m_pressure; //!< Pressure for which the records are valid
+    double m_Tscale; //!< Reference temperature for scaling
+    double m_tol; //!< Error tolerance
+    double m_maxRadius; //!< Maximum semi-axis of the initial EOAs
+    size_t m_memoryLimit; //!< Maximum memory used by the records
+
+    std::vector<Record> m_records;
+    std::vector<Node> m_nodes;
+    std::vector<size_t> m_freeRecords, m_freeNodes;
+    int m_root; //!< Root of the tree, using the encoding of Node children
+    size_t m_nRecords;
+
+    //! Record indices, from the most to the least recently used
+    std::list<size_t> m_lru;
+
+    size_t m_nRetrieved, m_nGrown, m_nAdded, m_nEvicted;
+
+    //! Work arrays of length #m_nv
+    vector_fp m_z, m_zout, m_work;
+};
+
+}
+
+#endif
@@ -8,6 +8,7 @@
 #include "Reactor.h"
 #include "cantera/numerics/FuncEval.h"
 #include "cantera/numerics/Integrator.h"
+#include "cantera/numerics/PreconditionerBase.h"
 #include "cantera/base/Array.h"
 
 namespace Cantera
@@ -71,6 +72,35 @@ public:
         m_init = false;
     }
 
+    //! Set the type of linear solver used by the integrator.
+    /*!
+     *  @param type  Either "DENSE" (the default), which uses a direct solver
+     *      with a finite difference approximation of the full Jacobian, or
+     *      "GMRES", which uses a preconditioned iterative solver. The
+     *      preconditioner is constructed from the sparse Jacobian of the
+     *      species equations provided by Reactor::evalJacobianElements(),
+     *      which requires a Kinetics object that implements
+     *      Kinetics::getNetProductionRates_ddC(). For large mechanisms,
+     *      "GMRES" avoids the dense factorization of the Jacobian.
+     *      "DENSE_ANALYTIC" uses a direct solver with the Jacobian evaluated
+     *      by evalJacobian(double, double*, double*, double*, double*),
+     *      where the derivatives of the reaction terms are computed from
+     *      the analytic derivatives of the production rates.
+     */
+    void setLinearSolverType(const std::string& type);
+
+    //! The type of linear solver used by the integrator
+    const std::string& linearSolverType() const {
+        return m_linearSolverType;
+    }
+
+    //! Set the preconditioner used by the "GMRES" linear solver. If no
+    //! preconditioner is set, a SparseLUPreconditioner is used.
+    void setPreconditioner(shared_ptr<PreconditionerBase> precon) {
+        m_precon = precon;
+        m_init = false;
+    }
+
     //! Current value of the simulation time.
     doublereal time() {
         return m_time;
@@ -183,6 +213,29 @@ public:
     void evalJacobian(doublereal t, doublereal* y,
                       doublereal* ydot, doublereal* p, Array2D* j);
 
+    //! Evaluate the Jacobian matrix for the reactor network, using the
+    //! analytic derivatives of the homogeneous reaction terms where they are
+    //! available.
+    /*!
+     *  For reactors which implement Reactor::addChemistryJacobian(), the
+     *  derivatives of the reaction terms are computed from the derivatives
+     *  of the species production rates provided by the Kinetics object. The
+     *  remaining terms, which include the terms for walls, flow devices and
+     *  surface reactions, are computed by finite differences of eval() with
+     *  the homogeneous chemistry of these reactors disabled. This avoids
+     *  evaluating the reaction rates once for each state variable. The
+     *  sensitivity parameters are not applied to the analytic terms.
+     *
+     *  @param[in] t Time at which to evaluate the Jacobian
+     *  @param[in] y Global state vector at time *t*
+     *  @param[in] ydot Time derivative of the state vector at *t* (unused)
+     *  @param[in] p sensitivity parameter vector
+     *  @param[out] jac Jacobian matrix in column-major order, size neq() by
+     *      neq().
+     */
+    virtual void evalJacobian(double t, double* y, double* ydot, double* p,
+                              double* jac);
+
     // overloaded methods of class FuncEval
     virtual size_t neq() {
         return m_nv;
@@ -199,6 +252,10 @@ public:
         return m_ntotpar;
     }
 
+    virtual void preconditionerSetup(double t, double* y, double gamma,
+                                     bool reuseJacobian);
+    virtual void preconditionerSolve(const double* rhs, double* x);
+
     //! Return the index corresponding to the component named *component* in the
     //! reactor with index *reactor* in the global state vector for the
     //! reactor network.
@@ -267,6 +324,20 @@ protected:
     std::vector<size_t> m_sensIndex;
 
     vector_fp m_ydot;
+
+    //! Type of linear solver used by the integrator
+    std::string m_linearSolverType;
+
+    //! Preconditioner used with the iterative linear solver
+    shared_ptr<PreconditionerBase> m_precon;
+
+    //! Approximate Jacobian used to construct the preconditioner
+    SparseMatrix m_jac;
+
+    //! Time derivative of the state vector evaluated without the homogeneous
+    //! reaction terms of the reactors which implement
+    //! Reactor::addChemistryJacobian(). Used by evalJacobian().
+    vector_fp m_ydot_nochem;
 };
 }
 
@@ -0,0 +1,145 @@
+//! @file ReactorSweep.h
+
+#ifndef CT_REACTORSWEEP_H
+#define CT_REACTORSWEEP_H
+
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/base/ThreadPool.h"
+
+namespace Cantera
+{
+
+//! Integrate a set of independent reactors in parallel.
+/*!
+ *  Each case added with addCase() is a closed reactor with its own initial
+ *  state, which is integrated with a separate ReactorNet from time zero to a
+ *  specified end time. This is the typical pattern for parameter sweeps such
+ *  as ignition delay maps, where each integration is independent of all of
+ *  the others.
+ *
+ *  The cases are distributed over a ThreadPool, which balances the load when
+ *  the cost of the integrations is very different. Each worker thread uses
+ *  its own copies of the ThermoPhase and Kinetics objects passed to the
+ *  constructor, which are created with ThermoPhase::duplMyselfAsThermoPhase()
+ *  and Kinetics::duplMyselfAsKinetics(). The result of each case is stored by
+ *  its index, and does not depend on the number of threads or on which thread
+ *  evaluated it.
+ *
+ *  ### Thread safety
+ *
+ *  Apart from the per-thread copies of the phase and kinetics objects, the
+ *  integrations share the following state:
+ *   - Reaction and Falloff objects, which are shared by the copies of the
+ *     Kinetics object through `shared_ptr` and are only read while
+ *     evaluating rates.
+ *   - The Application singleton, where the data directories, the XML file
+ *     cache and the deprecation warning list are protected by mutexes, and
+ *     the log messages are stored per thread.
+ *   - The factory singletons (ReactorFactory etc.), which are protected by
+ *     mutexes.
+ *
+ *  The objects passed to the constructor are only read, by the thread calling
+ *  run(), and must not be modified while run() is in progress.
+ *
+ *  @code
+ *  ReactorSweep sweep(gas, kin);
+ *  for (size_t i = 0; i < T0.size(); i++) {
+ *      gas.setState_TPX(T0[i], OneAtm, "CH4:1, O2:2, N2:7.52");
+ *      sweep.addCase(gas.temperature(), gas.pressure(),
+ *                    gas.massFractions(), 0.1);
+ *  }
+ *  sweep.run();
+ *  double T_end = sweep.temperature(0);
+ *  @endcode
+ *
+ *  @ingroup reactor0
+ */
+class ReactorSweep
+{
+public:
+    //! @param thermo  Phase used as the prototype for the reactor contents
+    //! @param kin  Kinetics manager for the single phase `thermo`
+    ReactorSweep(ThermoPhase& thermo, Kinetics& kin);
+
+    //! Set the type of reactor used for each case, as understood by
+    //! newReactor(). The default is "IdealGasReactor".
+    void setReactorType(const std::string& type) {
+        m_reactorType = type;
+    }
+
+    //! Set the relative and absolute tolerances used by each ReactorNet
+    void setTolerances(double rtol, double atol) {
+        m_rtol = rtol;
+        m_atol = atol;
+    }
+
+    //! Set the number of threads used by run(). If `n` is zero, the number
+    //! of hardware threads is used.
+    void setNumThreads(size_t n) {
+        if (n != m_nThreads) {
+            m_nThreads = n;
+            m_pool.reset();
+        }
+    }
+
+    //! Add a case starting from the state (`T`, `P`, `Y`) and integrated until
+    //! time `tEnd`. Returns the index of the case.
+    size_t addCase(double T, double P, const double* Y, double tEnd);
+
+    //! Number of cases
+    size_t nCases() const {
+        return m_tEnd.size();
+    }
+
+    //! Remove all cases and results
+    void clear();
+
+    //! Integrate all of the cases. If any of the integrations fail, the
+    //! exception raised for the failed case with the lowest index is rethrown
+    //! after all of the other cases have been completed.
+    void run();
+
+    //! @name Results
+    //! Final state of case `i` after calling run(). These are NaN if the
+    //! integration of case `i` failed.
+    //! @{
+    double temperature(size_t i) const;
+    double pressure(size_t i) const;
+    void getMassFractions(size_t i, double* Y) const;
+    //! @}
+
+protected:
+    //! Integrate case `i` using the objects belonging to worker `w`
+    void integrate(size_t i, size_t w);
+
+    //! Copies of the phase and kinetics objects owned by one worker
+    struct Worker {
+        std::unique_ptr<ThermoPhase> thermo;
+        std::unique_ptr<Kinetics> kin;
+    };
+
+    ThermoPhase& m_thermo;
+    Kinetics& m_kin;
+    size_t m_nsp;
+
+    std::string m_reactorType;
+    double m_rtol;
+    double m_atol;
+    size_t m_nThreads;
+
+    std::unique_ptr<ThreadPool> m_pool;
+    std::vector<Worker> m_workers;
+
+    //! Initial state of each case. The mass fractions for case `i` start at
+    //! `m_Y0[i*m_nsp]`.
+    vector_fp m_T0, m_P0, m_Y0, m_tEnd;
+
+    //! Final state of each case, using the same layout as the initial state.
+    //! Set to NaN for cases which have not been integrated.
+    vector_fp m_T, m_P, m_Y;
+};
+
+}
+
+#endif
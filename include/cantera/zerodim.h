@@ -9,5 +9,7 @@
 #include "zeroD/ConstPressureReactor.h"
 #include "zeroD/IdealGasReactor.h"
 #include "zeroD/IdealGasConstPressureReactor.h"
+#include "zeroD/ReactorSweep.h"
+#include "zeroD/ReactorISAT.h"
 
 #endif
@@ -557,6 +557,8 @@ cdef extern from "cantera/zeroD/ReactorNet.h":
         double atol()
         void setMaxTimeStep(double)
         void setMaxErrTestFails(int)
+        void setLinearSolverType(string&) except +
+        string linearSolverType()
         cbool verbose()
         void setVerbose(cbool)
         size_t neq()
@@ -662,6 +664,8 @@ cdef extern from "cantera/oneD/StFlow.h":
         cbool doEnergy(size_t)
         void enableSoret(cbool)
         cbool withSoret()
+        void setNumThreads(size_t) except +
+        size_t numThreads()
 
     cdef cppclass CxxFreeFlame "Cantera::FreeFlame":
         CxxFreeFlame(CxxIdealGasPhase*, int, int)
@@ -691,6 +695,18 @@ cdef extern from "cantera/oneD/Sim1D.h":
         double workValue(size_t, size_t, size_t) except +
         void eval(double, int) except +
         void setJacAge(int, int)
+        void setAdaptiveJacobian(cbool, double)
+        vector[size_t]& gridSizeStats()
+        vector[int]& evalCountStats()
+        vector[double]& evalTimeStats()
+        vector[int]& jacobianCountStats()
+        vector[double]& jacobianTimeStats()
+        vector[double]& factorTimeStats()
+        vector[double]& solveTimeStats()
+        vector[int]& newtonStepStats()
+        vector[int]& timeStepStats()
+        vector[double]& timeStepTimeStats()
+        vector[double]& refineTimeStats()
         void setTimeStepFactor(double)
         void setMinTimeStep(double)
         void setMaxTimeStep(double)
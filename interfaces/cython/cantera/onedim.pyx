@@ -399,6 +399,18 @@ cdef class _FlowBase(Domain1D):
         def __set__(self, do_radiation):
             self.flow.enableRadiation(<cbool>do_radiation)
 
+    property num_threads:
+        """
+        Number of threads used to evaluate the properties at the grid points
+        when computing the residual. Each thread uses its own copies of the
+        phase, kinetics, and transport objects. Setting this to 0 uses the
+        number of hardware threads.
+        """
+        def __get__(self):
+            return self.flow.numThreads()
+        def __set__(self, n):
+            self.flow.setNumThreads(n)
+
 
 cdef CxxIdealGasPhase* getIdealGasPhase(ThermoPhase phase) except *:
     if phase.thermo.eosType() != thermo_type_ideal_gas:
@@ -736,6 +748,21 @@ cdef class Sim1D:
         """
         self.sim.setJacAge(ss_age, ts_age)
 
+    def set_adaptive_jacobian(self, adaptive=True, max_rate=0.5):
+        """
+        Use the rate of convergence of the Newton iteration to decide when
+        the Jacobian should be re-evaluated.
+
+        :param adaptive:
+            If `True`, the Jacobian is reused beyond the maximum age set with
+            `set_max_jac_age` as long as the ratio of the norms of successive
+            Newton steps is less than *max_rate*, and it is re-evaluated as
+            soon as this ratio exceeds *max_rate*.
+        :param max_rate:
+            maximum convergence rate for reusing the Jacobian
+        """
+        self.sim.setAdaptiveJacobian(adaptive, max_rate)
+
     def set_time_step_factor(self, tfactor):
         """
         Set the factor by which the time step will be increased after a
@@ -808,5 +835,23 @@ cdef class Sim1D:
         """
         self.sim.clearStats()
 
+    property solver_stats:
+        """
+        Solver statistics for each grid used since the statistics were last
+        cleared, as a dict of lists. Wall clock times are in seconds.
+        """
+        def __get__(self):
+            return {'grid_size': self.sim.gridSizeStats(),
+                    'eval_count': self.sim.evalCountStats(),
+                    'eval_time': self.sim.evalTimeStats(),
+                    'jacobian_count': self.sim.jacobianCountStats(),
+                    'jacobian_time': self.sim.jacobianTimeStats(),
+                    'factor_time': self.sim.factorTimeStats(),
+                    'solve_time': self.sim.solveTimeStats(),
+                    'newton_steps': self.sim.newtonStepStats(),
+                    'time_steps': self.sim.timeStepStats(),
+                    'time_step_time': self.sim.timeStepTimeStats(),
+                    'refine_time': self.sim.refineTimeStats()}
+
     def __dealloc__(self):
         del self.sim
@@ -852,6 +852,20 @@ cdef class ReactorNet:
         def __set__(self, n):
             self.net.setMaxErrTestFails(n)
 
+    property linear_solver_type:
+        """
+        The type of linear solver used by the integrator. One of ``'DENSE'``
+        (the default); ``'DENSE_ANALYTIC'``, a dense solver using the analytic
+        Jacobian of the reaction terms for ideal gas reactors; or ``'GMRES'``,
+        an iterative solver preconditioned using the sparse Jacobian of the
+        species equations, which is more efficient for large reaction
+        mechanisms.
+        """
+        def __get__(self):
+            return pystr(self.net.linearSolverType())
+        def __set__(self, solver_type):
+            self.net.setLinearSolverType(stringify(solver_type))
+
     property rtol:
         """
         The relative error tolerance used while integrating the reactor
@@ -186,6 +186,53 @@ class TestFreeFlame(utilities.CanteraTest):
         for rhou_j in self.sim.density * self.sim.u:
             self.assertNear(rhou_j, rhou, 1e-4)
 
+    def test_parallel_eval(self):
+        # Evaluating the residual in parallel should give exactly the same
+        # solution as the serial evaluation
+        reactants = 'H2:1.1, O2:1, AR:5.3'
+        p = ct.one_atm
+        Tin = 300
+
+        solutions = []
+        for n in (1, 4):
+            self.create_sim(p, Tin, reactants)
+            self.sim.flame.num_threads = n
+            self.assertEqual(self.sim.flame.num_threads, n)
+            self.solve_fixed_T()
+            self.solve_mix(ratio=5, slope=0.5, curve=0.3)
+            self.solve_multi()
+            solutions.append((self.sim.grid, self.sim.T, self.sim.u, self.sim.Y))
+
+        for serial, parallel in zip(*solutions):
+            self.assertArrayNear(serial, parallel, 1e-14, 1e-30)
+
+    def test_adaptive_jacobian(self):
+        reactants = 'H2:1.1, O2:1, AR:5.3'
+        p = ct.one_atm
+        Tin = 300
+
+        Su = []
+        for adaptive in (False, True):
+            self.create_sim(p, Tin, reactants)
+            self.sim.set_adaptive_jacobian(adaptive)
+            self.solve_fixed_T()
+            self.solve_mix(ratio=5, slope=0.5, curve=0.3)
+            Su.append(self.sim.u[0])
+
+            stats = self.sim.solver_stats
+            ngrids = len(stats['grid_size'])
+            self.assertGreater(ngrids, 1)
+            for key, values in stats.items():
+                self.assertEqual(len(values), ngrids)
+            self.assertGreater(sum(stats['newton_steps']), 0)
+            self.assertGreater(sum(stats['jacobian_count']), 0)
+
+            self.sim.clear_stats()
+            for key, values in self.sim.solver_stats.items():
+                self.assertEqual(len(values), 0, key)
+
+        self.assertNear(Su[0], Su[1], 1e-4)
+
     # @utilities.unittest.skip('sometimes slow')
     def test_multicomponent(self):
         reactants= 'H2:1.1, O2:1, AR:5.3'
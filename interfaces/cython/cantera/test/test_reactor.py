@@ -662,6 +662,27 @@ class TestWellStirredReactorIgnition(utilities.CanteraTest):
         # regression test; no external basis for this result
         self.assertNear(tIg, 1.4856, 1e-3)
 
+    def test_ignition_gmres(self):
+        self.setup(900.0, 10*ct.one_atm, 1.0, 5.0)
+        self.assertEqual(self.net.linear_solver_type, 'DENSE')
+        self.net.linear_solver_type = 'GMRES'
+        self.assertEqual(self.net.linear_solver_type, 'GMRES')
+        t,T = self.integrate(10.0)
+
+        self.assertTrue(T[-1] > 1200) # mixture ignited
+        for i in range(len(t)):
+            if T[i] > 0.5 * (T[0] + T[-1]):
+                tIg = t[i]
+                break
+
+        # should match the result obtained with the dense linear solver
+        self.assertNear(tIg, 2.2249, 1e-3)
+
+    def test_bad_linear_solver_type(self):
+        self.setup(900.0, 10*ct.one_atm, 1.0, 5.0)
+        with self.assertRaises(ct.CanteraError):
+            self.net.linear_solver_type = 'SPOOLES'
+
     def test_ignition3(self):
         self.setup(900.0, 10*ct.one_atm, 1.0, 80.0)
         self.net.set_max_time_step(0.5)
@@ -0,0 +1,140 @@
+/*
+ * Benchmark of the evaluation of Arrhenius rate coefficients
+ *
+ * Collects the Arrhenius rate expressions of the elementary and three-body
+ * reactions of a mechanism and times the evaluation of all of the rate
+ * coefficients using the grouped, structure-of-arrays Rate1<Arrhenius>
+ * manager and using the scalar path, which calls Arrhenius::updateRC for
+ * each reaction. A second, larger set of rate expressions is formed by
+ * repeating the rate expressions of the mechanism with perturbed parameters,
+ * to show the behavior for mechanisms with thousands of reactions. The time
+ * per evaluation is reported in microseconds.
+ *
+ * Usage: arrhenius_bench [input_file phase_id] [number of repetitions]
+ */
+
+#include "cantera/IdealGasMix.h"
+#include "cantera/kinetics/RateCoeffMgr.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+using namespace Cantera;
+using std::cout;
+using std::endl;
+
+typedef std::chrono::high_resolution_clock Clock;
+
+double elapsed(Clock::time_point t0)
+{
+    return std::chrono::duration<double>(Clock::now() - t0).count();
+}
+
+// Time 'nReps' calls of 'f' and return the time per call in microseconds
+template <class F>
+double timeit(int nReps, F f)
+{
+    Clock::time_point t0 = Clock::now();
+    for (int n = 0; n < nReps; n++) {
+        f();
+    }
+    return 1e6 * elapsed(t0) / nReps;
+}
+
+// Compare the two evaluation methods for the rate expressions 'rates'
+void compare(const std::string& name, const std::vector<Arrhenius>& rates,
+             int nReps)
+{
+    size_t nr = rates.size();
+    Rate1<Arrhenius> mgr;
+    for (size_t i = 0; i < nr; i++) {
+        mgr.install(i, rates[i]);
+    }
+
+    vector_fp k1(nr), k2(nr);
+    double T = 1500.0;
+    double sum = 0.0;
+    double tScalar = timeit(nReps, [&]() {
+        // Vary the temperature slightly so that no work can be hoisted out
+        // of the timing loop
+        T += 1e-6;
+        double logT = std::log(T);
+        double recipT = 1.0 / T;
+        for (size_t i = 0; i < nr; i++) {
+            k1[i] = rates[i].updateRC(logT, recipT);
+        }
+        sum += k1[0];
+    });
+    T = 1500.0;
+    double tGrouped = timeit(nReps, [&]() {
+        T += 1e-6;
+        mgr.update(T, std::log(T), k2.data());
+        sum += k2[0];
+    });
+
+    double maxdiff = 0.0;
+    for (size_t i = 0; i < nr; i++) {
+        maxdiff = std::max(maxdiff, std::abs(k1[i] - k2[i]) /
+                           std::max(std::abs(k1[i]), 1e-300));
+    }
+    cout << name << " (" << nr << " rates)  scalar: " << tScalar
+         << "  grouped: " << tGrouped << "  speedup: " << tScalar / tGrouped
+         << "  max. rel. difference: " << maxdiff << endl;
+    if (sum == 0.0) {
+        cout << endl; // use 'sum' so that the loops are not optimized away
+    }
+}
+
+int arrhenius_bench(const std::string& infile, const std::string& id,
+                    int nReps)
+{
+    IdealGasMix gas(infile, id);
+    std::vector<Arrhenius> rates;
+    for (size_t i = 0; i < gas.nReactions(); i++) {
+        auto R = std::dynamic_pointer_cast<ElementaryReaction>(gas.reaction(i));
+        if (R) {
+            rates.push_back(R->rate);
+        }
+    }
+    if (rates.empty()) {
+        cout << "No Arrhenius reactions in " << infile << endl;
+        return 1;
+    }
+
+    cout << "Time per evaluation of all rate coefficients [us]" << endl;
+    compare(id, rates, nReps);
+
+    // Repeat the rate expressions to form a set of about 10000 rates
+    std::vector<Arrhenius> large;
+    size_t nCopies = 10000 / rates.size() + 1;
+    for (size_t n = 0; n < nCopies; n++) {
+        double f = 1.0 + 0.01 * n;
+        for (const auto& r : rates) {
+            large.emplace_back(f * r.preExponentialFactor(),
+                               r.temperatureExponent(),
+                               f * r.activationEnergy_R());
+        }
+    }
+    compare("large", large, std::max(nReps / (int) nCopies, 1));
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    std::string infile = (argc > 2) ? argv[1] : "gri30.cti";
+    std::string id = (argc > 2) ? argv[2] : "gri30";
+    int nReps = 100000;
+    if (argc == 2 || argc == 4) {
+        nReps = std::atoi(argv[argc - 1]);
+    }
+    try {
+        int retn = arrhenius_bench(infile, id, nReps);
+        appdelete();
+        return retn;
+    } catch (CanteraError& err) {
+        std::cout << err.what() << std::endl;
+        appdelete();
+        return -1;
+    }
+}
@@ -0,0 +1,108 @@
+/*
+ * Benchmark of the linear solvers for the 1D flame Jacobian
+ *
+ * Creates block-tridiagonal matrices with the structure of the Jacobian used
+ * by the 1D flame solver, with one block per grid point and (number of
+ * species + 4) components per point. Each matrix is stored in a BandMatrix
+ * with the same bandwidth as the one used by OneDim and in a BlockTridiagLU,
+ * then factored and solved with the banded LU factorization (LAPACK
+ * DGBTRF/DGBTRS) and with the block-tridiagonal factorization. The time per
+ * factorization and solution, and the number of values stored for the matrix
+ * and its factors, are reported for each number of species.
+ *
+ * Usage: blocktridiag [number of grid points] [number of repetitions]
+ */
+
+#include "cantera/numerics/BandMatrix.h"
+#include "cantera/numerics/BlockTridiagLU.h"
+#include "cantera/base/global.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <cstdio>
+
+using namespace Cantera;
+using std::cout;
+using std::endl;
+
+typedef std::chrono::high_resolution_clock Clock;
+
+double elapsed(Clock::time_point t0)
+{
+    return std::chrono::duration<double>(Clock::now() - t0).count();
+}
+
+int blocktridiag(size_t nPoints, int nReps)
+{
+    cout << "Grid points: " << nPoints << ", repetitions: " << nReps << endl;
+    printf("%8s %12s %12s %12s %12s %12s %12s\n", "species", "band (ms)",
+           "block (ms)", "speedup", "max diff", "band (MB)", "block (MB)");
+    for (size_t nsp : {10, 25, 50, 100, 200}) {
+        size_t nv = nsp + 4;
+        size_t n = nv * nPoints;
+        size_t bw = 2*nv - 1;
+        BandMatrix A(n, bw, bw);
+        BlockTridiagLU lu;
+        lu.setBlockSizes(std::vector<size_t>(nPoints, nv));
+        for (size_t j = 0; j < nPoints; j++) {
+            size_t k0 = (j > 0) ? (j-1) * nv : 0;
+            size_t k1 = std::min(j+2, nPoints) * nv;
+            for (size_t i = j*nv; i < (j+1)*nv; i++) {
+                for (size_t k = k0; k < k1; k++) {
+                    A(i, k) = (i == k) ? 4.0 : 1.0 / (2.0 + (i*7 + k*3) % 11);
+                    lu.value(i, k) = A(i, k);
+                }
+            }
+        }
+        vector_fp b(n);
+        for (size_t i = 0; i < n; i++) {
+            b[i] = 1.0 + (i % 13);
+        }
+
+        vector_fp x1(n), x2(n);
+        Clock::time_point t0 = Clock::now();
+        for (int rep = 0; rep < nReps; rep++) {
+            A(0, 0) = 4.0; // marks the matrix as not factored
+            x1 = b;
+            A.solve(x1.data());
+        }
+        double tBand = elapsed(t0);
+
+        t0 = Clock::now();
+        for (int rep = 0; rep < nReps; rep++) {
+            x2 = b;
+            lu.factor();
+            lu.solve(x2.data());
+        }
+        double tBlock = elapsed(t0);
+
+        double maxDiff = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            maxDiff = std::max(maxDiff, std::abs(x1[i] - x2[i]));
+        }
+        // BandMatrix stores 2*kl + ku + 1 values per column for both the
+        // matrix and its LU factors
+        double bandMB = 2.0 * n * (3*bw + 1) * sizeof(double) / 1e6;
+        double blockMB = lu.nStored() * sizeof(double) / 1e6;
+        printf("%8zu %12.3f %12.3f %12.2f %12.3g %12.1f %12.1f\n", nsp,
+               1000 * tBand / nReps, 1000 * tBlock / nReps, tBand / tBlock,
+               maxDiff, bandMB, blockMB);
+    }
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    size_t nPoints = (argc > 1) ? std::atoi(argv[1]) : 100;
+    int nReps = (argc > 2) ? std::atoi(argv[2]) : 5;
+    try {
+        int retn = blocktridiag(nPoints, nReps);
+        appdelete();
+        return retn;
+    } catch (CanteraError& err) {
+        std::cout << err.what() << std::endl;
+        appdelete();
+        return -1;
+    }
+}
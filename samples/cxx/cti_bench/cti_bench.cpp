@@ -0,0 +1,82 @@
+/*
+ * Benchmark of the conversion of cti input files to CTML
+ *
+ * For each input file, times the conversion by the Python converter
+ * (`ctml_writer`, run in a separate Python process) followed by parsing the
+ * generated XML, and the in-process conversion by ct2ctml_native(). Both
+ * methods produce the XML tree which is used to construct phases from the
+ * input file. The time for each conversion is reported in milliseconds.
+ *
+ * Usage: cti_bench [input files]
+ *
+ * By default, the files gri30.cti, nasa_gas.cti and nasa.cti are converted.
+ */
+
+#include "cantera/base/ctml.h"
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+
+using namespace Cantera;
+using std::cout;
+using std::endl;
+
+typedef std::chrono::high_resolution_clock Clock;
+
+double elapsed(Clock::time_point t0)
+{
+    return std::chrono::duration<double>(Clock::now() - t0).count();
+}
+
+int cti_bench(const std::vector<std::string>& files)
+{
+    cout << "Conversion time [ms]      python      native    speedup" << endl;
+    for (const auto& name : files) {
+        std::string path = findInputFile(name);
+
+        Clock::time_point t0 = Clock::now();
+        XML_Node pyRoot("doc");
+        std::stringstream xml(call_ctml_writer(path, true));
+        pyRoot.build(xml);
+        double tPython = 1e3 * elapsed(t0);
+
+        t0 = Clock::now();
+        XML_Node root("doc");
+        if (!ct2ctml_native(path, root, true)) {
+            cout << name << ": not supported by the native reader" << endl;
+            continue;
+        }
+        double tNative = 1e3 * elapsed(t0);
+
+        size_t nSpecies = root.child("speciesData").getChildren("species").size();
+        size_t nReactions = root.child("reactionData").getChildren("reaction").size();
+        if (pyRoot.child("speciesData").getChildren("species").size() != nSpecies ||
+            pyRoot.child("reactionData").getChildren("reaction").size() != nReactions) {
+            throw CanteraError("cti_bench", "Inconsistent conversion of {}",
+                               name);
+        }
+        cout << name << " (" << nSpecies << " species, " << nReactions
+             << " reactions)" << endl;
+        cout << "                      " << tPython << "  " << tNative
+             << "  " << tPython / tNative << endl;
+    }
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<std::string> files(argv + 1, argv + argc);
+    if (files.empty()) {
+        files = {"gri30.cti", "nasa_gas.cti", "nasa.cti"};
+    }
+    try {
+        int retn = cti_bench(files);
+        appdelete();
+        return retn;
+    } catch (CanteraError& err) {
+        std::cout << err.what() << std::endl;
+        appdelete();
+        return -1;
+    }
+}
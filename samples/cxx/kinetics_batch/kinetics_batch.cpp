@@ -0,0 +1,105 @@
+/*
+ * Benchmark of batched evaluation of species production rates
+ *
+ * Computes the net production rates for a set of gas states ("cells"), such
+ * as those found in a CFD simulation, first by setting the state of the gas
+ * and evaluating the rates for one cell at a time, and then by using the
+ * batched API Kinetics::getBatchNetProductionRates. The throughput of each
+ * method is reported in cells per second.
+ *
+ * Usage: kinetics_batch [number of cells] [number of repetitions]
+ */
+
+#include "cantera/IdealGasMix.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+using namespace Cantera;
+using std::cout;
+using std::endl;
+
+typedef std::chrono::high_resolution_clock Clock;
+
+double elapsed(Clock::time_point t0)
+{
+    return std::chrono::duration<double>(Clock::now() - t0).count();
+}
+
+int kinetics_batch(size_t nCells, int nReps)
+{
+    IdealGasMix gas("gri30.cti", "gri30");
+    size_t nsp = gas.nSpecies();
+
+    // Create a set of states spanning a range of temperatures and
+    // compositions, by mixing unburned and equilibrium states
+    vector_fp T(nCells), P(nCells), Y(nCells*nsp);
+    gas.setState_TPX(300.0, OneAtm, "CH4:1.0, O2:2.0, N2:7.52");
+    gas.equilibrate("HP");
+    vector_fp Yb(nsp);
+    gas.getMassFractions(Yb.data());
+    double Tb = gas.temperature();
+    gas.setState_TPX(300.0, OneAtm, "CH4:1.0, O2:2.0, N2:7.52");
+    vector_fp Yu(nsp);
+    gas.getMassFractions(Yu.data());
+    for (size_t m = 0; m < nCells; m++) {
+        double f = (m + 0.5) / nCells;
+        T[m] = 300.0 + f * (Tb - 300.0);
+        P[m] = OneAtm;
+        for (size_t k = 0; k < nsp; k++) {
+            Y[m*nsp + k] = (1.0 - f) * Yu[k] + f * Yb[k];
+        }
+    }
+
+    vector_fp wdot1(nCells*nsp), wdot2(nCells*nsp);
+
+    // One cell at a time
+    Clock::time_point t0 = Clock::now();
+    for (int n = 0; n < nReps; n++) {
+        for (size_t m = 0; m < nCells; m++) {
+            gas.setState_TPY(T[m], P[m], &Y[m*nsp]);
+            gas.getNetProductionRates(&wdot1[m*nsp]);
+        }
+    }
+    double tSingle = elapsed(t0);
+
+    // All cells together
+    t0 = Clock::now();
+    for (int n = 0; n < nReps; n++) {
+        gas.getBatchNetProductionRates(nCells, T.data(), P.data(), Y.data(),
+                                       wdot2.data());
+    }
+    double tBatch = elapsed(t0);
+
+    double maxDiff = 0.0;
+    double maxRate = 0.0;
+    for (size_t i = 0; i < nCells*nsp; i++) {
+        maxDiff = std::max(maxDiff, std::abs(wdot1[i] - wdot2[i]));
+        maxRate = std::max(maxRate, std::abs(wdot1[i]));
+    }
+
+    cout << "Mechanism: gri30 (" << nsp << " species, "
+         << gas.nReactions() << " reactions)" << endl;
+    cout << "Cells: " << nCells << ", repetitions: " << nReps << endl;
+    cout << "single-state: " << nCells * nReps / tSingle << " cells/s" << endl;
+    cout << "batched:      " << nCells * nReps / tBatch << " cells/s" << endl;
+    cout << "speedup:      " << tSingle / tBatch << endl;
+    cout << "max relative difference: " << maxDiff / maxRate << endl;
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    size_t nCells = (argc > 1) ? std::atoi(argv[1]) : 1000;
+    int nReps = (argc > 2) ? std::atoi(argv[2]) : 20;
+    try {
+        int retn = kinetics_batch(nCells, nReps);
+        appdelete();
+        return retn;
+    } catch (CanteraError& err) {
+        std::cout << err.what() << std::endl;
+        appdelete();
+        return -1;
+    }
+}
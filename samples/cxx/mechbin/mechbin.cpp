@@ -0,0 +1,110 @@
+/*
+ * Compile a gas phase mechanism to the binary mechanism format
+ *
+ * Reads an ideal gas phase, its reactions and (optionally) its transport
+ * properties from a CTI or XML input file, and writes them to a binary
+ * mechanism file which can be loaded with the BinaryMechanism class. The
+ * time required to load the mechanism from the input file and from the
+ * binary file is reported in milliseconds, and the properties of the two
+ * sets of objects are compared.
+ *
+ * Usage: mechbin input_file phase_id output_file [transport_model]
+ *
+ * where transport_model is one of "Mix", "Multi", "CK_Mix" or "CK_Multi".
+ * Example: mechbin gri30.xml gri30 gri30.ctb Mix
+ */
+
+#include "cantera/kinetics/BinaryMechanism.h"
+#include "cantera/kinetics/importKinetics.h"
+#include "cantera/kinetics/GasKinetics.h"
+#include "cantera/thermo/IdealGasPhase.h"
+#include "cantera/transport/TransportFactory.h"
+
+#include <chrono>
+#include <iostream>
+
+using namespace Cantera;
+using std::cout;
+using std::endl;
+
+typedef std::chrono::high_resolution_clock Clock;
+
+double elapsed(Clock::time_point t0)
+{
+    return std::chrono::duration<double>(Clock::now() - t0).count();
+}
+
+int mechbin(const std::string& infile, const std::string& id,
+            const std::string& outfile, const std::string& model)
+{
+    Clock::time_point t0 = Clock::now();
+    IdealGasPhase gas1(infile, id);
+    GasKinetics kin1;
+    std::vector<ThermoPhase*> phases { &gas1 };
+    importKinetics(gas1.xml(), phases, &kin1);
+    std::unique_ptr<Transport> tran1;
+    if (!model.empty()) {
+        tran1.reset(newTransportMgr(model, &gas1));
+    }
+    double tInput = 1e3 * elapsed(t0);
+
+    writeBinaryMechanism(outfile, gas1, &kin1, tran1.get());
+
+    t0 = Clock::now();
+    BinaryMechanism mech(outfile);
+    IdealGasPhase gas2;
+    GasKinetics kin2;
+    mech.importPhase(gas2);
+    mech.importKinetics(gas2, kin2);
+    std::unique_ptr<Transport> tran2;
+    if (mech.hasTransport()) {
+        tran2.reset(mech.newTransport(gas2));
+    }
+    double tBinary = 1e3 * elapsed(t0);
+
+    cout << outfile << ": " << gas2.nSpecies() << " species, "
+         << kin2.nReactions() << " reactions" << endl;
+    cout << "Load time [ms]     input file: " << tInput
+         << "  binary: " << tBinary << "  speedup: " << tInput / tBinary
+         << endl;
+
+    // Compare the properties at a high-temperature state
+    gas1.setState_TP(1500.0, OneAtm);
+    gas2.setState_TP(1500.0, OneAtm);
+    size_t nr = kin1.nReactions();
+    vector_fp k1(nr), k2(nr);
+    kin1.getFwdRateConstants(k1.data());
+    kin2.getFwdRateConstants(k2.data());
+    double maxdiff = std::abs(gas1.enthalpy_mass() - gas2.enthalpy_mass()) /
+                     std::max(std::abs(gas1.enthalpy_mass()), 1.0);
+    for (size_t i = 0; i < nr; i++) {
+        maxdiff = std::max(maxdiff, std::abs(k1[i] - k2[i]) /
+                           std::max(std::abs(k1[i]), 1e-300));
+    }
+    if (tran1) {
+        maxdiff = std::max(maxdiff, std::abs(
+            tran1->viscosity() / tran2->viscosity() - 1.0));
+    }
+    cout << "Maximum relative difference of the properties: " << maxdiff
+         << endl;
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 4 || argc > 5) {
+        cout << "Usage: mechbin input_file phase_id output_file "
+                "[transport_model]" << endl;
+        return 1;
+    }
+    try {
+        int retn = mechbin(argv[1], argv[2], argv[3],
+                           (argc == 5) ? argv[4] : "");
+        appdelete();
+        return retn;
+    } catch (CanteraError& err) {
+        std::cout << err.what() << std::endl;
+        appdelete();
+        return -1;
+    }
+}
@@ -0,0 +1,133 @@
+/*
+ * Benchmark of the mixture-averaged diffusion coefficients
+ *
+ * Creates ideal gas mixtures of synthetic species with a range of molecular
+ * weights and Lennard-Jones parameters, and times the evaluation of the
+ * mixture-averaged diffusion coefficients with MixTransport. Two cases are
+ * timed for each number of species: a new temperature for each evaluation,
+ * where the binary diffusion coefficients are evaluated from the polynomial
+ * fits, and a new composition at a fixed temperature, where the stored
+ * coefficients are reused. For comparison, the same coefficients are also
+ * computed from the full matrix returned by getBinaryDiffCoeffs().
+ *
+ * Usage: mixdiff [number of repetitions]
+ */
+
+#include "cantera/thermo/IdealGasPhase.h"
+#include "cantera/thermo/ConstCpPoly.h"
+#include "cantera/transport/MixTransport.h"
+#include "cantera/transport/TransportData.h"
+#include "cantera/base/global.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <cstdio>
+
+using namespace Cantera;
+using std::cout;
+using std::endl;
+
+typedef std::chrono::high_resolution_clock Clock;
+
+double elapsed(Clock::time_point t0)
+{
+    return std::chrono::duration<double>(Clock::now() - t0).count();
+}
+
+// Mixture-averaged diffusion coefficients computed from the full matrix of
+// binary diffusion coefficients
+void fullMatrixDiffCoeffs(MixTransport& tr, ThermoPhase& gas, vector_fp& bdiff,
+                          vector_fp& x, double* d)
+{
+    size_t K = gas.nSpecies();
+    tr.getBinaryDiffCoeffs(K, bdiff.data());
+    gas.getMoleFractions(x.data());
+    for (size_t k = 0; k < K; k++) {
+        double sum = 0.0;
+        for (size_t j = 0; j < K; j++) {
+            if (j != k) {
+                sum += std::max(x[j], Tiny) / bdiff[K*k + j];
+            }
+        }
+        d[k] = (1 - x[k]) / sum;
+    }
+}
+
+int mixdiff(int nReps)
+{
+    printf("%8s %14s %14s %14s %14s\n", "species", "new T (ms)",
+           "new X (ms)", "full (ms)", "max rel diff");
+    for (size_t nsp : {50, 200, 500, 1000}) {
+        IdealGasPhase gas;
+        gas.addElement("H");
+        gas.addElement("C");
+        double cp[] = {298.15, 0.0, 1.5e5, 3.0e4};
+        for (size_t k = 0; k < nsp; k++) {
+            compositionMap comp{{"C", 1.0 + k % 12}, {"H", 2.0 + k % 7}};
+            shared_ptr<Species> sp(new Species(fmt::format("S{}", k), comp));
+            sp->thermo.reset(new ConstCpPoly(200, 3500, OneAtm, cp));
+            shared_ptr<GasTransportData> tr(new GasTransportData());
+            tr->setCustomaryUnits((k % 3) ? "nonlinear" : "linear",
+                                  2.5 + 0.003 * (k % 997), 40.0 + (k*37) % 500,
+                                  0.0, 0.0, 1.0);
+            sp->transport = tr;
+            gas.addSpecies(sp);
+        }
+        gas.initThermo();
+        vector_fp x(nsp);
+        for (size_t k = 0; k < nsp; k++) {
+            x[k] = 1.0 + k % 5;
+        }
+        gas.setState_TPX(300.0, OneAtm, x.data());
+        MixTransport tr;
+        tr.init(&gas);
+
+        vector_fp d1(nsp), d2(nsp), bdiff(nsp*nsp);
+        Clock::time_point t0 = Clock::now();
+        for (int rep = 0; rep < nReps; rep++) {
+            gas.setState_TP(300.0 + rep, OneAtm);
+            tr.getMixDiffCoeffsMole(d1.data());
+        }
+        double tNewT = elapsed(t0);
+
+        t0 = Clock::now();
+        for (int rep = 0; rep < nReps; rep++) {
+            x[rep % nsp] += 1.0;
+            gas.setMoleFractions(x.data());
+            tr.getMixDiffCoeffsMole(d1.data());
+        }
+        double tNewX = elapsed(t0);
+
+        t0 = Clock::now();
+        for (int rep = 0; rep < nReps; rep++) {
+            gas.setState_TP(300.0 + rep, OneAtm);
+            fullMatrixDiffCoeffs(tr, gas, bdiff, x, d2.data());
+        }
+        double tFull = elapsed(t0);
+
+        tr.getMixDiffCoeffsMole(d1.data());
+        double maxDiff = 0.0;
+        for (size_t k = 0; k < nsp; k++) {
+            maxDiff = std::max(maxDiff, std::abs(d1[k] - d2[k]) / d2[k]);
+        }
+        printf("%8zu %14.3f %14.3f %14.3f %14.3g\n", nsp,
+               1000 * tNewT / nReps, 1000 * tNewX / nReps,
+               1000 * tFull / nReps, maxDiff);
+    }
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    int nReps = (argc > 1) ? std::atoi(argv[1]) : 20;
+    try {
+        int retn = mixdiff(nReps);
+        appdelete();
+        return retn;
+    } catch (CanteraError& err) {
+        std::cout << err.what() << std::endl;
+        appdelete();
+        return -1;
+    }
+}
@@ -0,0 +1,139 @@
+/*
+ * Benchmark of the stoichiometry operations used to compute species
+ * production rates from the rates of progress
+ *
+ * Builds the reactant and product stoichiometry managers for the GRI-Mech 3.0
+ * mechanism and times the evaluation of the net production rates and the
+ * creation rates using the lists of C1, C2, C3 and C_AnyN objects and using
+ * the compressed species-major representation. It then times
+ * Kinetics::getNetProductionRates(), which uses the species-major net
+ * stoichiometric matrix, and Kinetics::getNetRatesOfProgress() at the same
+ * state. The difference between the two is the cost of computing the
+ * production rates from the rates of progress. The time per call is reported
+ * in microseconds.
+ *
+ * Usage: stoich_bench [number of repetitions]
+ */
+
+#include "cantera/IdealGasMix.h"
+#include "cantera/kinetics/StoichManager.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+using namespace Cantera;
+using std::cout;
+using std::endl;
+
+typedef std::chrono::high_resolution_clock Clock;
+
+double elapsed(Clock::time_point t0)
+{
+    return std::chrono::duration<double>(Clock::now() - t0).count();
+}
+
+// Time 'nReps' calls of 'f' and return the time per call in microseconds
+template <class F>
+double timeit(int nReps, F f)
+{
+    Clock::time_point t0 = Clock::now();
+    for (int n = 0; n < nReps; n++) {
+        f();
+    }
+    return 1e6 * elapsed(t0) / nReps;
+}
+
+int stoich_bench(int nReps)
+{
+    IdealGasMix gas("gri30.cti", "gri30");
+    size_t nsp = gas.nSpecies();
+    size_t nr = gas.nReactions();
+
+    // Stoichiometry managers for the reactants and for the products of the
+    // reversible and irreversible reactions, as used by class Kinetics
+    StoichManagerN reactants, revProducts, irrevProducts;
+    for (size_t i = 0; i < nr; i++) {
+        shared_ptr<Reaction> r = gas.reaction(i);
+        std::vector<size_t> rk, pk;
+        vector_fp rstoich, pstoich;
+        for (const auto& sp : r->reactants) {
+            rk.push_back(gas.kineticsSpeciesIndex(sp.first));
+            rstoich.push_back(sp.second);
+        }
+        for (const auto& sp : r->products) {
+            pk.push_back(gas.kineticsSpeciesIndex(sp.first));
+            pstoich.push_back(sp.second);
+        }
+        reactants.add(i, rk, rstoich, rstoich);
+        if (r->reversible) {
+            revProducts.add(i, pk, pstoich, pstoich);
+        } else {
+            irrevProducts.add(i, pk, pstoich, pstoich);
+        }
+    }
+
+    gas.setState_TPX(1500.0, OneAtm, "CH4:1.0, O2:2.0, N2:7.52, H:0.01, "
+                     "O:0.01, OH:0.01, CH3:0.01, HO2:0.001");
+    vector_fp ropf(nr), ropr(nr), ropnet(nr), wdot(nsp);
+    gas.getFwdRatesOfProgress(ropf.data());
+    gas.getRevRatesOfProgress(ropr.data());
+    gas.getNetRatesOfProgress(ropnet.data());
+
+    cout << "Mechanism: gri30 (" << nsp << " species, " << nr
+         << " reactions)" << endl;
+    cout << "Time per call [us]     lists    compressed    speedup" << endl;
+    double t[2][2];
+    for (int compressed = 0; compressed < 2; compressed++) {
+        for (auto* s : {&reactants, &revProducts, &irrevProducts}) {
+            s->setCompressed(compressed != 0);
+            s->finalize();
+        }
+        // Net production rates
+        t[0][compressed] = timeit(nReps, [&]() {
+            std::fill(wdot.begin(), wdot.end(), 0.0);
+            revProducts.incrementSpecies(ropnet.data(), wdot.data());
+            irrevProducts.incrementSpecies(ropnet.data(), wdot.data());
+            reactants.decrementSpecies(ropnet.data(), wdot.data());
+        });
+        // Creation rates
+        t[1][compressed] = timeit(nReps, [&]() {
+            std::fill(wdot.begin(), wdot.end(), 0.0);
+            revProducts.incrementSpecies(ropf.data(), wdot.data());
+            irrevProducts.incrementSpecies(ropf.data(), wdot.data());
+            reactants.incrementSpecies(ropr.data(), wdot.data());
+        });
+    }
+    const char* names[] = {"net production: ", "creation:       "};
+    for (int n = 0; n < 2; n++) {
+        cout << names[n] << "  " << t[n][0] << "  " << t[n][1] << "  "
+             << t[n][0] / t[n][1] << endl;
+    }
+
+    // Production rates through the Kinetics interface. Both calls recompute
+    // the rates of progress at the (unchanged) state.
+    double tRop = timeit(nReps, [&]() {
+        gas.getNetRatesOfProgress(ropnet.data());
+    });
+    double tWdot = timeit(nReps, [&]() {
+        gas.getNetProductionRates(wdot.data());
+    });
+    cout << "Kinetics::getNetRatesOfProgress:  " << tRop << endl;
+    cout << "Kinetics::getNetProductionRates:  " << tWdot << endl;
+    cout << "difference (net production):      " << tWdot - tRop << endl;
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    int nReps = (argc > 1) ? std::atoi(argv[1]) : 100000;
+    try {
+        int retn = stoich_bench(nReps);
+        appdelete();
+        return retn;
+    } catch (CanteraError& err) {
+        std::cout << err.what() << std::endl;
+        appdelete();
+        return -1;
+    }
+}
@@ -0,0 +1,155 @@
+/**
+ *  @file ThreadPool.cpp
+ */
+
+#include "cantera/base/ThreadPool.h"
+#include "cantera/base/global.h"
+
+namespace Cantera
+{
+
+ThreadPool::ThreadPool(size_t nThreads) :
+    m_task(0),
+    m_generation(0),
+    m_active(0),
+    m_stop(false),
+    m_errorTask(npos)
+{
+    if (nThreads == 0) {
+        nThreads = hardwareThreads();
+    }
+    for (size_t i = 0; i < nThreads; i++) {
+        m_queues.emplace_back(new TaskQueue());
+        m_queues.back()->begin = m_queues.back()->end = 0;
+    }
+    for (size_t i = 1; i < nThreads; i++) {
+        m_threads.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_start.notify_all();
+    for (auto& thread : m_threads) {
+        thread.join();
+    }
+}
+
+size_t ThreadPool::hardwareThreads()
+{
+    return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+void ThreadPool::run(size_t nTasks,
+                     const std::function<void(size_t, size_t)>& task)
+{
+    std::unique_lock<std::mutex> runLock(m_run_mutex);
+    size_t nw = nThreads();
+    for (size_t i = 0; i < nw; i++) {
+        std::unique_lock<std::mutex> lock(m_queues[i]->lock);
+        m_queues[i]->begin = (i * nTasks) / nw;
+        m_queues[i]->end = ((i + 1) * nTasks) / nw;
+    }
+    m_errorTask = npos;
+    m_error = nullptr;
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_task = &task;
+        m_active = m_threads.size();
+        m_generation++;
+    }
+    m_start.notify_all();
+
+    // The calling thread is worker 0
+    work(0);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [&]() { return m_active == 0; });
+    m_task = 0;
+    if (m_error) {
+        std::rethrow_exception(m_error);
+    }
+}
+
+void ThreadPool::workerLoop(size_t worker)
+{
+    size_t generation = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_start.wait(lock, [&]() {
+                return m_stop || m_generation != generation;
+            });
+            if (m_stop) {
+                break;
+            }
+            generation = m_generation;
+        }
+        work(worker);
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_active--;
+        }
+        m_done.notify_one();
+    }
+    // Release the per-thread message log held by the Application object
+    thread_complete();
+}
+
+void ThreadPool::work(size_t worker)
+{
+    size_t i;
+    while ((i = nextTask(worker)) != npos) {
+        try {
+            (*m_task)(i, worker);
+        } catch (...) {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (i < m_errorTask) {
+                m_errorTask = i;
+                m_error = std::current_exception();
+            }
+        }
+    }
+}
+
+size_t ThreadPool::nextTask(size_t worker)
+{
+    {
+        TaskQueue& q = *m_queues[worker];
+        std::unique_lock<std::mutex> lock(q.lock);
+        if (q.begin < q.end) {
+            return q.begin++;
+        }
+    }
+
+    // Own queue is empty; steal from the back of the longest other queue. The
+    // queue sizes may change before the lock is acquired, so retry until
+    // all of the queues are found to be empty.
+    while (true) {
+        size_t victim = npos;
+        size_t longest = 0;
+        for (size_t j = 0; j < m_queues.size(); j++) {
+            TaskQueue& q = *m_queues[j];
+            std::unique_lock<std::mutex> lock(q.lock);
+            if (q.end - q.begin > longest) {
+                longest = q.end - q.begin;
+                victim = j;
+            }
+        }
+        if (victim == npos) {
+            return npos;
+        }
+        TaskQueue& q = *m_queues[victim];
+        std::unique_lock<std::mutex> lock(q.lock);
+        if (q.begin < q.end) {
+            return --q.end;
+        }
+    }
+}
+
+}
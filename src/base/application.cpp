@@ -34,6 +34,9 @@ static std::mutex app_mutex;
 //! Mutex for controlling access to XML file storage
 static std::mutex xml_mutex;
 
+//! Mutex for access to the list of deprecation warnings
+static std::mutex warn_mutex;
+
 static int get_modified_time(const std::string& path) {
 #ifdef _WIN32
     HANDLE hFile = CreateFile(path.c_str(), GENERIC_READ, FILE_SHARE_WRITE,
@@ -176,10 +179,12 @@ void Application::ApplicationDestroy()
 void Application::warn_deprecated(const std::string& method,
                                   const std::string& extra)
 {
+    std::unique_lock<std::mutex> warnLock(warn_mutex);
     if (m_suppress_deprecation_warnings || warnings.count(method)) {
         return;
     }
     warnings.insert(method);
+    warnLock.unlock();
     writelog("WARNING: '" + method + "' is deprecated. " + extra);
     writelogendl();
 }
@@ -215,9 +220,12 @@ XML_Node* Application::get_XML_File(const std::string& file, int debug)
     }
     XML_Node* x = new XML_Node("doc");
     if (ext != ".xml" && ext != ".ctml") {
-        // Assume that we are trying to open a cti file. Do the conversion to XML.
-        std::stringstream phase_xml(ct2ctml_string(path));
-        x->build(phase_xml);
+        // Assume that we are trying to open a cti file. Do the conversion to
+        // XML, using the Python converter only if necessary.
+        if (!ct2ctml_native(path, *x, true)) {
+            std::stringstream phase_xml(call_ctml_writer(path, true));
+            x->build(phase_xml);
+        }
     } else {
         std::ifstream s(path.c_str());
         if (s) {
@@ -243,13 +251,15 @@ XML_Node* Application::get_XML_from_string(const std::string& text)
     }
     std::stringstream s;
     size_t start = text.find_first_not_of(" \t\r\n");
+    std::unique_ptr<XML_Node> x(new XML_Node());
     if (text.substr(start,1) == "<") {
         s << text;
-    } else {
-        s << ct_string2ctml_string(text.substr(start));
+        x->build(s);
+    } else if (!ct2ctml_native(text.substr(start), *x)) {
+        s << call_ctml_writer(text.substr(start), false);
+        x->build(s);
     }
-    entry.first = new XML_Node();
-    entry.first->build(s);
+    entry.first = x.release();
     return entry.first;
 }
 
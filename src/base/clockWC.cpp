@@ -10,39 +10,24 @@
  * See file License.txt for licensing information.
  */
 
-#include <time.h>
 #include "cantera/base/clockWC.h"
 
 namespace Cantera
 {
 clockWC::clockWC() :
-    last_num_ticks(clock()),
-    clock_rollovers(0u),
-    start_ticks(0),
-    inv_clocks_per_sec(1./(double)CLOCKS_PER_SEC),
-    clock_width((double)(1L<<((int)sizeof(clock_t)*8-2))*4./(double)CLOCKS_PER_SEC)
+    m_start(std::chrono::steady_clock::now())
 {
-    start_ticks = last_num_ticks;
 }
 
 double clockWC::start()
 {
-    start_ticks = last_num_ticks = clock();
-    clock_rollovers = 0u;
+    m_start = std::chrono::steady_clock::now();
     return 0.0;
 }
 
 double clockWC::secondsWC()
 {
-    clock_t num_ticks = clock();
-    if (num_ticks < last_num_ticks) {
-        clock_rollovers++;
-    }
-    double value = (num_ticks - start_ticks) * inv_clocks_per_sec;
-    if (clock_rollovers) {
-        value += clock_rollovers * clock_width;
-    }
-    last_num_ticks = num_ticks;
-    return value;
+    return std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - m_start).count();
 }
 }
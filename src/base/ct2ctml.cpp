@@ -74,7 +74,7 @@ void ct2ctml(const char* file, const int debug)
     out << xml;
 }
 
-static std::string call_ctml_writer(const std::string& text, bool isfile)
+std::string call_ctml_writer(const std::string& text, bool isfile)
 {
     std::string file, arg;
     if (isfile) {
@@ -90,7 +90,9 @@ static std::string call_ctml_writer(const std::string& text, bool isfile)
     //! environment.
     throw CanteraError("ct2ctml",
                        "python cti to ctml conversion requested for file, " + file +
-                       ", but not available in this computational environment");
+                       ", but not available in this computational environment.\n"
+                       "The input uses features which are not supported by the "
+                       "built-in cti reader.");
 #endif
 
     string python_output, error_output;
@@ -171,13 +173,37 @@ static std::string call_ctml_writer(const std::string& text, bool isfile)
     return python_output;
 }
 
+//! Write the CTML tree generated by ct2ctml_native() to the string *xml*.
+//! Returns false if the native reader cannot be used for this input.
+static bool native_ctml_string(const std::string& text, bool isfile,
+                               std::string& xml)
+{
+    XML_Node root("doc");
+    if (!ct2ctml_native(text, root, isfile)) {
+        return false;
+    }
+    std::stringstream out;
+    root.writeHeader(out);
+    root.write(out);
+    xml = out.str();
+    return true;
+}
+
 std::string ct2ctml_string(const std::string& file)
 {
+    std::string xml;
+    if (native_ctml_string(file, true, xml)) {
+        return xml;
+    }
     return call_ctml_writer(file, true);
 }
 
 std::string ct_string2ctml_string(const std::string& cti)
 {
+    std::string xml;
+    if (native_ctml_string(cti, false, xml)) {
+        return xml;
+    }
     return call_ctml_writer(cti, false);
 }
 
@@ -0,0 +1,1981 @@
+/**
+ * @file ctiReader.cpp
+ * Conversion of cti input files to CTML without calling the Python
+ * interpreter (see \ref inputfiles).
+ */
+
+#include "cantera/base/ctml.h"
+#include "cantera/base/stringUtils.h"
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <set>
+#include <sstream>
+
+using namespace std;
+
+namespace Cantera
+{
+
+namespace
+{
+
+//! Exception thrown for input which uses features of the Python language or
+//! types of entries which are not handled by CtiReader. The file is then
+//! converted using the Python converter.
+class CtiUnsupported : public CanteraError
+{
+public:
+    CtiUnsupported(const std::string& msg) :
+        CanteraError("ct2ctml_native", msg) {}
+};
+
+struct Call;
+
+//! The value of a Python expression in a cti file
+struct Value {
+    enum Type { None, Number, String, List, Object };
+
+    Value() : type(None), number(0.0), isInt(false) {}
+
+    Type type;
+    double number;
+    bool isInt; //!< True for Python integers
+    std::string text;
+    std::vector<Value> items; //!< Items of a list or tuple
+    std::shared_ptr<Call> call; //!< Entry created by a function call
+};
+
+//! A call to one of the functions or classes defined by `ctml_writer.py`
+struct Call {
+    std::string name;
+    std::vector<Value> args;
+    std::vector<std::pair<std::string, Value>> kwargs;
+    int line;
+};
+
+//! Species names and stoichiometric coefficients, in the order of the input.
+//! The coefficients are stored as Values to reproduce the formatting of
+//! integer and floating point coefficients by `ctml_writer.py`.
+typedef std::vector<std::pair<std::string, Value>> Composition;
+
+//! The arguments of a Call, matched to the parameter names of the function
+//! with the same name in `ctml_writer.py`.
+class Args
+{
+public:
+    //! @param call  The function call
+    //! @param names  Names of the parameters, in order
+    //! @param nPositional  Number of parameters which may be given as
+    //!     positional arguments. Additional positional arguments are stored
+    //!     in extra() if *varargs* is true.
+    Args(const Call& call, const std::vector<std::string>& names,
+         size_t nPositional=npos, bool varargs=false) {
+        nPositional = std::min(nPositional, names.size());
+        for (size_t i = 0; i < call.args.size(); i++) {
+            if (i < nPositional) {
+                m_args[names[i]] = &call.args[i];
+            } else if (varargs) {
+                m_extra.push_back(&call.args[i]);
+            } else {
+                throw CanteraError("ct2ctml_native", "Too many arguments "
+                    "for '{}' on line {}", call.name, call.line);
+            }
+        }
+        for (const auto& kw : call.kwargs) {
+            if (std::find(names.begin(), names.end(), kw.first) == names.end()) {
+                throw CanteraError("ct2ctml_native", "Unexpected keyword "
+                    "argument '{}' for '{}' on line {}", kw.first, call.name,
+                    call.line);
+            } else if (m_args.count(kw.first)) {
+                throw CanteraError("ct2ctml_native", "Multiple values for "
+                    "argument '{}' of '{}' on line {}", kw.first, call.name,
+                    call.line);
+            }
+            m_args[kw.first] = &kw.second;
+        }
+    }
+
+    //! The argument for parameter *name*, or nullptr if the argument was
+    //! not given or is `None`.
+    const Value* get(const std::string& name) const {
+        auto iter = m_args.find(name);
+        if (iter == m_args.end() || iter->second->type == Value::None) {
+            return nullptr;
+        }
+        return iter->second;
+    }
+
+    const std::vector<const Value*>& extra() const {
+        return m_extra;
+    }
+
+private:
+    std::map<std::string, const Value*> m_args;
+    std::vector<const Value*> m_extra;
+};
+
+//! Format a floating point number in the same way as Python's `repr`
+std::string pyrepr(double x)
+{
+    std::string s = fmt::format("{}", x);
+    if (s.find_first_not_of("-0123456789") == npos) {
+        s += ".0";
+    }
+    return s;
+}
+
+//! Reader for cti files, which produces the same CTML tree as the
+//! `ctml_writer.py` module.
+/*!
+ * The input is tokenized and evaluated as a sequence of Python statements,
+ * which may be function calls or assignments of variables. Expressions may
+ * contain numbers, strings, lists, tuples, the arithmetic operators and the
+ * constants defined by `ctml_writer.py`. The entries which are understood
+ * are the phase types `ideal_gas`, `ideal_interface`, `stoichiometric_solid`
+ * and `stoichiometric_liquid`, `species`, `element`, the homogeneous
+ * reaction types and `surface_reaction`, and the entries embedded in these,
+ * along with the `units`, `standard_pressure` and `validate` directives.
+ * Anything else raises CtiUnsupported.
+ */
+class CtiReader
+{
+public:
+    CtiReader(const std::string& text, const std::string& file);
+
+    //! Tokenize and evaluate the input
+    void parse();
+
+    //! Build the CTML tree for the input that has been parsed
+    void build(XML_Node& root);
+
+private:
+    struct Token {
+        enum Kind { Name, Number, String, Op, Newline, End };
+        Kind kind;
+        std::string text;
+        double number;
+        bool isInt;
+        int line;
+    };
+
+    struct PhaseEntry {
+        std::shared_ptr<Call> call;
+        std::string name;
+        int dim;
+        bool idealGas;
+        //! Dimensions of the concentrations (moles, length)
+        int concMoles, concLength;
+        //! Data sources and species names of each `species` string
+        std::vector<std::pair<std::string, std::string>> speciesArrays;
+        std::set<std::string> species;
+    };
+
+    struct SpeciesEntry {
+        std::shared_ptr<Call> call;
+        std::string name;
+        //! Element names and the formatted number of atoms
+        std::vector<std::pair<std::string, std::string>> atoms;
+        std::string charge; //!< Formatted charge, or empty if not specified
+    };
+
+    struct ReactionEntry {
+        std::shared_ptr<Call> call;
+        std::string type; //!< Type attribute of the CTML reaction
+        int number;
+        std::string id;
+        std::string equation;
+        bool reversible;
+        Composition reactants, products, orders;
+        bool explicitOrders;
+        std::vector<std::string> options;
+        std::vector<Value> rates; //!< Rate expressions, in output order
+        std::string efficiencies;
+        double defaultEfficiency;
+        Value falloff;
+        std::vector<Value> pressures; //!< Pressures of P-log reactions
+        Value Tmin, Tmax, Pmin, Pmax; //!< Ranges of Chebyshev reactions
+        std::vector<vector_fp> chebCoeffs;
+    };
+
+    //! @name Tokenizer
+    //! @{
+    void tokenize();
+    void readString(size_t& i, int& line, bool raw);
+    void addToken(Token::Kind kind, const std::string& text, int line);
+    //! @}
+
+    //! @name Expression evaluation
+    //! @{
+    const Token& peek(size_t offset=0) const {
+        return m_tokens[std::min(m_pos + offset, m_tokens.size() - 1)];
+    }
+    bool isOp(const Token& t, const char* op) const {
+        return t.kind == Token::Op && t.text == op;
+    }
+    void expectOp(const char* op);
+    Value parseExpression();
+    Value parseTerm();
+    Value parseUnary();
+    Value parsePower();
+    Value parseAtom();
+    Value parseSequence(const char* close);
+    Value parseCall(const Token& name);
+    Value binaryOp(const Value& a, const Value& b, const std::string& op,
+                   int line);
+    Value evaluate(std::shared_ptr<Call> call);
+    //! @}
+
+    //! @name Entries
+    //! @{
+    void setUnits(const Call& call);
+    void addPhase(std::shared_ptr<Call> call);
+    void addSpecies(std::shared_ptr<Call> call);
+    void addReaction(std::shared_ptr<Call> call);
+    Composition reactionSpecies(const std::string& s);
+    void removeThirdBody(ReactionEntry& rxn);
+    //! @}
+
+    //! @name Building the CTML tree
+    //! @{
+    void buildPhase(XML_Node& parent, const PhaseEntry& phase);
+    void buildSpecies(XML_Node& parent, const SpeciesEntry& sp);
+    void buildThermo(XML_Node& node, const Value& thermo);
+    void buildTransport(XML_Node& node, const Value& transport);
+    void buildState(XML_Node& node, const Value& state);
+    void buildReaction(XML_Node& parent, ReactionEntry& rxn);
+    void buildArrhenius(XML_Node& node, const Value& rate,
+                        const std::string& name, double unitFactor,
+                        const std::vector<std::string>& gasSpecies,
+                        const PhaseEntry* rxnPhase);
+    void buildFalloff(XML_Node& node, const Value& falloff);
+    void addFloat(XML_Node& node, const std::string& name, const Value& val,
+                  const std::string& fmt="", const std::string& defunits="");
+    double unitFactor(double mdim, double ldim);
+    //! @}
+
+    //! @name Value conversion
+    //! @{
+    double number(const Value* v, double default_value, const char* what);
+    std::string string(const Value* v, const std::string& default_value,
+                       const char* what);
+    std::vector<std::string> strings(const Value* v, const char* what);
+    vector_fp numbers(const Value& v, const char* what);
+    std::string repr(const Value& v);
+    bool truthy(const Value* v);
+    //! @}
+
+    //! Raise a CanteraError for the entry on line #m_line
+    template <typename... Args>
+    void error(const std::string& msg, const Args&... args) const {
+        throw CanteraError("ct2ctml_native", "Error in entry on line {} of "
+            "'{}':\n" + msg, m_line, m_file, args...);
+    }
+
+    //! Raise CtiUnsupported for input on line *line*
+    void unsupported(int line, const std::string& what) const {
+        throw CtiUnsupported(fmt::format("Unsupported input on line {} of "
+            "'{}': {}", line, m_file, what));
+    }
+
+    std::string m_text;
+    std::string m_file;
+    std::vector<Token> m_tokens;
+    size_t m_pos;
+    int m_line; //!< Line of the entry being evaluated or built
+
+    std::map<std::string, Value> m_variables;
+
+    //! @name Default units and settings
+    //! @{
+    std::string m_ulen, m_umol, m_umass, m_utime, m_ue, m_uenergy, m_upres;
+    double m_pref;
+    std::string m_validateSpecies, m_validateReactions;
+    //! @}
+
+    std::vector<std::shared_ptr<Call>> m_elements;
+    std::vector<PhaseEntry> m_phases;
+    std::vector<SpeciesEntry> m_species;
+    std::set<std::string> m_speciesNames;
+    std::vector<ReactionEntry> m_reactions;
+};
+
+CtiReader::CtiReader(const std::string& text, const std::string& file) :
+    m_file(file),
+    m_pos(0),
+    m_line(0),
+    m_ulen("m"),
+    m_umol("kmol"),
+    m_umass("kg"),
+    m_utime("s"),
+    m_ue("J/kmol"),
+    m_uenergy("J"),
+    m_upres("Pa"),
+    m_pref(1.0e5),
+    m_validateSpecies("yes"),
+    m_validateReactions("yes")
+{
+    // Universal newlines
+    m_text.reserve(text.size());
+    for (size_t i = 0; i < text.size(); i++) {
+        if (text[i] == '\r') {
+            if (i + 1 == text.size() || text[i+1] != '\n') {
+                m_text += '\n';
+            }
+        } else {
+            m_text += text[i];
+        }
+    }
+}
+
+// ---------------------------- Tokenizer ---------------------------------
+
+void CtiReader::addToken(Token::Kind kind, const std::string& text, int line)
+{
+    Token t;
+    t.kind = kind;
+    t.text = text;
+    t.number = 0.0;
+    t.isInt = false;
+    t.line = line;
+    m_tokens.push_back(t);
+}
+
+void CtiReader::tokenize()
+{
+    const std::string& s = m_text;
+    size_t n = s.size();
+    size_t i = 0;
+    int line = 1;
+    int depth = 0;
+    bool lineStart = true;
+    while (i < n) {
+        unsigned char c = s[i];
+        if (lineStart && depth == 0) {
+            // Indentation is only used by compound statements
+            size_t j = s.find_first_not_of(" \t\f", i);
+            if (j != i && j != npos && s[j] != '\n' && s[j] != '#') {
+                unsupported(line, "indented block");
+            }
+            lineStart = false;
+            i = std::min(j, n);
+            continue;
+        }
+        if (c == '\n') {
+            if (depth == 0 && !m_tokens.empty()
+                && m_tokens.back().kind != Token::Newline) {
+                addToken(Token::Newline, "", line);
+            }
+            line++;
+            i++;
+            lineStart = true;
+        } else if (c == ' ' || c == '\t' || c == '\f') {
+            i++;
+        } else if (c == '#') {
+            i = std::min(s.find('\n', i), n);
+        } else if (c == '\\') {
+            if (i + 1 < n && s[i+1] == '\n') {
+                // explicit line continuation
+                i += 2;
+                line++;
+            } else {
+                unsupported(line, "unexpected character '\\'");
+            }
+        } else if (isdigit(c) || (c == '.' && i + 1 < n && isdigit(s[i+1]))) {
+            size_t j = i;
+            bool isInt = true;
+            while (j < n && isdigit(s[j])) {
+                j++;
+            }
+            if (j < n && s[j] == '.') {
+                isInt = false;
+                j++;
+                while (j < n && isdigit(s[j])) {
+                    j++;
+                }
+            }
+            if (j < n && (s[j] == 'e' || s[j] == 'E')) {
+                size_t k = j + 1;
+                if (k < n && (s[k] == '+' || s[k] == '-')) {
+                    k++;
+                }
+                if (k < n && isdigit(s[k])) {
+                    isInt = false;
+                    j = k;
+                    while (j < n && isdigit(s[j])) {
+                        j++;
+                    }
+                }
+            }
+            if (j < n && (isalnum(s[j]) || s[j] == '_')) {
+                unsupported(line, "number format");
+            }
+            addToken(Token::Number, s.substr(i, j - i), line);
+            m_tokens.back().number = fpValue(m_tokens.back().text);
+            m_tokens.back().isInt = isInt;
+            i = j;
+        } else if (isalpha(c) || c == '_') {
+            size_t j = i;
+            while (j < n && (isalnum(s[j]) || s[j] == '_')) {
+                j++;
+            }
+            std::string name = s.substr(i, j - i);
+            if (j < n && (s[j] == '\'' || s[j] == '"')) {
+                // string prefix
+                std::string prefix = lowercase(name);
+                if (prefix != "r" && prefix != "u" && prefix != "ur") {
+                    unsupported(line, "string prefix '" + name + "'");
+                }
+                i = j;
+                readString(i, line, prefix.find('r') != npos);
+            } else {
+                addToken(Token::Name, name, line);
+                i = j;
+            }
+        } else if (c == '\'' || c == '"') {
+            readString(i, line, false);
+        } else {
+            static const char* ops2[] = {"**", "==", "!=", "<=", ">=", "//",
+                "+=", "-=", "*=", "/=", "%=", "<<", ">>", "->"};
+            std::string op(1, c);
+            for (const char* op2 : ops2) {
+                if (s.compare(i, 2, op2) == 0) {
+                    op = op2;
+                    break;
+                }
+            }
+            if (op.size() == 1) {
+                if (c == 0 || !strchr("()[]{},=+-*/%.:;<>!&|^~@", c)) {
+                    unsupported(line, "unexpected character");
+                } else if (strchr("([{", c)) {
+                    depth++;
+                } else if (strchr(")]}", c)) {
+                    depth--;
+                }
+            }
+            addToken(Token::Op, op, line);
+            i += op.size();
+        }
+    }
+    if (!m_tokens.empty() && m_tokens.back().kind != Token::Newline) {
+        addToken(Token::Newline, "", line);
+    }
+    addToken(Token::End, "", line);
+}
+
+void CtiReader::readString(size_t& i, int& line, bool raw)
+{
+    const std::string& s = m_text;
+    int startLine = line;
+    char quote = s[i];
+    std::string triple(3, quote);
+    bool isTriple = (s.compare(i, 3, triple) == 0);
+    i += isTriple ? 3 : 1;
+    std::string value;
+    while (true) {
+        if (i >= s.size()) {
+            unsupported(startLine, "unterminated string");
+        }
+        char c = s[i];
+        if (c == '\\' && i + 1 < s.size()) {
+            char e = s[i+1];
+            i += 2;
+            if (e == '\n') {
+                line++;
+                if (raw) {
+                    value += "\\\n";
+                }
+            } else if (raw) {
+                value += c;
+                value += e;
+            } else if (e == 'n') {
+                value += '\n';
+            } else if (e == 't') {
+                value += '\t';
+            } else if (e == '\\' || e == '\'' || e == '"') {
+                value += e;
+            } else {
+                value += c;
+                value += e;
+            }
+            continue;
+        }
+        if (isTriple && s.compare(i, 3, triple) == 0) {
+            i += 3;
+            break;
+        } else if (!isTriple && c == quote) {
+            i++;
+            break;
+        } else if (c == '\n') {
+            if (!isTriple) {
+                unsupported(line, "unterminated string");
+            }
+            line++;
+        }
+        value += c;
+        i++;
+    }
+    addToken(Token::String, value, startLine);
+}
+
+// ------------------------- Expression evaluation --------------------------
+
+void CtiReader::parse()
+{
+    tokenize();
+    static const std::set<std::string> keywords {"and", "as", "assert",
+        "break", "class", "continue", "def", "del", "elif", "else", "except",
+        "exec", "finally", "for", "from", "global", "if", "import", "in",
+        "is", "lambda", "nonlocal", "not", "or", "pass", "raise", "return",
+        "try", "while", "with", "yield"};
+    m_pos = 0;
+    while (peek().kind != Token::End) {
+        const Token& t = peek();
+        if (t.kind == Token::Newline || isOp(t, ";")) {
+            m_pos++;
+            continue;
+        }
+        if (t.kind == Token::Name && keywords.count(t.text)) {
+            unsupported(t.line, "'" + t.text + "' statement");
+        }
+        if (t.kind == Token::Name && isOp(peek(1), "=")) {
+            std::string name = t.text;
+            m_pos += 2;
+            m_variables[name] = parseExpression();
+        } else {
+            parseExpression();
+        }
+        const Token& end = peek();
+        if (end.kind != Token::Newline && end.kind != Token::End
+            && !isOp(end, ";")) {
+            unsupported(end.line, "unexpected '" + end.text + "'");
+        }
+    }
+}
+
+void CtiReader::expectOp(const char* op)
+{
+    if (!isOp(peek(), op)) {
+        unsupported(peek().line, fmt::format("expected '{}' but found '{}'",
+                                             op, peek().text));
+    }
+    m_pos++;
+}
+
+Value CtiReader::parseExpression()
+{
+    Value v = parseTerm();
+    while (isOp(peek(), "+") || isOp(peek(), "-")) {
+        const Token& op = m_tokens[m_pos++];
+        v = binaryOp(v, parseTerm(), op.text, op.line);
+    }
+    return v;
+}
+
+Value CtiReader::parseTerm()
+{
+    Value v = parseUnary();
+    while (isOp(peek(), "*") || isOp(peek(), "/")) {
+        const Token& op = m_tokens[m_pos++];
+        v = binaryOp(v, parseUnary(), op.text, op.line);
+    }
+    return v;
+}
+
+Value CtiReader::parseUnary()
+{
+    if (isOp(peek(), "-") || isOp(peek(), "+")) {
+        const Token& op = m_tokens[m_pos++];
+        Value v = parseUnary();
+        if (v.type != Value::Number) {
+            unsupported(op.line, "unary '" + op.text + "' for non-number");
+        }
+        if (op.text == "-") {
+            v.number = -v.number;
+        }
+        return v;
+    }
+    return parsePower();
+}
+
+Value CtiReader::parsePower()
+{
+    Value v = parseAtom();
+    if (isOp(peek(), "**")) {
+        const Token& op = m_tokens[m_pos++];
+        v = binaryOp(v, parseUnary(), op.text, op.line);
+    }
+    return v;
+}
+
+Value CtiReader::parseAtom()
+{
+    const Token& t = m_tokens[m_pos++];
+    Value v;
+    if (t.kind == Token::Number) {
+        v.type = Value::Number;
+        v.number = t.number;
+        v.isInt = t.isInt;
+    } else if (t.kind == Token::String) {
+        // adjacent string literals are concatenated
+        v.type = Value::String;
+        v.text = t.text;
+        while (peek().kind == Token::String) {
+            v.text += m_tokens[m_pos++].text;
+        }
+    } else if (t.kind == Token::Name) {
+        static const std::map<std::string, double> constants {
+            {"OneAtm", 1.01325e5}, {"OneBar", 1.0e5},
+            {"eV", 9.64853364595687e7}, {"ElectronMass", 9.10938291e-31}};
+        if (isOp(peek(), "(")) {
+            return parseCall(t);
+        } else if (m_variables.count(t.text)) {
+            return m_variables[t.text];
+        } else if (constants.count(t.text)) {
+            v.type = Value::Number;
+            v.number = constants.at(t.text);
+        } else if (t.text != "None") {
+            unsupported(t.line, "name '" + t.text + "'");
+        }
+    } else if (isOp(t, "(")) {
+        if (isOp(peek(), ")")) {
+            m_pos++;
+            v.type = Value::List;
+            return v;
+        }
+        v = parseExpression();
+        if (isOp(peek(), ",")) {
+            // tuple
+            Value first = v;
+            m_pos++;
+            v = parseSequence(")");
+            v.items.insert(v.items.begin(), first);
+        } else {
+            expectOp(")");
+        }
+    } else if (isOp(t, "[")) {
+        v = parseSequence("]");
+    } else {
+        unsupported(t.line, "unexpected '" + t.text + "'");
+    }
+    if (isOp(peek(), "[") || isOp(peek(), ".")) {
+        unsupported(peek().line, "indexing or attribute access");
+    }
+    return v;
+}
+
+Value CtiReader::parseSequence(const char* close)
+{
+    Value v;
+    v.type = Value::List;
+    while (!isOp(peek(), close)) {
+        v.items.push_back(parseExpression());
+        if (!isOp(peek(), close)) {
+            expectOp(",");
+        }
+    }
+    m_pos++;
+    return v;
+}
+
+Value CtiReader::parseCall(const Token& name)
+{
+    auto call = std::make_shared<Call>();
+    call->name = name.text;
+    call->line = name.line;
+    expectOp("(");
+    while (!isOp(peek(), ")")) {
+        if (peek().kind == Token::Name && isOp(peek(1), "=")) {
+            std::string key = peek().text;
+            m_pos += 2;
+            call->kwargs.emplace_back(key, parseExpression());
+        } else if (isOp(peek(), "*") || isOp(peek(), "**")) {
+            unsupported(peek().line, "argument unpacking");
+        } else if (!call->kwargs.empty()) {
+            unsupported(peek().line,
+                        "positional argument follows keyword argument");
+        } else {
+            call->args.push_back(parseExpression());
+        }
+        if (!isOp(peek(), ")")) {
+            expectOp(",");
+        }
+    }
+    m_pos++;
+    return evaluate(call);
+}
+
+Value CtiReader::binaryOp(const Value& a, const Value& b, const std::string& op,
+                          int line)
+{
+    Value v;
+    if (a.type == Value::Number && b.type == Value::Number) {
+        v.type = Value::Number;
+        v.isInt = a.isInt && b.isInt;
+        if (op == "+") {
+            v.number = a.number + b.number;
+        } else if (op == "-") {
+            v.number = a.number - b.number;
+        } else if (op == "*") {
+            v.number = a.number * b.number;
+        } else if (op == "/") {
+            if (b.number == 0.0) {
+                m_line = line;
+                error("division by zero");
+            }
+            v.number = a.number / b.number;
+            v.isInt = false;
+        } else {
+            v.number = std::pow(a.number, b.number);
+            v.isInt = v.isInt && b.number >= 0;
+        }
+        return v;
+    } else if (op == "+" && a.type == b.type
+               && (a.type == Value::String || a.type == Value::List)) {
+        v = a;
+        v.text += b.text;
+        v.items.insert(v.items.end(), b.items.begin(), b.items.end());
+        return v;
+    }
+    unsupported(line, "operands of '" + op + "'");
+    return v;
+}
+
+Value CtiReader::evaluate(std::shared_ptr<Call> call)
+{
+    static const std::set<std::string> phaseTypes {"ideal_gas",
+        "ideal_interface", "stoichiometric_solid", "stoichiometric_liquid"};
+    static const std::set<std::string> reactionTypes {"reaction",
+        "three_body_reaction", "falloff_reaction",
+        "chemically_activated_reaction", "pdep_arrhenius",
+        "chebyshev_reaction", "surface_reaction"};
+    static const std::set<std::string> embeddedTypes {"NASA", "NASA9",
+        "Shomate", "const_cp", "gas_transport", "Arrhenius", "stick", "Troe",
+        "SRI", "Lindemann", "state"};
+
+    m_line = call->line;
+    const std::string& f = call->name;
+    Value v;
+    if (f == "units") {
+        setUnits(*call);
+        return v;
+    } else if (f == "standard_pressure") {
+        Args args(*call, {"p0"});
+        m_pref = number(args.get("p0"), m_pref, "p0");
+        return v;
+    } else if (f == "validate") {
+        Args args(*call, {"species", "reactions"});
+        m_validateSpecies = string(args.get("species"), "yes", "species");
+        m_validateReactions = string(args.get("reactions"), "yes",
+                                     "reactions");
+        return v;
+    } else if (f == "element") {
+        Args args(*call, {"symbol", "atomic_mass", "atomic_number"});
+        m_elements.push_back(call);
+    } else if (f == "species") {
+        addSpecies(call);
+    } else if (phaseTypes.count(f)) {
+        addPhase(call);
+    } else if (reactionTypes.count(f)) {
+        addReaction(call);
+    } else if (!embeddedTypes.count(f)) {
+        unsupported(call->line, "entry type '" + f + "'");
+    }
+    v.type = Value::Object;
+    v.call = call;
+    return v;
+}
+
+// -------------------------------- Entries ---------------------------------
+
+void CtiReader::setUnits(const Call& call)
+{
+    Args args(call, {"length", "quantity", "mass", "time", "act_energy",
+                     "energy", "pressure"});
+    std::string* units[] = {&m_ulen, &m_umol, &m_umass, &m_utime, &m_ue,
+                            &m_uenergy, &m_upres};
+    const char* names[] = {"length", "quantity", "mass", "time", "act_energy",
+                           "energy", "pressure"};
+    for (size_t i = 0; i < 7; i++) {
+        std::string u = string(args.get(names[i]), "", names[i]);
+        if (!u.empty()) {
+            *units[i] = u;
+        }
+    }
+}
+
+void CtiReader::addPhase(std::shared_ptr<Call> call)
+{
+    PhaseEntry ph;
+    ph.call = call;
+    const std::string& f = call->name;
+    std::vector<std::string> names;
+    if (f == "ideal_gas") {
+        names = {"name", "elements", "species", "note", "reactions",
+                 "kinetics", "transport", "initial_state", "options"};
+        ph.dim = 3;
+    } else if (f == "ideal_interface") {
+        names = {"name", "elements", "species", "note", "reactions",
+                 "site_density", "phases", "kinetics", "transport",
+                 "initial_state", "options"};
+        ph.dim = 2;
+    } else {
+        names = {"name", "elements", "species", "note", "density",
+                 "transport", "initial_state", "options"};
+        ph.dim = 3;
+    }
+    Args args(*call, names);
+    ph.name = string(args.get("name"), "", "name");
+    ph.idealGas = (f == "ideal_gas");
+    if (f == "stoichiometric_solid" || f == "stoichiometric_liquid") {
+        ph.concMoles = 0;
+        ph.concLength = 0;
+        if (f == "stoichiometric_solid" && !args.get("density")) {
+            error("density must be specified.");
+        }
+    } else {
+        ph.concMoles = 1;
+        ph.concLength = -ph.dim;
+    }
+
+    for (const auto& sp : strings(args.get("species"), "species")) {
+        size_t icolon = sp.find(':');
+        if (icolon != npos && icolon > 0) {
+            ph.speciesArrays.emplace_back(
+                stripws(sp.substr(0, icolon)) + ".xml", sp.substr(icolon + 1));
+        } else {
+            ph.speciesArrays.emplace_back("", sp);
+        }
+        std::vector<std::string> tokens;
+        tokenizeString(ph.speciesArrays.back().second, tokens);
+        for (auto& s : tokens) {
+            if (s == ",") {
+                continue;
+            }
+            if (s[0] == ',') {
+                s = s.substr(1);
+            }
+            if (s.back() == ',') {
+                s.pop_back();
+            }
+            if (s != "all" && ph.species.count(s)) {
+                error("Multiply-declared species {} in phase {}", s, ph.name);
+            }
+            ph.species.insert(s);
+        }
+    }
+    if (ph.species.empty()) {
+        error("No species declared for phase {}", ph.name);
+    }
+    m_phases.push_back(ph);
+}
+
+void CtiReader::addSpecies(std::shared_ptr<Call> call)
+{
+    Args args(*call, {"name", "atoms", "note", "thermo", "transport",
+                      "charge", "size"});
+    SpeciesEntry sp;
+    sp.call = call;
+    sp.name = string(args.get("name"), "missing name!", "name");
+    std::string atoms = string(args.get("atoms"), "", "atoms");
+    std::replace(atoms.begin(), atoms.end(), ',', ' ');
+    std::vector<std::string> tokens;
+    tokenizeString(atoms, tokens);
+    Value electrons;
+    bool hasElectrons = false;
+    for (const auto& t : tokens) {
+        size_t icolon = t.find(':');
+        if (icolon == npos) {
+            error("Invalid atomic composition '{}' for species {}", t,
+                  sp.name);
+        }
+        std::string e = t.substr(0, icolon);
+        std::string count = t.substr(icolon + 1);
+        Value n;
+        n.type = Value::Number;
+        n.number = fpValueCheck(count);
+        n.isInt = (count.find_first_not_of("+-0123456789") == npos);
+        count = repr(n);
+        bool found = false;
+        for (auto& atom : sp.atoms) {
+            if (atom.first == e) {
+                atom.second = count;
+                found = true;
+            }
+        }
+        if (!found) {
+            sp.atoms.emplace_back(e, count);
+        }
+        if (e == "E") {
+            electrons = n;
+            hasElectrons = true;
+        }
+    }
+
+    const Value* charge = args.get("charge");
+    if (charge) {
+        double z = number(charge, 0.0, "charge");
+        if (hasElectrons && z != -electrons.number) {
+            error("specified charge inconsistent with number of electrons");
+        }
+        sp.charge = repr(*charge);
+    } else if (hasElectrons) {
+        electrons.number = -electrons.number + 0.0; // avoid "-0"
+        sp.charge = repr(electrons);
+    }
+    if (m_speciesNames.count(sp.name)) {
+        error("species {} multiply defined.", sp.name);
+    }
+    m_speciesNames.insert(sp.name);
+    m_species.push_back(sp);
+}
+
+Composition CtiReader::reactionSpecies(const std::string& equation)
+{
+    // Normalize formatting of falloff third bodies so that there is always a
+    // space following the '+', e.g. '(+M)' -> '(+ M)'. Only plus signs
+    // surrounded by spaces separate species, so that plus signs may be used
+    // in species names (e.g. 'Ar3+').
+    std::string s;
+    for (size_t i = 0; i < equation.size(); i++) {
+        s += equation[i];
+        if (equation.compare(i, 3, " (+") == 0) {
+            s += "(+ ";
+            i += 2;
+        }
+    }
+    size_t i;
+    while ((i = s.find(" + ")) != npos) {
+        s.replace(i, 3, " ");
+    }
+    std::vector<std::string> tokens;
+    tokenizeString(s, tokens);
+    Composition comp;
+    Value n;
+    n.type = Value::Number;
+    n.number = 1.0;
+    for (const auto& t : tokens) {
+        char* end;
+        double x = strtod(t.c_str(), &end);
+        if (*end == '\0' && !t.empty()) {
+            if (x < 0.0) {
+                error("negative stoichiometric coefficient:{}", equation);
+            }
+            n.number = x;
+            n.isInt = false;
+            continue;
+        }
+        bool found = false;
+        for (auto& sp : comp) {
+            if (sp.first == t) {
+                sp.second.number += n.number;
+                sp.second.isInt = sp.second.isInt && n.isInt;
+                found = true;
+            }
+        }
+        if (!found) {
+            comp.emplace_back(t, n);
+        }
+        // species without a coefficient are added as the integer 1
+        n.number = 1.0;
+        n.isInt = true;
+    }
+    return comp;
+}
+
+//! Remove the species *name* from the composition, and return true if it was
+//! present.
+bool removeSpecies(Composition& comp, const std::string& name)
+{
+    for (auto iter = comp.begin(); iter != comp.end(); ++iter) {
+        if (iter->first == name) {
+            comp.erase(iter);
+            return true;
+        }
+    }
+    return false;
+}
+
+void CtiReader::removeThirdBody(ReactionEntry& rxn)
+{
+    bool falloff = removeSpecies(rxn.reactants, "(+");
+    falloff = removeSpecies(rxn.products, "(+") && falloff;
+    if (rxn.type == "chebyshev") {
+        for (const char* m : {"M)", "m)"}) {
+            removeSpecies(rxn.reactants, m);
+            removeSpecies(rxn.products, m);
+        }
+        return;
+    } else if (!falloff) {
+        error("Missing falloff third body '(+ M)' in reaction '{}'",
+              rxn.equation);
+    }
+    if (removeSpecies(rxn.reactants, "M)")) {
+        removeSpecies(rxn.products, "M)");
+    } else if (removeSpecies(rxn.reactants, "m)")) {
+        removeSpecies(rxn.products, "m)");
+    } else {
+        Composition reactants = rxn.reactants;
+        for (const auto& r : reactants) {
+            const std::string& name = r.first;
+            if (name.back() == ')' && name.find('(') == npos) {
+                std::string species = name.substr(0, name.size() - 1);
+                if (!rxn.efficiencies.empty()) {
+                    error("(+ {}) and {} cannot both be specified", species,
+                          rxn.efficiencies);
+                }
+                rxn.efficiencies = species + ":1.0";
+                rxn.defaultEfficiency = 0.0;
+                removeSpecies(rxn.reactants, name);
+                removeSpecies(rxn.products, name);
+            }
+        }
+    }
+}
+
+void CtiReader::addReaction(std::shared_ptr<Call> call)
+{
+    const std::string& f = call->name;
+    ReactionEntry rxn;
+    rxn.call = call;
+    rxn.number = static_cast<int>(m_reactions.size()) + 1;
+    rxn.defaultEfficiency = 1.0;
+    rxn.explicitOrders = false;
+    std::unique_ptr<Args> args;
+    if (f == "reaction" || f == "surface_reaction") {
+        args.reset(new Args(*call, {"equation", "kf", "id", "order",
+                                    "options"}));
+        rxn.type = (f == "reaction") ? "" : "surface";
+        const Value* kf = args->get("kf");
+        if (!kf) {
+            error("Missing rate coefficient");
+        }
+        rxn.rates.push_back(*kf);
+    } else if (f == "three_body_reaction") {
+        args.reset(new Args(*call, {"equation", "kf", "efficiencies", "id",
+                                    "options"}));
+        rxn.type = "threeBody";
+        if (!args->get("kf")) {
+            error("Missing rate coefficient");
+        }
+        rxn.rates.push_back(*args->get("kf"));
+    } else if (f == "falloff_reaction" || f == "chemically_activated_reaction") {
+        bool falloff = (f == "falloff_reaction");
+        std::string k1 = falloff ? "kf" : "kLow";
+        std::string k2 = falloff ? "kf0" : "kHigh";
+        if (falloff) {
+            args.reset(new Args(*call, {"equation", "kf0", "kf",
+                "efficiencies", "falloff", "id", "options"}));
+        } else {
+            args.reset(new Args(*call, {"equation", "kLow", "kHigh",
+                "efficiencies", "falloff", "id", "options"}));
+        }
+        rxn.type = falloff ? "falloff" : "chemAct";
+        if (!args->get(k1) || !args->get(k2)) {
+            error("Missing rate coefficient");
+        }
+        rxn.rates.push_back(*args->get(k1));
+        rxn.rates.push_back(*args->get(k2));
+        if (args->get("falloff")) {
+            rxn.falloff = *args->get("falloff");
+        }
+    } else if (f == "pdep_arrhenius") {
+        args.reset(new Args(*call, {"equation", "id", "order", "options"},
+                            1, true));
+        rxn.type = "plog";
+        for (const Value* v : args->extra()) {
+            if (v->type != Value::List || v->items.size() != 4) {
+                error("P-log rate expressions must be sequences of four "
+                      "elements");
+            }
+            rxn.pressures.push_back(v->items[0]);
+            Value k;
+            k.type = Value::List;
+            k.items.assign(v->items.begin() + 1, v->items.end());
+            rxn.rates.push_back(k);
+        }
+    } else {
+        args.reset(new Args(*call, {"equation", "Tmin", "Tmax", "Pmin",
+                                    "Pmax", "coeffs", "id", "order",
+                                    "options"}, 6));
+        rxn.type = "chebyshev";
+        Value defaultP;
+        defaultP.type = Value::List;
+        defaultP.items.resize(2);
+        defaultP.items[0].type = Value::Number;
+        defaultP.items[1].type = Value::String;
+        defaultP.items[1].text = "atm";
+        rxn.Tmin.type = rxn.Tmax.type = Value::Number;
+        rxn.Tmin.number = 300.0;
+        rxn.Tmax.number = 2500.0;
+        rxn.Pmin = rxn.Pmax = defaultP;
+        rxn.Pmin.items[0].number = 0.001;
+        rxn.Pmax.items[0].number = 100.0;
+        for (auto p : {std::make_pair("Tmin", &rxn.Tmin),
+                       std::make_pair("Tmax", &rxn.Tmax),
+                       std::make_pair("Pmin", &rxn.Pmin),
+                       std::make_pair("Pmax", &rxn.Pmax)}) {
+            if (args->get(p.first)) {
+                *p.second = *args->get(p.first);
+            }
+        }
+        const Value* coeffs = args->get("coeffs");
+        if (!coeffs || coeffs->type != Value::List || coeffs->items.empty()) {
+            error("Missing Chebyshev coefficients");
+        }
+        for (const auto& row : coeffs->items) {
+            rxn.chebCoeffs.push_back(numbers(row, "coeffs"));
+        }
+        if (rxn.chebCoeffs[0].empty()) {
+            error("Missing Chebyshev coefficients");
+        }
+    }
+
+    rxn.equation = string(args->get("equation"), "", "equation");
+    rxn.id = string(args->get("id"), "", "id");
+    rxn.options = strings(args->get("options"), "options");
+    if (args->get("efficiencies")) {
+        rxn.efficiencies = string(args->get("efficiencies"), "",
+                                  "efficiencies");
+    }
+
+    std::string r, p;
+    bool found = false;
+    for (std::string sep : {"<=>", "=>", "="}) {
+        size_t i = rxn.equation.find(sep);
+        if (i != npos) {
+            if (rxn.equation.find(sep, i + 1) != npos) {
+                error("Invalid reaction equation '{}'", rxn.equation);
+            }
+            r = rxn.equation.substr(0, i);
+            p = rxn.equation.substr(i + sep.size());
+            rxn.reversible = (sep != "=>");
+            found = true;
+            break;
+        }
+    }
+    if (!found) {
+        error("Invalid reaction equation '{}'", rxn.equation);
+    }
+    rxn.reactants = reactionSpecies(r);
+    rxn.products = reactionSpecies(p);
+    rxn.orders = rxn.reactants;
+    std::string order = string(args->get("order"), "", "order");
+    if (!order.empty()) {
+        rxn.explicitOrders = true;
+        std::vector<std::string> tokens;
+        tokenizeString(order, tokens);
+        for (const auto& t : tokens) {
+            size_t icolon = t.find(':');
+            if (icolon == npos) {
+                error("Invalid reaction order '{}'", t);
+            }
+            std::string name = t.substr(0, icolon);
+            double value = fpValueCheck(t.substr(icolon + 1));
+            bool isReactant = false;
+            for (auto& o : rxn.orders) {
+                if (o.first == name) {
+                    o.second.number = value;
+                    o.second.isInt = false;
+                    isReactant = true;
+                }
+            }
+            if (!isReactant) {
+                error("order specified for non-reactant: {}", name);
+            }
+        }
+    }
+
+    if (rxn.type == "threeBody") {
+        for (const char* m : {"M", "m"}) {
+            removeSpecies(rxn.reactants, m);
+            removeSpecies(rxn.products, m);
+        }
+    } else if (rxn.type == "falloff" || rxn.type == "chemAct"
+               || rxn.type == "chebyshev") {
+        removeThirdBody(rxn);
+    }
+    m_reactions.push_back(rxn);
+}
+
+// ------------------------- Building the CTML tree -------------------------
+
+void CtiReader::build(XML_Node& root)
+{
+    root.setName("ctml");
+    XML_Node& v = root.addChild("validate");
+    v.addAttribute("species", m_validateSpecies);
+    v.addAttribute("reactions", m_validateReactions);
+
+    if (!m_elements.empty()) {
+        XML_Node& ed = root.addChild("elementData");
+        for (const auto& call : m_elements) {
+            m_line = call->line;
+            Args args(*call, {"symbol", "atomic_mass", "atomic_number"});
+            XML_Node& e = ed.addChild("element");
+            e.addAttribute("name", string(args.get("symbol"), "", "symbol"));
+            Value mass, z;
+            mass.type = z.type = Value::Number;
+            mass.number = 0.01;
+            z.isInt = true;
+            e.addAttribute("atomicWt",
+                repr(args.get("atomic_mass") ? *args.get("atomic_mass") : mass));
+            e.addAttribute("atomicNumber",
+                repr(args.get("atomic_number") ? *args.get("atomic_number") : z));
+        }
+    }
+
+    for (const auto& ph : m_phases) {
+        buildPhase(root, ph);
+    }
+
+    root.addComment("     species definitions     ");
+    XML_Node& sd = root.addChild("speciesData");
+    sd.addAttribute("id", "species_data");
+    for (const auto& sp : m_species) {
+        buildSpecies(sd, sp);
+    }
+
+    XML_Node& rd = root.addChild("reactionData");
+    rd.addAttribute("id", "reaction_data");
+    for (auto& rxn : m_reactions) {
+        buildReaction(rd, rxn);
+    }
+}
+
+void CtiReader::buildPhase(XML_Node& parent, const PhaseEntry& phase)
+{
+    m_line = phase.call->line;
+    const std::string& f = phase.call->name;
+    Args args(*phase.call, {"name", "elements", "species", "note", "reactions",
+        "site_density", "phases", "kinetics", "transport", "initial_state",
+        "options", "density"});
+    std::vector<std::string> options = strings(args.get("options"), "options");
+    auto hasOption = [&](const char* opt) {
+        return std::find(options.begin(), options.end(), opt) != options.end();
+    };
+
+    parent.addComment("    phase " + phase.name + "     ");
+    XML_Node& ph = parent.addChild("phase");
+    ph.addAttribute("id", phase.name);
+    ph.addAttribute("dim", phase.dim);
+
+    ph.addChild("elementArray", string(args.get("elements"), "", "elements"))
+        .addAttribute("datasrc", "elements.xml");
+    for (const auto& sa : phase.speciesArrays) {
+        XML_Node& s = ph.addChild("speciesArray", stripws(sa.second));
+        s.addAttribute("datasrc", sa.first + "#species_data");
+        if (hasOption("skip_undeclared_elements")) {
+            s.addChild("skip").addAttribute("element", "undeclared");
+        }
+    }
+
+    std::vector<std::string> reactions = strings(args.get("reactions"),
+                                                 "reactions");
+    if (reactions.empty() && !args.get("reactions")) {
+        reactions.push_back("none");
+    }
+    if (reactions.size() != 1 || reactions[0] != "none") {
+        for (const auto& r : reactions) {
+            std::string datasrc, rnum = r;
+            size_t icolon = r.find(':');
+            if (icolon != npos && icolon > 0) {
+                datasrc = stripws(r.substr(0, icolon)) + ".xml";
+                rnum = r.substr(icolon + 1);
+            }
+            XML_Node& ra = ph.addChild("reactionArray");
+            ra.addAttribute("datasrc", datasrc + "#reaction_data");
+            XML_Node* skip = nullptr;
+            if (hasOption("skip_undeclared_species")) {
+                skip = &ra.addChild("skip");
+                skip->addAttribute("species", "undeclared");
+            }
+            if (hasOption("skip_undeclared_third_bodies")) {
+                if (!skip) {
+                    skip = &ra.addChild("skip");
+                }
+                skip->addAttribute("third_bodies", "undeclared");
+            }
+            std::vector<std::string> rtoks;
+            tokenizeString(rnum, rtoks);
+            if (rtoks.empty()) {
+                error("Invalid reactions specification '{}'", r);
+            }
+            if (rtoks[0] != "all") {
+                XML_Node& inc = ra.addChild("include");
+                inc.addAttribute("min", rtoks[0]);
+                if (rtoks.size() > 2 && (rtoks[1] == "to" || rtoks[1] == "-")) {
+                    inc.addAttribute("max", rtoks[2]);
+                } else {
+                    inc.addAttribute("max", rtoks[0]);
+                }
+            }
+        }
+    }
+
+    if (args.get("initial_state")) {
+        buildState(ph, *args.get("initial_state"));
+    }
+    std::string note = string(args.get("note"), "", "note");
+    if (!note.empty()) {
+        ph.addChild("note", note);
+    }
+    XML_Node& thermo = ph.addChild("thermo");
+    if (hasOption("allow_discontinuous_thermo")) {
+        thermo.addAttribute("allow_discontinuities", "true");
+    }
+
+    std::string transport = string(args.get("transport"), "None",
+                                   "transport");
+    if (f == "ideal_gas") {
+        thermo.addAttribute("model", "IdealGas");
+        ph.addChild("kinetics").addAttribute("model",
+            string(args.get("kinetics"), "GasKinetics", "kinetics"));
+        ph.addChild("transport").addAttribute("model", transport);
+    } else if (f == "ideal_interface") {
+        thermo.addAttribute("model", "Surface");
+        Value zero;
+        zero.type = Value::Number;
+        const Value* sdens = args.get("site_density");
+        addFloat(thermo, "site_density", sdens ? *sdens : zero, "",
+                 m_umol + "/" + m_ulen + "2");
+        ph.addChild("kinetics").addAttribute("model",
+            string(args.get("kinetics"), "Interface", "kinetics"));
+        ph.addChild("transport").addAttribute("model", transport);
+        const Value* phases = args.get("phases");
+        ph.addChild("phaseArray",
+            (phases && phases->type == Value::String) ? phases->text : "");
+    } else {
+        thermo.addAttribute("model", "StoichSubstance");
+        Value density;
+        density.type = Value::Number;
+        density.number = -1.0;
+        if (args.get("density")) {
+            density = *args.get("density");
+        }
+        addFloat(thermo, "density", density, "", m_umass + "/" + m_ulen + "3");
+        if (!transport.empty()) {
+            ph.addChild("transport").addAttribute("model", transport);
+        }
+        ph.addChild("kinetics").addAttribute("model", "none");
+    }
+}
+
+void CtiReader::buildState(XML_Node& node, const Value& state)
+{
+    if (state.type != Value::Object || state.call->name != "state") {
+        error("initial_state must be a 'state' entry");
+    }
+    Args args(*state.call, {"temperature", "pressure", "mole_fractions",
+        "mass_fractions", "density", "coverages", "solute_molalities"});
+    XML_Node& st = node.addChild("state");
+    if (truthy(args.get("temperature"))) {
+        addFloat(st, "temperature", *args.get("temperature"), "", "K");
+    }
+    if (truthy(args.get("pressure"))) {
+        addFloat(st, "pressure", *args.get("pressure"), "", m_upres);
+    }
+    if (truthy(args.get("density"))) {
+        addFloat(st, "density", *args.get("density"), "",
+                 m_umass + "/" + m_ulen + "3");
+    }
+    const char* names[] = {"mole_fractions", "mass_fractions", "coverages",
+                           "solute_molalities"};
+    const char* tags[] = {"moleFractions", "massFractions", "coverages",
+                          "soluteMolalities"};
+    for (size_t i = 0; i < 4; i++) {
+        if (truthy(args.get(names[i]))) {
+            st.addChild(tags[i], string(args.get(names[i]), "", names[i]));
+        }
+    }
+}
+
+void CtiReader::buildSpecies(XML_Node& parent, const SpeciesEntry& sp)
+{
+    m_line = sp.call->line;
+    Args args(*sp.call, {"name", "atoms", "note", "thermo", "transport",
+                         "charge", "size"});
+    parent.addComment("    species " + sp.name + "    ");
+    XML_Node& s = parent.addChild("species");
+    s.addAttribute("name", sp.name);
+    std::string atoms;
+    for (const auto& a : sp.atoms) {
+        atoms += a.first + ":" + a.second + " ";
+    }
+    s.addChild("atomArray", stripws(atoms));
+    std::string note = string(args.get("note"), "", "note");
+    if (!note.empty()) {
+        s.addChild("note", note);
+    }
+    if (!sp.charge.empty()) {
+        s.addChild("charge", sp.charge);
+    }
+    const Value* size = args.get("size");
+    if (size && number(size, 1.0, "size") != 1.0) {
+        s.addChild("size", repr(*size));
+    }
+
+    XML_Node& thermo = s.addChild("thermo");
+    const Value* t = args.get("thermo");
+    if (!t) {
+        auto call = std::make_shared<Call>();
+        call->name = "const_cp";
+        call->line = m_line;
+        Value v;
+        v.type = Value::Object;
+        v.call = call;
+        buildThermo(thermo, v);
+    } else if (t->type == Value::List) {
+        for (const auto& item : t->items) {
+            buildThermo(thermo, item);
+        }
+    } else {
+        buildThermo(thermo, *t);
+    }
+
+    const Value* tr = args.get("transport");
+    if (tr) {
+        XML_Node& transport = s.addChild("transport");
+        if (tr->type == Value::List) {
+            for (const auto& item : tr->items) {
+                buildTransport(transport, item);
+            }
+        } else {
+            buildTransport(transport, *tr);
+        }
+    }
+}
+
+void CtiReader::buildThermo(XML_Node& node, const Value& thermo)
+{
+    if (thermo.type != Value::Object) {
+        error("Invalid species thermo entry");
+    }
+    const Call& call = *thermo.call;
+    std::string energyUnits = m_uenergy + "/" + m_umol;
+    if (call.name == "const_cp") {
+        Args args(call, {"t0", "cp0", "h0", "s0", "tmax", "tmin"});
+        XML_Node& c = node.addChild("const_cp");
+        double tmin = number(args.get("tmin"), 100.0, "tmin");
+        double tmax = number(args.get("tmax"), 5000.0, "tmax");
+        if (tmin >= 0.0) {
+            c.addAttribute("Tmin", args.get("tmin") ? repr(*args.get("tmin"))
+                                                    : pyrepr(tmin));
+        }
+        if (tmax >= 0.0) {
+            c.addAttribute("Tmax", args.get("tmax") ? repr(*args.get("tmax"))
+                                                    : pyrepr(tmax));
+        }
+        const char* names[] = {"t0", "h0", "s0", "cp0"};
+        std::string units[] = {"K", energyUnits, energyUnits + "/K",
+                               energyUnits + "/K"};
+        for (size_t i = 0; i < 4; i++) {
+            Value v;
+            v.type = Value::Number;
+            v.number = (i == 0) ? 298.15 : 0.0;
+            if (args.get(names[i])) {
+                v = *args.get(names[i]);
+            }
+            addFloat(c, names[i], v, "", units[i]);
+        }
+        return;
+    }
+
+    size_t ncoeffs;
+    if (call.name == "NASA" || call.name == "Shomate") {
+        ncoeffs = 7;
+    } else if (call.name == "NASA9") {
+        ncoeffs = 9;
+    } else {
+        error("Invalid species thermo entry '{}'", call.name);
+    }
+    Args args(call, {"Trange", "coeffs", "p0"});
+    const Value* Trange = args.get("Trange");
+    if (!Trange || Trange->type != Value::List || Trange->items.size() != 2) {
+        error("{} temperature range must have two elements", call.name);
+    }
+    vector_fp c;
+    if (args.get("coeffs")) {
+        c = numbers(*args.get("coeffs"), "coeffs");
+    }
+    if (c.size() != ncoeffs) {
+        error("{} coefficient list must have length = {}", call.name,
+              ncoeffs);
+    }
+    XML_Node& n = node.addChild(call.name);
+    n.addAttribute("Tmin", repr(Trange->items[0]));
+    n.addAttribute("Tmax", repr(Trange->items[1]));
+    const Value* p0 = args.get("p0");
+    if (number(p0, -1.0, "p0") <= 0.0) {
+        n.addAttribute("P0", pyrepr(m_pref));
+    } else {
+        n.addAttribute("P0", repr(*p0));
+    }
+    std::string s;
+    for (size_t i = 0; i < 4; i++) {
+        s += fmt::sprintf("%17.9E, ", c[i]);
+    }
+    s += "\n";
+    if (ncoeffs == 7) {
+        s += fmt::sprintf("%17.9E, %17.9E, %17.9E", c[4], c[5], c[6]);
+    } else {
+        s += fmt::sprintf("%17.9E, %17.9E, %17.9E, %17.9E,", c[4], c[5], c[6],
+                          c[7]);
+        s += "\n" + fmt::sprintf("%17.9E", c[8]);
+    }
+    XML_Node& u = n.addChild("floatArray", stripws(s));
+    u.addAttribute("size", fmt::format("{}", ncoeffs));
+    u.addAttribute("name", "coeffs");
+}
+
+void CtiReader::buildTransport(XML_Node& node, const Value& transport)
+{
+    if (transport.type != Value::Object
+        || transport.call->name != "gas_transport") {
+        error("Invalid species transport entry");
+    }
+    Args args(*transport.call, {"geom", "diam", "well_depth", "dipole",
+                                "polar", "rot_relax", "acentric_factor"});
+    node.addAttribute("model", "gas_transport");
+    node.addChild("string", string(args.get("geom"), "", "geom"))
+        .addAttribute("title", "geometry");
+    node.addChild("LJ_welldepth", fmt::sprintf("%8.3f",
+        number(args.get("well_depth"), 0.0, "well_depth")))
+        .addAttribute("units", "K");
+    node.addChild("LJ_diameter", fmt::sprintf("%8.3f",
+        number(args.get("diam"), 0.0, "diam")))
+        .addAttribute("units", "A");
+    node.addChild("dipoleMoment", fmt::sprintf("%8.3f",
+        number(args.get("dipole"), 0.0, "dipole")))
+        .addAttribute("units", "Debye");
+    node.addChild("polarizability", fmt::sprintf("%8.3f",
+        number(args.get("polar"), 0.0, "polar")))
+        .addAttribute("units", "A3");
+    node.addChild("rotRelax", fmt::sprintf("%8.3f",
+        number(args.get("rot_relax"), 0.0, "rot_relax")));
+    if (args.get("acentric_factor")) {
+        node.addChild("acentric_factor", fmt::sprintf("%8.3f",
+            number(args.get("acentric_factor"), 0.0, "acentric_factor")));
+    }
+}
+
+double CtiReader::unitFactor(double mdim, double ldim)
+{
+    static const std::map<std::string, double> length {
+        {"cm", 0.01}, {"m", 1.0}, {"mm", 0.001}};
+    static const std::map<std::string, double> moles {
+        {"kmol", 1.0}, {"mol", 0.001}, {"molec", 1.0/6.02214129e26}};
+    static const std::map<std::string, double> time {
+        {"s", 1.0}, {"min", 60.0}, {"hr", 3600.0}};
+    if (!length.count(m_ulen) || !moles.count(m_umol)
+        || !time.count(m_utime)) {
+        error("Unknown units '{}', '{}' or '{}' for rate coefficients",
+              m_ulen, m_umol, m_utime);
+    }
+    return std::pow(length.at(m_ulen), -ldim) *
+           std::pow(moles.at(m_umol), -mdim) / time.at(m_utime);
+}
+
+void CtiReader::buildReaction(XML_Node& parent, ReactionEntry& rxn)
+{
+    m_line = rxn.call->line;
+    std::string id = rxn.id.empty() ? fmt::sprintf("%04i", rxn.number)
+                                    : rxn.id;
+    double mdim = 0, ldim = 0;
+    std::vector<std::string> gasSpecies;
+    std::vector<const PhaseEntry*> rxnPhases;
+    const PhaseEntry* rxnPhase = nullptr;
+    int dims[4] = {0, 0, 0, 0};
+    for (const auto& r : rxn.reactants) {
+        double order = 0.0;
+        for (const auto& o : rxn.orders) {
+            if (o.first == r.first) {
+                order = o.second.number;
+            }
+        }
+        int nm = 1;
+        int nl = -3;
+        if (!m_phases.empty()) {
+            int mindim = 4;
+            bool found = false;
+            for (const auto& ph : m_phases) {
+                if (ph.species.count(r.first)) {
+                    nm = ph.concMoles;
+                    nl = ph.concLength;
+                    if (ph.idealGas) {
+                        gasSpecies.push_back(r.first);
+                    }
+                    if (std::find(rxnPhases.begin(), rxnPhases.end(), &ph)
+                            == rxnPhases.end()) {
+                        rxnPhases.push_back(&ph);
+                        dims[ph.dim]++;
+                        if (ph.dim < mindim) {
+                            rxnPhase = &ph;
+                            mindim = ph.dim;
+                        }
+                    }
+                    found = true;
+                    break;
+                }
+            }
+            if (!found) {
+                error("species {} not found", r.first);
+            }
+        }
+        mdim += nm * order;
+        ldim += nl * order;
+    }
+
+    parent.addComment("   reaction " + id + "    ");
+    XML_Node& r = parent.addChild("reaction");
+    r.addAttribute("id", id);
+    r.addAttribute("reversible", rxn.reversible ? "yes" : "no");
+    for (const char* opt : {"duplicate", "negative_A", "negative_orders"}) {
+        if (std::find(rxn.options.begin(), rxn.options.end(), opt)
+                != rxn.options.end()) {
+            r.addAttribute(opt, "yes");
+        }
+    }
+    std::string eq = rxn.equation;
+    std::replace(eq.begin(), eq.end(), '<', '[');
+    std::replace(eq.begin(), eq.end(), '>', ']');
+    r.addChild("equation", stripws(eq));
+    if (rxn.explicitOrders) {
+        for (const auto& o : rxn.orders) {
+            r.addChild("order", repr(o.second))
+                .addAttribute("species", o.first);
+        }
+    }
+
+    // adjust the moles and length powers based on the dimensions of the rate
+    // of progress (moles/length^2 or moles/length^3)
+    if (rxn.type == "surface") {
+        mdim -= 1;
+        ldim += 2;
+        if (dims[0] != 0 || dims[1] != 0 || dims[2] > 1) {
+            error("{}\nA surface reaction may contain at most one surface "
+                  "phase.", rxn.equation);
+        }
+    } else {
+        mdim -= 1;
+        ldim += 3;
+    }
+    if (!rxn.type.empty()) {
+        r.addAttribute("type", rxn.type);
+    }
+    XML_Node& kfnode = r.addChild("rateCoeff");
+    if (rxn.type == "threeBody") {
+        mdim += 1;
+        ldim -= 3;
+    }
+
+    std::string name;
+    for (const auto& kf : rxn.rates) {
+        buildArrhenius(kfnode, kf, name, unitFactor(mdim, ldim), gasSpecies,
+                       rxnPhase);
+        if (rxn.type == "falloff") {
+            // low-pressure rate coefficient
+            mdim += 1;
+            ldim -= 3;
+            name = "k0";
+        } else if (rxn.type == "chemAct") {
+            // high-pressure rate coefficient
+            mdim -= 1;
+            ldim += 3;
+            name = "kHigh";
+        }
+    }
+
+    std::string rstr, pstr;
+    for (const auto& sp : rxn.reactants) {
+        rstr += (rstr.empty() ? "" : " ") + sp.first + ":" + repr(sp.second);
+    }
+    for (const auto& sp : rxn.products) {
+        pstr += (pstr.empty() ? "" : " ") + sp.first + ":" + repr(sp.second);
+    }
+    r.addChild("reactants", rstr);
+    r.addChild("products", pstr);
+
+    if (rxn.type == "threeBody" || rxn.type == "falloff"
+        || rxn.type == "chemAct") {
+        if (!rxn.efficiencies.empty()) {
+            kfnode.addChild("efficiencies", rxn.efficiencies)
+                .addAttribute("default", pyrepr(rxn.defaultEfficiency));
+        }
+        if (rxn.type != "threeBody") {
+            buildFalloff(kfnode, rxn.falloff);
+        }
+    } else if (rxn.type == "plog") {
+        std::vector<XML_Node*> rates = kfnode.getChildren("Arrhenius");
+        for (size_t i = 0; i < rates.size(); i++) {
+            addFloat(*rates[i], "P", rxn.pressures[i]);
+        }
+    } else if (rxn.type == "chebyshev") {
+        addFloat(kfnode, "Tmin", rxn.Tmin);
+        addFloat(kfnode, "Tmax", rxn.Tmax);
+        addFloat(kfnode, "Pmin", rxn.Pmin);
+        addFloat(kfnode, "Pmax", rxn.Pmax);
+        std::vector<vector_fp> coeffs = rxn.chebCoeffs;
+        coeffs[0][0] += std::log10(unitFactor(mdim, ldim));
+        std::string s;
+        for (size_t i = 0; i < coeffs.size(); i++) {
+            for (size_t j = 0; j < coeffs[i].size(); j++) {
+                s += fmt::sprintf("%12.5e", coeffs[i][j]);
+                s += (j + 1 < coeffs[i].size()) ? ", " : "";
+            }
+            s += (i + 1 < coeffs.size()) ? ",\n" : "";
+        }
+        XML_Node& c = kfnode.addChild("floatArray", stripws(s));
+        c.addAttribute("name", "coeffs");
+        c.addAttribute("degreeT", fmt::format("{}", coeffs.size()));
+        c.addAttribute("degreeP", fmt::format("{}", coeffs[0].size()));
+    }
+}
+
+void CtiReader::buildArrhenius(XML_Node& node, const Value& rate,
+                               const std::string& name, double unitFactor,
+                               const std::vector<std::string>& gasSpecies,
+                               const PhaseEntry* rxnPhase)
+{
+    Value A, b, E;
+    A.type = b.type = E.type = Value::Number;
+    const Value* coverage = nullptr;
+    bool stick = false;
+    if (rate.type == Value::Object
+        && (rate.call->name == "Arrhenius" || rate.call->name == "stick")) {
+        Args args(*rate.call, {"A", "b", "E", "coverage"});
+        A = args.get("A") ? *args.get("A") : A;
+        b = args.get("b") ? *args.get("b") : b;
+        E = args.get("E") ? *args.get("E") : E;
+        coverage = args.get("coverage");
+        stick = (rate.call->name == "stick");
+    } else if (rate.type == Value::List && rate.items.size() >= 3) {
+        A = rate.items[0];
+        b = rate.items[1];
+        E = rate.items[2];
+    } else {
+        error("Invalid rate coefficient");
+    }
+
+    XML_Node& a = node.addChild("Arrhenius");
+    if (stick) {
+        a.addAttribute("type", "stick");
+        if (gasSpecies.size() != 1) {
+            error("Sticking probabilities can only be used for reactions "
+                  "with one gas-phase reactant, but this reaction has {}",
+                  gasSpecies.size());
+        }
+        a.addAttribute("species", gasSpecies[0]);
+        unitFactor = 1.0;
+    }
+    if (!name.empty()) {
+        a.addAttribute("name", name);
+    }
+
+    // if a pure number is entered for A, multiply by the conversion factor to
+    // SI. Otherwise, pass it as-is through to CTML with the unit string.
+    if (A.type == Value::Number) {
+        A.number *= unitFactor;
+        A.isInt = false;
+        addFloat(a, "A", A, "%14.6E");
+    } else if (A.type == Value::List && A.items.size() == 2
+               && A.items[1].type == Value::String
+               && A.items[1].text == "/site") {
+        const Value* sdens = nullptr;
+        if (rxnPhase) {
+            Args args(*rxnPhase->call, {"name", "elements", "species", "note",
+                "reactions", "site_density", "phases", "kinetics",
+                "transport", "initial_state", "options", "density"});
+            sdens = args.get("site_density");
+        }
+        Value a0;
+        a0.type = Value::Number;
+        a0.number = number(&A.items[0], 0.0, "A") /
+                    number(sdens, 0.0, "site_density");
+        addFloat(a, "A", a0, "%14.6E");
+    } else {
+        addFloat(a, "A", A, "%14.6E");
+    }
+    a.addChild("b", repr(b));
+    addFloat(a, "E", E, "%f", m_ue);
+
+    if (coverage) {
+        std::vector<Value> covs;
+        if (coverage->type != Value::List) {
+            error("Invalid coverage dependency");
+        } else if (!coverage->items.empty()
+                   && coverage->items[0].type == Value::String) {
+            covs.push_back(*coverage);
+        } else {
+            covs = coverage->items;
+        }
+        for (const auto& cov : covs) {
+            if (cov.type != Value::List || cov.items.size() != 4) {
+                error("Incorrect number of coverage parameters");
+            }
+            XML_Node& c = a.addChild("coverage");
+            c.addAttribute("species", string(&cov.items[0], "", "species"));
+            addFloat(c, "a", cov.items[1], "%f");
+            c.addChild("m", repr(cov.items[2]));
+            addFloat(c, "e", cov.items[3], "%f", m_ue);
+        }
+    }
+}
+
+void CtiReader::buildFalloff(XML_Node& node, const Value& falloff)
+{
+    if (falloff.type == Value::None || falloff.call->name == "Lindemann") {
+        node.addChild("falloff").addAttribute("type", "Lindemann");
+        return;
+    } else if (falloff.type != Value::Object
+               || (falloff.call->name != "Troe"
+                   && falloff.call->name != "SRI")) {
+        error("Invalid falloff function");
+    }
+    const Call& call = *falloff.call;
+    std::vector<std::string> names;
+    if (call.name == "Troe") {
+        names = {"A", "T3", "T1", "T2"};
+    } else {
+        names = {"A", "B", "C", "D", "E"};
+    }
+    Args args(call, names);
+    vector_fp c;
+    for (const auto& name : names) {
+        c.push_back(number(args.get(name), (c.size() < 3) ? 0.0 : -999.9,
+                           name.c_str()));
+    }
+    if (call.name == "Troe" && c[3] == -999.9) {
+        c.resize(3);
+    } else if (call.name == "SRI" && (c[3] == -999.9 || c[4] == -999.9)) {
+        c.resize(3);
+    }
+    std::string s;
+    for (double x : c) {
+        s += fmt::sprintf("%g ", x);
+    }
+    node.addChild("falloff", stripws(s)).addAttribute("type", call.name);
+}
+
+void CtiReader::addFloat(XML_Node& node, const std::string& name,
+                         const Value& val, const std::string& fmt,
+                         const std::string& defunits)
+{
+    if (val.type == Value::Number) {
+        XML_Node& c = node.addChild(name, stripws(fmt.empty() ?
+            pyrepr(val.number) : fmt::sprintf(fmt, val.number)));
+        if (!defunits.empty()) {
+            c.addAttribute("units", defunits);
+        }
+    } else if (val.type == Value::List && val.items.size() >= 2
+               && val.items[0].type == Value::Number
+               && val.items[1].type == Value::String) {
+        const Value& v = val.items[0];
+        XML_Node& c = node.addChild(name, stripws(fmt.empty() ?
+            repr(v) : fmt::sprintf(fmt, v.number)));
+        c.addAttribute("units", val.items[1].text);
+    } else {
+        error("Invalid value for '{}': expected a number or a "
+              "(value, units) pair", name);
+    }
+}
+
+// ---------------------------- Value conversion ----------------------------
+
+double CtiReader::number(const Value* v, double default_value, const char* what)
+{
+    if (!v) {
+        return default_value;
+    } else if (v->type != Value::Number) {
+        error("Expected a number for '{}'", what);
+    }
+    return v->number;
+}
+
+std::string CtiReader::string(const Value* v, const std::string& default_value,
+                              const char* what)
+{
+    if (!v) {
+        return default_value;
+    } else if (v->type != Value::String) {
+        error("Expected a string for '{}'", what);
+    }
+    return v->text;
+}
+
+std::vector<std::string> CtiReader::strings(const Value* v, const char* what)
+{
+    std::vector<std::string> s;
+    if (v && v->type == Value::List) {
+        for (const auto& item : v->items) {
+            s.push_back(string(&item, "", what));
+        }
+    } else if (v) {
+        s.push_back(string(v, "", what));
+    }
+    return s;
+}
+
+vector_fp CtiReader::numbers(const Value& v, const char* what)
+{
+    if (v.type != Value::List) {
+        error("Expected a sequence of numbers for '{}'", what);
+    }
+    vector_fp x;
+    for (const auto& item : v.items) {
+        x.push_back(number(&item, 0.0, what));
+    }
+    return x;
+}
+
+std::string CtiReader::repr(const Value& v)
+{
+    if (v.type != Value::Number) {
+        error("Expected a number");
+    }
+    return v.isInt ? fmt::format("{:.0f}", v.number) : pyrepr(v.number);
+}
+
+bool CtiReader::truthy(const Value* v)
+{
+    if (!v) {
+        return false;
+    } else if (v->type == Value::Number) {
+        return v->number != 0.0;
+    } else if (v->type == Value::String) {
+        return !v->text.empty();
+    } else if (v->type == Value::List) {
+        return !v->items.empty();
+    }
+    return true;
+}
+
+}
+
+bool ct2ctml_native(const std::string& text, XML_Node& root, bool isfile)
+{
+    std::string cti = text;
+    std::string file = "<string>";
+    if (isfile) {
+        file = text;
+        std::ifstream in(file, std::ios::binary);
+        if (!in) {
+            throw CanteraError("ct2ctml_native",
+                               "cannot open " + file + " for reading.");
+        }
+        std::stringstream buffer;
+        buffer << in.rdbuf();
+        cti = buffer.str();
+    }
+    CtiReader reader(cti, file);
+    try {
+        reader.parse();
+    } catch (CtiUnsupported&) {
+        return false;
+    }
+    reader.build(root);
+    return true;
+}
+
+}
@@ -53,8 +53,9 @@ public:
      * @param units_ activation energy units
      */
     doublereal actEnergyToSI(const std::string& units_) {
-        if (m_act_u.find(units_) != m_act_u.end()) {
-            return m_act_u[units_];
+        auto iter = m_act_u.find(units_);
+        if (iter != m_act_u.end()) {
+            return iter->second;
         } else {
             return toSI(units_);
         }
@@ -93,31 +94,31 @@ public:
                 fctr = 1.0;
             } else if (tok[tsize - 1] == '2') {
                 tsub = tok.substr(0,tsize-1);
-                fctr = m_u[tsub];
+                fctr = unitValue(tsub);
                 fctr *= fctr;
             } else if (tok[tsize - 1] == '3') {
                 tsub = tok.substr(0,tsize-1);
-                fctr = m_u[tsub];
+                fctr = unitValue(tsub);
                 fctr *= fctr*fctr;
             } else if (tok[tsize - 1] == '4') {
                 tsub = tok.substr(0,tsize-1);
-                fctr = m_u[tsub];
+                fctr = unitValue(tsub);
                 fctr *= fctr*fctr*fctr;
             } else if (tok[tsize - 1] == '5') {
                 tsub = tok.substr(0,tsize-1);
-                fctr = m_u[tsub];
+                fctr = unitValue(tsub);
                 fctr *= fctr*fctr*fctr*fctr;
             } else if (tok[tsize - 1] == '6') {
                 tsub = tok.substr(0,tsize-1);
-                fctr = m_u[tsub];
+                fctr = unitValue(tsub);
                 fctr *= fctr*fctr*fctr*fctr*fctr;
             } else {
                 tsub = tok;
-                fctr = m_u[tok];
+                fctr = unitValue(tok);
             }
 
             // tok is not one of the entries in map m_u, then
-            // m_u[tok] returns 0.0. Check for this.
+            // unitValue(tok) returns 0.0. Check for this.
             if (fctr == 0) {
                 throw CanteraError("toSI","unknown unit: "+tsub);
             }
@@ -136,6 +137,13 @@ public:
     }
 
 private:
+    //! The value of the unit `name` in #m_u, or 0.0 if it is not defined.
+    //! Does not modify #m_u, so that units may be converted concurrently.
+    doublereal unitValue(const std::string& name) const {
+        auto iter = m_u.find(name);
+        return (iter != m_u.end()) ? iter->second : 0.0;
+    }
+
     /// pointer to the single instance of Unit
     static Unit* s_u;
 
@@ -11,6 +11,7 @@
 #include "cantera/base/global.h"
 #include "cantera/base/utilities.h"
 
+#include <algorithm>
 #include <sstream>
 
 using namespace std;
@@ -116,14 +117,27 @@ public:
 //////////////////// XML_Reader methods ///////////////////////
 
 XML_Reader::XML_Reader(std::istream& input) :
-    m_s(input),
+    m_pos(0),
+    m_eof(false),
     m_line(0)
 {
+    const size_t chunk = 65536;
+    size_t n = 0;
+    while (input) {
+        m_buf.resize(n + chunk);
+        input.read(&m_buf[n], chunk);
+        n += static_cast<size_t>(input.gcount());
+    }
+    m_buf.resize(n);
 }
 
 void XML_Reader::getchr(char& ch)
 {
-    m_s.get(ch);
+    if (m_pos < m_buf.size()) {
+        ch = m_buf[m_pos++];
+    } else {
+        m_eof = true;
+    }
     if (ch == '\n') {
         m_line++;
     }
@@ -231,19 +245,121 @@ void XML_Reader::parseTag(const std::string& tag, std::string& name,
     }
 }
 
-std::string XML_Reader::readTag(std::map<std::string, std::string>& attribs)
+void XML_Reader::parseTagFast(const std::string& tag, std::string& name,
+                              std::map<std::string, std::string>& attribs) const
 {
-    string tag = "";
-    bool incomment = false;
-    char ch = '-';
+    // Single quotes and backslashes are handled only by parseTag
+    if (tag.find_first_of("'\\") != string::npos) {
+        parseTag(tag, name, attribs);
+        return;
+    }
+    // All characters in the tag are printable, so only spaces are stripped
+    size_t b = tag.find_first_not_of(' ');
+    if (b == string::npos) {
+        name.clear();
+        return;
+    }
+    size_t e = tag.find_last_not_of(' ') + 1;
+    size_t i = tag.find(' ', b);
+    if (i >= e) {
+        name.assign(tag, b, e - b);
+        return;
+    }
+    name.assign(tag, b, i - b);
+    if (tag[e-1] == '/') {
+        name += "/";
+    }
+
+    // get attributes
+    string attr;
     while (true) {
-        if (m_s.eof() || (getchr(ch), ch == '<')) {
+        i = tag.find_first_not_of(' ', i);
+        size_t eq = tag.find('=', i);
+        if (eq >= e) {
+            break;
+        }
+        size_t attrEnd = tag.find_last_not_of(' ', eq - 1);
+        if (eq == i || attrEnd < i) {
             break;
         }
+        size_t q1 = tag.find_first_not_of(' ', eq + 1);
+        size_t q2 = (q1 < e && tag[q1] == '"') ? tag.find('"', q1 + 1) : string::npos;
+        if (q2 >= e) {
+            parseTag(tag, name, attribs);
+            return;
+        }
+        attr.assign(tag, i, attrEnd + 1 - i);
+        attribs[attr].assign(tag, q1 + 1, q2 - q1 - 1);
+        i = q2 + 1;
+        if (i >= e) {
+            break;
+        }
+    }
+}
+
+std::string XML_Reader::readTag(std::map<std::string, std::string>& attribs)
+{
+    if (m_eof) {
+        return "EOF";
+    }
+    size_t start = m_buf.find('<', m_pos);
+    if (start == string::npos) {
+        m_line += static_cast<int>(std::count(m_buf.begin() + m_pos,
+                                              m_buf.end(), '\n'));
+        m_pos = m_buf.size();
+        m_eof = true;
+        return "EOF";
+    }
+    m_line += static_cast<int>(std::count(m_buf.begin() + m_pos,
+                                          m_buf.begin() + start, '\n'));
+    m_pos = start + 1;
+
+    // Locate the end of the tag or comment. Tags which are not terminated,
+    // or which contain the start of a comment after their first character,
+    // are read by the character-based parser.
+    const char* comment = "!--";
+    bool incomment = (m_buf.compare(m_pos, 3, comment) == 0);
+    size_t end = incomment ? m_buf.find("-->", m_pos + 1) : m_buf.find('>', m_pos);
+    if (end == string::npos) {
+        return readTagByChar(attribs);
+    }
+    if (incomment) {
+        end += 2;
+    }
+    auto first = m_buf.begin() + m_pos + (incomment ? 1 : 0);
+    auto last = m_buf.begin() + end;
+    if (std::search(first, last, comment, comment + 3) != last) {
+        return readTagByChar(attribs);
+    }
+
+    string tag;
+    tag.reserve(end - m_pos);
+    for (auto iter = first; iter != last; ++iter) {
+        if (*iter == '\n') {
+            m_line++;
+        } else if (isprint(*iter)) {
+            tag += *iter;
+        }
+    }
+    m_pos = end + 1;
+    if (incomment) {
+        attribs.clear();
+        return tag;
+    } else {
+        string name;
+        parseTagFast(tag, name, attribs);
+        return name;
     }
+}
+
+std::string XML_Reader::readTagByChar(std::map<std::string, std::string>& attribs)
+{
+    string tag = "";
+    bool incomment = false;
+    char ch = '<';
     char ch1 = ' ', ch2 = ' ';
     while (true) {
-        if (m_s.eof()) {
+        if (m_eof) {
             tag = "EOF";
             break;
         }
@@ -280,30 +396,38 @@ std::string XML_Reader::readTag(std::map<std::string, std::string>& attribs)
 
 std::string XML_Reader::readValue()
 {
-    string tag = "";
+    if (m_eof) {
+        return "";
+    }
+    size_t end = m_buf.find('<', m_pos);
+    size_t stop = end;
+    if (end == string::npos) {
+        // When the end of the input is reached, the last character is
+        // processed a second time, as getchr() leaves it unchanged
+        end = m_buf.size();
+        stop = end + 1;
+        m_eof = true;
+    }
+    string tag;
+    tag.reserve(stop - m_pos);
     char ch = '\n';
     bool front = true;
-    while (true) {
-        if (m_s.eof()) {
-            break;
-        }
+    for (size_t i = m_pos; i < stop; i++) {
         char lastch = ch;
-        getchr(ch);
+        ch = (i < end) ? m_buf[i] : ch;
         if (ch == '\n') {
             front = true;
+            m_line++;
         } else if (ch != ' ') {
             front = false;
         }
-        if (ch == '<') {
-            m_s.putback(ch);
-            break;
-        }
         if (front && lastch == ' ' && ch == ' ') {
             ;
         } else {
             tag += ch;
         }
     }
+    m_pos = end;
     return stripws(tag);
 }
 
@@ -721,7 +845,7 @@ void XML_Node::build(std::istream& f)
     XML_Reader r(f);
     XML_Node* node = this;
     bool first = true;
-    while (!f.eof()) {
+    while (!r.eof()) {
         map<string, string> node_attribs;
         string nm = r.readTag(node_attribs);
 
@@ -741,7 +865,7 @@ void XML_Node::build(std::istream& f)
                 node = &node->addChild(nm2);
             }
             node->addValue("");
-            node->attribs() = node_attribs;
+            node->attribs().swap(node_attribs);
             node->setLineNumber(lnum);
             node = node->parent();
         } else if (nm[0] != '/') {
@@ -753,7 +877,7 @@ void XML_Node::build(std::istream& f)
                     node = &node->addChild(nm);
                 }
                 node->addValue(r.readValue());
-                node->attribs() = node_attribs;
+                node->attribs().swap(node_attribs);
                 node->setLineNumber(lnum);
             } else if (nm.substr(0,2) == "--") {
                 if (nm.substr(nm.size()-2,2) == "--") {
@@ -0,0 +1,733 @@
+/**
+ *  @file BinaryMechanism.cpp
+ *   Reading and writing of gas phase mechanisms in a compiled binary format
+ *   (see \ref Cantera::BinaryMechanism).
+ */
+
+#include "cantera/kinetics/BinaryMechanism.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/kinetics/Reaction.h"
+#include "cantera/kinetics/FalloffFactory.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/thermo/Species.h"
+#include "cantera/thermo/SpeciesThermoFactory.h"
+#include "cantera/thermo/ShomatePoly.h"
+#include "cantera/thermo/Nasa9Poly1.h"
+#include "cantera/thermo/Nasa9PolyMultiTempRegion.h"
+#include "cantera/transport/MixTransport.h"
+#include "cantera/transport/MultiTransport.h"
+#include "cantera/transport/TransportData.h"
+#include "cantera/base/Array.h"
+#include "cantera/base/global.h"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace Cantera
+{
+
+namespace
+{
+
+// File header: magic string, format version, byte order mark, and the
+// offsets of the phase, kinetics and transport sections.
+const char fileMagic[8] = {'C', 'T', 'M', 'E', 'C', 'H', 'B', '\0'};
+const uint32_t formatVersion = 1;
+const uint32_t byteOrderMark = 0x01020304;
+const size_t headerSize = 16 + 3 * sizeof(uint64_t);
+
+//! Accumulates the records of a binary mechanism file
+class Writer
+{
+public:
+    void write(const void* data, size_t n) {
+        m_buf.append(static_cast<const char*>(data), n);
+    }
+    void putInt(int i) {
+        int32_t v = i;
+        write(&v, sizeof(v));
+    }
+    void putSize(size_t n) {
+        uint32_t v = static_cast<uint32_t>(n);
+        write(&v, sizeof(v));
+    }
+    void putDouble(double x) {
+        write(&x, sizeof(x));
+    }
+    void putDoubles(const vector_fp& x) {
+        putSize(x.size());
+        write(x.data(), x.size() * sizeof(double));
+    }
+    void putString(const string& s) {
+        putSize(s.size());
+        write(s.data(), s.size());
+    }
+    void putComposition(const Composition& c) {
+        putSize(c.size());
+        for (const auto& item : c) {
+            putString(item.first);
+            putDouble(item.second);
+        }
+    }
+    void putArrhenius(const Arrhenius& rate) {
+        putDouble(rate.preExponentialFactor());
+        putDouble(rate.temperatureExponent());
+        putDouble(rate.activationEnergy_R());
+    }
+    void putArrays(const vector<vector_fp>& x) {
+        putSize(x.size());
+        for (const auto& v : x) {
+            putDoubles(v);
+        }
+    }
+
+    string m_buf;
+};
+
+//! Reads the records of a binary mechanism file sequentially, checking that
+//! no record extends beyond the end of the file
+class Reader
+{
+public:
+    Reader(const char* begin, const char* end, const string& filename) :
+        m_pos(begin), m_end(end), m_filename(filename) {}
+
+    void read(void* data, size_t n) {
+        if (n > static_cast<size_t>(m_end - m_pos)) {
+            throw CanteraError("BinaryMechanism", "Unexpected end of file "
+                               "in '{}'", m_filename);
+        }
+        memcpy(data, m_pos, n);
+        m_pos += n;
+    }
+    int getInt() {
+        int32_t v;
+        read(&v, sizeof(v));
+        return v;
+    }
+    size_t getSize() {
+        uint32_t v;
+        read(&v, sizeof(v));
+        return v;
+    }
+    //! Read a count of items that are each at least `itemSize` bytes long,
+    //! checking that the count does not exceed the remaining data
+    size_t getCount(size_t itemSize) {
+        size_t n = getSize();
+        if (n > static_cast<size_t>(m_end - m_pos) / itemSize) {
+            throw CanteraError("BinaryMechanism", "Unexpected end of file "
+                               "in '{}'", m_filename);
+        }
+        return n;
+    }
+    double getDouble() {
+        double x;
+        read(&x, sizeof(x));
+        return x;
+    }
+    vector_fp getDoubles() {
+        size_t n = getCount(sizeof(double));
+        vector_fp x(n);
+        read(x.data(), n * sizeof(double));
+        return x;
+    }
+    string getString() {
+        size_t n = getCount(1);
+        string s(m_pos, n);
+        m_pos += n;
+        return s;
+    }
+    Composition getComposition() {
+        Composition c;
+        size_t n = getSize();
+        for (size_t i = 0; i < n; i++) {
+            string name = getString();
+            c[name] = getDouble();
+        }
+        return c;
+    }
+    Arrhenius getArrhenius() {
+        double A = getDouble();
+        double b = getDouble();
+        double E = getDouble();
+        return Arrhenius(A, b, E);
+    }
+    vector<vector_fp> getArrays() {
+        // Each array is stored as at least its (32-bit) length
+        vector<vector_fp> x(getCount(sizeof(uint32_t)));
+        for (auto& v : x) {
+            v = getDoubles();
+        }
+        return x;
+    }
+
+private:
+    const char* m_pos;
+    const char* m_end;
+    const string& m_filename;
+};
+
+void putThermo(Writer& w, const SpeciesThermoInterpType& spthermo,
+               const string& name)
+{
+    // ShomatePoly reports the same type as ShomatePoly2, so the type is
+    // determined from the class where the reported type is ambiguous
+    int type = spthermo.reportType();
+    size_t nCoeffs;
+    if (dynamic_cast<const ShomatePoly*>(&spthermo)) {
+        type = SHOMATE1;
+        nCoeffs = 7;
+    } else if (type == NASA2 || type == SHOMATE2) {
+        nCoeffs = 15;
+    } else if (type == NASA1) {
+        nCoeffs = 7;
+    } else if (type == CONSTANT_CP) {
+        nCoeffs = 4;
+    } else if (type == NASA9) {
+        nCoeffs = 12;
+    } else if (type == NASA9MULTITEMP) {
+        nCoeffs = 1 + 11 * dynamic_cast<const Nasa9PolyMultiTempRegion&>(
+            spthermo).nRegions();
+    } else {
+        throw CanteraError("writeBinaryMechanism", "Unsupported species "
+            "thermo type {} for species '{}'", type, name);
+    }
+    size_t n;
+    int reportedType;
+    double tlow, thigh, pref;
+    vector_fp c(nCoeffs);
+    spthermo.reportParameters(n, reportedType, tlow, thigh, pref, c.data());
+    w.putInt(type);
+    w.putDouble(tlow);
+    w.putDouble(thigh);
+    w.putDouble(pref);
+    w.putDoubles(c);
+}
+
+shared_ptr<SpeciesThermoInterpType> getThermo(Reader& r, const string& name)
+{
+    int type = r.getInt();
+    double tlow = r.getDouble();
+    double thigh = r.getDouble();
+    double pref = r.getDouble();
+    vector_fp c = r.getDoubles();
+    size_t nCoeffs = 0;
+    if (type == NASA2 || type == SHOMATE2) {
+        nCoeffs = 15;
+    } else if (type == NASA1 || type == SHOMATE1) {
+        nCoeffs = 7;
+    } else if (type == CONSTANT_CP) {
+        nCoeffs = 4;
+    } else if ((type == NASA9 || type == NASA9MULTITEMP) && !c.empty()) {
+        // Number of regions, then (Tmin, Tmax, 9 coefficients) per region
+        nCoeffs = 1 + 11 * static_cast<size_t>(c[0]);
+    }
+    if (nCoeffs == 0 || c.size() != nCoeffs) {
+        throw CanteraError("BinaryMechanism::importPhase", "Invalid thermo "
+            "parameterization for species '{}'", name);
+    }
+    if (type == NASA9 || type == NASA9MULTITEMP) {
+        vector<Nasa9Poly1*> regions;
+        for (size_t i = 1; i < nCoeffs; i += 11) {
+            regions.push_back(new Nasa9Poly1(c[i], c[i+1], pref, &c[i+2]));
+        }
+        if (regions.size() == 1) {
+            return shared_ptr<SpeciesThermoInterpType>(regions[0]);
+        }
+        return make_shared<Nasa9PolyMultiTempRegion>(regions);
+    }
+    return shared_ptr<SpeciesThermoInterpType>(
+        newSpeciesThermoInterpType(type, tlow, thigh, pref, c.data()));
+}
+
+void putPhase(Writer& w, ThermoPhase& thermo)
+{
+    if (thermo.eosType() != cIdealGas) {
+        throw CanteraError("writeBinaryMechanism", "Only ideal gas phases "
+                           "are supported; phase '{}' is not", thermo.id());
+    }
+    w.putString(thermo.id());
+    w.putString(thermo.name());
+    w.putSize(thermo.nElements());
+    for (size_t m = 0; m < thermo.nElements(); m++) {
+        w.putString(thermo.elementName(m));
+        w.putDouble(thermo.atomicWeight(m));
+        w.putInt(thermo.atomicNumber(m));
+        double s298 = ENTROPY298_UNKNOWN;
+        try {
+            s298 = thermo.entropyElement298(m);
+        } catch (CanteraError&) {
+            // entropy is unknown
+        }
+        w.putDouble(s298);
+        w.putInt(thermo.elementType(m));
+    }
+
+    w.putSize(thermo.nSpecies());
+    for (size_t k = 0; k < thermo.nSpecies(); k++) {
+        shared_ptr<Species> sp = thermo.species(k);
+        w.putString(sp->name);
+        w.putComposition(sp->composition);
+        w.putDouble(sp->charge);
+        w.putDouble(sp->size);
+        putThermo(w, *sp->thermo, sp->name);
+        auto tr = std::dynamic_pointer_cast<GasTransportData>(sp->transport);
+        w.putInt(tr ? 1 : 0);
+        if (tr) {
+            w.putString(tr->geometry);
+            w.putDouble(tr->diameter);
+            w.putDouble(tr->well_depth);
+            w.putDouble(tr->dipole);
+            w.putDouble(tr->polarizability);
+            w.putDouble(tr->rotational_relaxation);
+            w.putDouble(tr->acentric_factor);
+        }
+    }
+
+    w.putDouble(thermo.temperature());
+    w.putDouble(thermo.pressure());
+    vector_fp Y(thermo.nSpecies());
+    thermo.getMassFractions(Y.data());
+    w.putDoubles(Y);
+}
+
+void putThirdBody(Writer& w, const ThirdBody& tbody, const ThermoPhase& thermo)
+{
+    // Efficiencies for species which are not in the phase have been skipped
+    // when the reaction was added to the Kinetics object
+    Composition efficiencies;
+    for (const auto& eff : tbody.efficiencies) {
+        if (thermo.speciesIndex(eff.first) != npos) {
+            efficiencies.insert(eff);
+        }
+    }
+    w.putComposition(efficiencies);
+    w.putDouble(tbody.default_efficiency);
+}
+
+ThirdBody getThirdBody(Reader& r)
+{
+    Composition efficiencies = r.getComposition();
+    ThirdBody tbody(r.getDouble());
+    tbody.efficiencies = efficiencies;
+    return tbody;
+}
+
+void putReaction(Writer& w, const Reaction& R, const ThermoPhase& thermo)
+{
+    w.putInt(R.reaction_type);
+    w.putString(R.id);
+    w.putComposition(R.reactants);
+    w.putComposition(R.products);
+    w.putComposition(R.orders);
+    w.putInt(R.reversible);
+    w.putInt(R.duplicate);
+    w.putInt(R.allow_nonreactant_orders);
+    w.putInt(R.allow_negative_orders);
+
+    switch (R.reaction_type) {
+    case ELEMENTARY_RXN:
+    case THREE_BODY_RXN: {
+        const ElementaryReaction& r = dynamic_cast<const ElementaryReaction&>(R);
+        w.putArrhenius(r.rate);
+        w.putInt(r.allow_negative_pre_exponential_factor);
+        if (R.reaction_type == THREE_BODY_RXN) {
+            putThirdBody(w, dynamic_cast<const ThreeBodyReaction&>(R).third_body,
+                         thermo);
+        }
+        break;
+    }
+    case FALLOFF_RXN:
+    case CHEMACT_RXN: {
+        const FalloffReaction& r = dynamic_cast<const FalloffReaction&>(R);
+        w.putArrhenius(r.low_rate);
+        w.putArrhenius(r.high_rate);
+        putThirdBody(w, r.third_body, thermo);
+        w.putInt(r.falloff->getType());
+        vector_fp c(r.falloff->nParameters());
+        r.falloff->getParameters(c.data());
+        w.putDoubles(c);
+        break;
+    }
+    case PLOG_RXN: {
+        auto rates = dynamic_cast<const PlogReaction&>(R).rate.rates();
+        w.putSize(rates.size());
+        for (const auto& rate : rates) {
+            w.putDouble(rate.first);
+            w.putArrhenius(rate.second);
+        }
+        break;
+    }
+    case CHEBYSHEV_RXN: {
+        const ChebyshevRate& rate = dynamic_cast<const ChebyshevReaction&>(R).rate;
+        w.putDouble(rate.Tmin());
+        w.putDouble(rate.Tmax());
+        w.putDouble(rate.Pmin());
+        w.putDouble(rate.Pmax());
+        w.putSize(rate.nTemperature());
+        w.putDoubles(rate.coeffs());
+        break;
+    }
+    default:
+        throw CanteraError("writeBinaryMechanism", "Unsupported type {} of "
+            "reaction '{}'", R.reaction_type, R.equation());
+    }
+}
+
+shared_ptr<Reaction> getReaction(Reader& r)
+{
+    shared_ptr<Reaction> R;
+    int type = r.getInt();
+    switch (type) {
+    case ELEMENTARY_RXN:
+        R = make_shared<ElementaryReaction>();
+        break;
+    case THREE_BODY_RXN:
+        R = make_shared<ThreeBodyReaction>();
+        break;
+    case FALLOFF_RXN:
+        R = make_shared<FalloffReaction>();
+        break;
+    case CHEMACT_RXN:
+        R = make_shared<ChemicallyActivatedReaction>();
+        break;
+    case PLOG_RXN:
+        R = make_shared<PlogReaction>();
+        break;
+    case CHEBYSHEV_RXN:
+        R = make_shared<ChebyshevReaction>();
+        break;
+    default:
+        throw CanteraError("BinaryMechanism::importKinetics",
+                           "Invalid reaction type {}", type);
+    }
+    R->id = r.getString();
+    R->reactants = r.getComposition();
+    R->products = r.getComposition();
+    R->orders = r.getComposition();
+    R->reversible = r.getInt();
+    R->duplicate = r.getInt();
+    R->allow_nonreactant_orders = r.getInt();
+    R->allow_negative_orders = r.getInt();
+
+    if (type == ELEMENTARY_RXN || type == THREE_BODY_RXN) {
+        auto& rxn = dynamic_cast<ElementaryReaction&>(*R);
+        rxn.rate = r.getArrhenius();
+        rxn.allow_negative_pre_exponential_factor = r.getInt();
+        if (type == THREE_BODY_RXN) {
+            dynamic_cast<ThreeBodyReaction&>(*R).third_body = getThirdBody(r);
+        }
+    } else if (type == FALLOFF_RXN || type == CHEMACT_RXN) {
+        auto& rxn = dynamic_cast<FalloffReaction&>(*R);
+        rxn.low_rate = r.getArrhenius();
+        rxn.high_rate = r.getArrhenius();
+        rxn.third_body = getThirdBody(r);
+        int falloffType = r.getInt();
+        rxn.falloff = newFalloff(falloffType, r.getDoubles());
+    } else if (type == PLOG_RXN) {
+        std::multimap<double, Arrhenius> rates;
+        size_t n = r.getSize();
+        for (size_t i = 0; i < n; i++) {
+            double P = r.getDouble();
+            rates.insert({P, r.getArrhenius()});
+        }
+        dynamic_cast<PlogReaction&>(*R).rate = Plog(rates);
+    } else {
+        double Tmin = r.getDouble();
+        double Tmax = r.getDouble();
+        double Pmin = r.getDouble();
+        double Pmax = r.getDouble();
+        size_t nT = r.getSize();
+        vector_fp c = r.getDoubles();
+        if (nT == 0 || c.size() % nT) {
+            throw CanteraError("BinaryMechanism::importKinetics",
+                               "Invalid Chebyshev coefficients");
+        }
+        Array2D coeffs(nT, c.size() / nT);
+        for (size_t t = 0; t < nT; t++) {
+            for (size_t p = 0; p < coeffs.nColumns(); p++) {
+                coeffs(t, p) = c[coeffs.nColumns() * t + p];
+            }
+        }
+        dynamic_cast<ChebyshevReaction&>(*R).rate =
+            ChebyshevRate(Tmin, Tmax, Pmin, Pmax, coeffs);
+    }
+    return R;
+}
+
+void putTransport(Writer& w, ThermoPhase& thermo, Transport& tran)
+{
+    GasTransport* gastr = dynamic_cast<GasTransport*>(&tran);
+    int model = tran.model();
+    if (!gastr || (model != cMixtureAveraged && model != cMulticomponent &&
+                   model != CK_Multicomponent)) {
+        throw CanteraError("writeBinaryMechanism", "Only mixture-averaged "
+            "and multicomponent transport managers are supported");
+    }
+    if (&tran.thermo() != &thermo) {
+        throw CanteraError("writeBinaryMechanism", "Transport manager "
+            "is not defined for the phase '{}'", thermo.id());
+    }
+    GasTransportFits fits;
+    gastr->getFits(fits);
+    w.putInt(model);
+    w.putInt(fits.mode);
+    w.putArrays(fits.visccoeffs);
+    w.putArrays(fits.condcoeffs);
+    w.putArrays(fits.diffcoeffs);
+    w.putSize(fits.poly.size());
+    for (const auto& row : fits.poly) {
+        w.putSize(row.size());
+        for (int i : row) {
+            w.putInt(i);
+        }
+    }
+    w.putArrays(fits.omega22);
+    w.putArrays(fits.astar);
+    w.putArrays(fits.bstar);
+    w.putArrays(fits.cstar);
+}
+
+} // end anonymous namespace
+
+void writeBinaryMechanism(const std::string& filename, ThermoPhase& thermo,
+                          Kinetics* kin, Transport* tran)
+{
+    Writer w;
+    uint64_t offsets[3] = {0, 0, 0};
+    w.write(fileMagic, sizeof(fileMagic));
+    w.write(&formatVersion, sizeof(formatVersion));
+    w.write(&byteOrderMark, sizeof(byteOrderMark));
+    w.write(offsets, sizeof(offsets));
+
+    offsets[0] = w.m_buf.size();
+    putPhase(w, thermo);
+
+    if (kin) {
+        if (kin->nPhases() != 1 || &kin->thermo(0) != &thermo) {
+            throw CanteraError("writeBinaryMechanism", "Kinetics manager "
+                "must be defined for the single phase '{}'", thermo.id());
+        }
+        offsets[1] = w.m_buf.size();
+        w.putSize(kin->nReactions());
+        for (size_t i = 0; i < kin->nReactions(); i++) {
+            putReaction(w, *kin->reaction(i), thermo);
+        }
+    }
+
+    if (tran) {
+        offsets[2] = w.m_buf.size();
+        putTransport(w, thermo, *tran);
+    }
+
+    memcpy(&w.m_buf[16], offsets, sizeof(offsets));
+    std::ofstream out(filename, std::ios::binary);
+    out.write(w.m_buf.data(), w.m_buf.size());
+    if (!out) {
+        throw CanteraError("writeBinaryMechanism",
+                           "Error writing file '{}'", filename);
+    }
+}
+
+BinaryMechanism::BinaryMechanism(const std::string& filename) :
+    m_filename(filename),
+    m_data(0),
+    m_size(0),
+    m_mapped(false)
+{
+    string path = findInputFile(filename);
+#ifndef _WIN32
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw CanteraError("BinaryMechanism::BinaryMechanism",
+                           "Unable to open file '{}'", path);
+    }
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        void* p = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (p != MAP_FAILED) {
+            m_data = static_cast<const char*>(p);
+            m_size = st.st_size;
+            m_mapped = true;
+        }
+    }
+    close(fd);
+#endif
+    if (!m_mapped) {
+        // Read the whole file if it can't be mapped
+        std::ifstream in(path, std::ios::binary);
+        if (!in) {
+            throw CanteraError("BinaryMechanism::BinaryMechanism",
+                               "Unable to open file '{}'", path);
+        }
+        m_buffer.assign(std::istreambuf_iterator<char>(in),
+                        std::istreambuf_iterator<char>());
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+    }
+
+    string error;
+    uint32_t version = 0, bom = 0;
+    if (m_size < headerSize || memcmp(m_data, fileMagic, 8) != 0) {
+        error = "Not a binary mechanism file";
+    } else {
+        memcpy(&version, m_data + 8, sizeof(version));
+        memcpy(&bom, m_data + 12, sizeof(bom));
+        memcpy(m_offsets, m_data + 16, sizeof(m_offsets));
+        if (bom != byteOrderMark) {
+            error = "File was written on a platform with a different byte order";
+        } else if (version != formatVersion) {
+            error = fmt::format("Unsupported format version {}", version);
+        } else if (m_offsets[0] < headerSize || m_offsets[0] >= m_size ||
+                   m_offsets[1] >= m_size || m_offsets[2] >= m_size) {
+            error = "Invalid section offsets";
+        }
+    }
+    if (!error.empty()) {
+#ifndef _WIN32
+        if (m_mapped) {
+            munmap(const_cast<char*>(m_data), m_size);
+        }
+#endif
+        throw CanteraError("BinaryMechanism::BinaryMechanism",
+                           "{}: '{}'", error, path);
+    }
+}
+
+BinaryMechanism::~BinaryMechanism()
+{
+#ifndef _WIN32
+    if (m_mapped) {
+        munmap(const_cast<char*>(m_data), m_size);
+    }
+#endif
+}
+
+void BinaryMechanism::importPhase(ThermoPhase& thermo) const
+{
+    if (thermo.eosType() != cIdealGas) {
+        throw CanteraError("BinaryMechanism::importPhase",
+                           "Only IdealGasPhase objects are supported");
+    }
+    if (thermo.nElements() || thermo.nSpecies()) {
+        throw CanteraError("BinaryMechanism::importPhase",
+                           "Phase '{}' has already been initialized",
+                           thermo.id());
+    }
+    Reader r(m_data + m_offsets[0], m_data + m_size, m_filename);
+    thermo.setID(r.getString());
+    thermo.setName(r.getString());
+
+    size_t nElements = r.getSize();
+    for (size_t m = 0; m < nElements; m++) {
+        string symbol = r.getString();
+        double weight = r.getDouble();
+        int atomicNumber = r.getInt();
+        double s298 = r.getDouble();
+        int elemType = r.getInt();
+        thermo.addElement(symbol, weight, atomicNumber, s298, elemType);
+    }
+
+    size_t nSpecies = r.getSize();
+    for (size_t k = 0; k < nSpecies; k++) {
+        string name = r.getString();
+        Composition comp = r.getComposition();
+        double charge = r.getDouble();
+        double size = r.getDouble();
+        auto sp = make_shared<Species>(name, comp, charge, size);
+        sp->thermo = getThermo(r, name);
+        if (r.getInt()) {
+            string geometry = r.getString();
+            double params[6];
+            for (size_t i = 0; i < 6; i++) {
+                params[i] = r.getDouble();
+            }
+            sp->transport = make_shared<GasTransportData>(geometry,
+                params[0], params[1], params[2], params[3], params[4],
+                params[5]);
+        }
+        thermo.addSpecies(sp);
+    }
+    thermo.initThermo();
+
+    double T = r.getDouble();
+    double P = r.getDouble();
+    vector_fp Y = r.getDoubles();
+    if (Y.size() != nSpecies) {
+        throw CanteraError("BinaryMechanism::importPhase",
+                           "Invalid initial state in '{}'", m_filename);
+    }
+    thermo.setState_TPY(T, P, Y.data());
+}
+
+void BinaryMechanism::importKinetics(ThermoPhase& thermo, Kinetics& kin) const
+{
+    if (!hasKinetics()) {
+        throw CanteraError("BinaryMechanism::importKinetics",
+                           "No reactions in '{}'", m_filename);
+    }
+    if (kin.nPhases() != 0) {
+        throw CanteraError("BinaryMechanism::importKinetics",
+                           "Kinetics manager has already been initialized");
+    }
+    kin.addPhase(thermo);
+    kin.init();
+    Reader r(m_data + m_offsets[1], m_data + m_size, m_filename);
+    size_t nReactions = r.getSize();
+    for (size_t i = 0; i < nReactions; i++) {
+        kin.addReaction(getReaction(r));
+    }
+    kin.finalize();
+}
+
+Transport* BinaryMechanism::newTransport(ThermoPhase& thermo,
+                                         int log_level) const
+{
+    if (!hasTransport()) {
+        throw CanteraError("BinaryMechanism::newTransport",
+                           "No transport data in '{}'", m_filename);
+    }
+    Reader r(m_data + m_offsets[2], m_data + m_size, m_filename);
+    int model = r.getInt();
+    GasTransportFits fits;
+    fits.mode = r.getInt();
+    fits.visccoeffs = r.getArrays();
+    fits.condcoeffs = r.getArrays();
+    fits.diffcoeffs = r.getArrays();
+    fits.poly.resize(r.getCount(sizeof(uint32_t)));
+    for (auto& row : fits.poly) {
+        row.resize(r.getCount(sizeof(int32_t)));
+        for (auto& i : row) {
+            i = r.getInt();
+        }
+    }
+    fits.omega22 = r.getArrays();
+    fits.astar = r.getArrays();
+    fits.bstar = r.getArrays();
+    fits.cstar = r.getArrays();
+
+    std::unique_ptr<GasTransport> tr;
+    if (model == cMixtureAveraged) {
+        tr.reset(new MixTransport());
+    } else if (model == cMulticomponent || model == CK_Multicomponent) {
+        tr.reset(new MultiTransport());
+    } else {
+        throw CanteraError("BinaryMechanism::newTransport",
+                           "Invalid transport model {}", model);
+    }
+    tr->setFits(fits);
+    tr->init(&thermo, fits.mode, log_level);
+    return tr.release();
+}
+
+}
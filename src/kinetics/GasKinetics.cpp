@@ -15,7 +15,11 @@ GasKinetics::GasKinetics(thermo_t* thermo) :
     m_logp_ref(0.0),
     m_logc_ref(0.0),
     m_logStandConc(0.0),
-    m_pres(0.0)
+    m_pres(0.0),
+    m_drg_tol(0.0),
+    m_drg_interval(20),
+    m_drg_count(0),
+    m_drg_reduced(false)
 {
 }
 
@@ -34,7 +38,9 @@ void GasKinetics::update_rates_T()
     doublereal logT = log(T);
 
     if (T != m_temp) {
-        if (!m_rfn.empty()) {
+        if (m_drg_reduced) {
+            m_drg_rates.update(T, logT, m_rfn.data());
+        } else if (!m_rfn.empty()) {
             m_rates.update(T, logT, m_rfn.data());
         }
 
@@ -96,21 +102,40 @@ void GasKinetics::update_rates_C()
 
 void GasKinetics::updateKc()
 {
+    if (!m_stoich_ok) {
+        updateStoich();
+    }
     thermo().getStandardChemPotentials(m_grt.data());
-    fill(m_rkcn.begin(), m_rkcn.end(), 0.0);
+    doublereal rrt = 1.0 / thermo().RT();
 
-    // compute Delta G^0 for all reversible reactions
-    getRevReactionDelta(m_grt.data(), m_rkcn.data());
+    // compute Delta G^0 / RT for the reversible reactions, or only for the
+    // active ones if the mechanism is reduced, from their net stoichiometric
+    // coefficients
+    const vector<size_t>& rev = m_drg_reduced ? m_drg_rev : m_revindex;
+    const vector<size_t>& start = m_netStoich.columnStarts();
+    const vector<size_t>& species = m_netStoich.rowIndices();
+    const vector_fp& nu = m_netStoich.values();
+    size_t nrev = rev.size();
+    const double* grt = m_grt.data();
+    for (size_t i = 0; i < nrev; i++) {
+        size_t irxn = rev[i];
+        double dg = 0.0;
+        for (size_t n = start[irxn]; n < start[irxn+1]; n++) {
+            dg += nu[n] * grt[species[n]];
+        }
+        m_kc_work[i] = dg*rrt - m_dn[irxn]*m_logStandConc;
+    }
 
-    doublereal rrt = 1.0 / thermo().RT();
-    for (size_t i = 0; i < m_revindex.size(); i++) {
-        size_t irxn = m_revindex[i];
-        m_rkcn[irxn] = std::min(exp(m_rkcn[irxn]*rrt - m_dn[irxn]*m_logStandConc),
-                                BigNumber);
+    // the exponentials are evaluated in a separate loop over contiguous
+    // arrays so that it can be vectorized
+    double* rkc = m_kc_work.data();
+    for (size_t i = 0; i < nrev; i++) {
+        rkc[i] = std::min(exp(rkc[i]), BigNumber);
     }
 
-    for (size_t i = 0; i != m_irrev.size(); ++i) {
-        m_rkcn[ m_irrev[i] ] = 0.0;
+    // m_rkcn is zero for irreversible reactions, and is not modified here
+    for (size_t i = 0; i < nrev; i++) {
+        m_rkcn[rev[i]] = rkc[i];
     }
 }
 
@@ -118,19 +143,15 @@ void GasKinetics::getEquilibriumConstants(doublereal* kc)
 {
     update_rates_T();
     thermo().getStandardChemPotentials(m_grt.data());
-    fill(m_rkcn.begin(), m_rkcn.end(), 0.0);
+    fill(kc, kc + nReactions(), 0.0);
 
     // compute Delta G^0 for all reactions
-    getReactionDelta(m_grt.data(), m_rkcn.data());
+    getReactionDelta(m_grt.data(), kc);
 
     doublereal rrt = 1.0 / thermo().RT();
     for (size_t i = 0; i < nReactions(); i++) {
-        kc[i] = exp(-m_rkcn[i]*rrt + m_dn[i]*m_logStandConc);
+        kc[i] = exp(-kc[i]*rrt + m_dn[i]*m_logStandConc);
     }
-
-    // force an update of T-dependent properties, so that m_rkcn will
-    // be updated before it is used next.
-    m_temp = 0.0;
 }
 
 void GasKinetics::processFalloffReactions()
@@ -165,6 +186,10 @@ void GasKinetics::updateROP()
     if (m_ROP_ok) {
         return;
     }
+    if (m_drg_tol > 0.0 && ++m_drg_count > m_drg_interval) {
+        updateActiveReactions();
+        return;
+    }
 
     // copy rate coefficients into ropf
     m_ropf = m_rfn;
@@ -198,6 +223,13 @@ void GasKinetics::updateROP()
         m_ropnet[j] = m_ropf[j] - m_ropr[j];
     }
 
+    // falloff, P-log and Chebyshev rates are evaluated for all reactions
+    if (m_drg_reduced) {
+        for (size_t j : m_drg_inactive) {
+            m_ropf[j] = m_ropr[j] = m_ropnet[j] = 0.0;
+        }
+    }
+
     for (size_t i = 0; i < m_rfn.size(); i++) {
         AssertFinite(m_rfn[i], "GasKinetics::updateROP",
                      "m_rfn[{}] is not finite.", i);
@@ -216,6 +248,10 @@ void GasKinetics::getFwdRateConstants(doublereal* kfwd)
 
     // copy rate coefficients into ropf
     m_ropf = m_rfn;
+    if (m_drg_reduced) {
+        // update_rates_T() evaluates only the active reactions
+        m_rates.update(m_temp, log(m_temp), m_ropf.data());
+    }
 
     // multiply ropf by enhanced 3b conc for all 3b rxns
     if (!concm_3b_values.empty()) {
@@ -234,6 +270,511 @@ void GasKinetics::getFwdRateConstants(doublereal* kfwd)
     }
 }
 
+void GasKinetics::getBatchNetProductionRates(size_t nStates, const double* T,
+                                             const double* P, const double* Y,
+                                             double* wdot)
+{
+    // Process large batches in blocks, so that the work arrays remain in cache
+    const size_t blockSize = 32;
+    if (nStates > blockSize) {
+        for (size_t m = 0; m < nStates; m += blockSize) {
+            size_t n = std::min(blockSize, nStates - m);
+            getBatchNetProductionRates(n, T + m, P + m, Y + m*m_kk,
+                                       wdot + m*m_kk);
+        }
+        return;
+    }
+
+    size_t nr = nReactions();
+    size_t nfall = m_falloff_high_rates.nReactions();
+    size_t M = nStates;
+    m_batch_logT.resize(M);
+    m_batch_recipT.resize(M);
+    m_batch_ctot.resize(M);
+    m_batch_logStandConc.resize(M);
+    m_batch_conc.resize(m_kk * M);
+    m_batch_grt.resize(m_kk * M);
+    m_batch_ropf.assign(nr * M, 0.0);
+    m_batch_ropr.resize(nr * M);
+    m_batch_rkcn.assign(nr * M, 0.0);
+    m_batch_concm_3b.resize(m_3b_concm.workSize() * M);
+    m_batch_concm_falloff.resize(nfall * M);
+    m_batch_rfn_low.resize(nfall * M);
+    m_batch_rfn_high.resize(nfall * M);
+    m_batch_pr.resize(nfall);
+    m_batch_falloff_work.resize(m_falloffn.workSize());
+    m_batch_kf.resize(nr);
+    m_batch_pdep.clear();
+    for (size_t i = 0; i < nr; i++) {
+        if (reactionType(i) == PLOG_RXN || reactionType(i) == CHEBYSHEV_RXN) {
+            m_batch_pdep.push_back(i);
+        }
+    }
+
+    // Properties which require setting the state of the phase
+    for (size_t m = 0; m < M; m++) {
+        thermo().setState_TPY(T[m], P[m], Y + m*m_kk);
+        m_batch_logT[m] = log(T[m]);
+        m_batch_recipT[m] = 1.0 / T[m];
+        m_batch_ctot[m] = thermo().molarDensity();
+        m_batch_logStandConc[m] = log(thermo().standardConcentration());
+        thermo().getActivityConcentrations(m_conc.data());
+        thermo().getStandardChemPotentials(m_grt.data());
+        double rrt = 1.0 / thermo().RT();
+        for (size_t k = 0; k < m_kk; k++) {
+            m_batch_conc[k*M + m] = m_conc[k];
+            m_batch_grt[k*M + m] = m_grt[k] * rrt;
+        }
+
+        if (!m_batch_pdep.empty()) {
+            if (m_plog_rates.nReactions()) {
+                double logP = log(P[m]);
+                m_plog_rates.update_C(&logP);
+                m_plog_rates.update(T[m], m_batch_logT[m], m_batch_kf.data());
+            }
+            if (m_cheb_rates.nReactions()) {
+                double log10P = log10(P[m]);
+                m_cheb_rates.update_C(&log10P);
+                m_cheb_rates.update(T[m], m_batch_logT[m], m_batch_kf.data());
+            }
+            for (size_t i : m_batch_pdep) {
+                m_batch_ropf[i*M + m] = m_batch_kf[i];
+            }
+        }
+    }
+
+    // Rate constants and third-body concentrations
+    if (m_rates.nReactions()) {
+        m_rates.update(M, m_batch_logT.data(), m_batch_recipT.data(),
+                       m_batch_ropf.data());
+    }
+    if (!concm_3b_values.empty()) {
+        m_3b_concm.update(M, m_batch_conc.data(), m_batch_ctot.data(),
+                          m_batch_concm_3b.data());
+        m_3b_concm.multiply(M, m_batch_ropf.data(), m_batch_concm_3b.data());
+    }
+
+    // Falloff reactions. The falloff functions are evaluated for one state
+    // at a time.
+    if (nfall) {
+        m_falloff_low_rates.update(M, m_batch_logT.data(),
+            m_batch_recipT.data(), m_batch_rfn_low.data());
+        m_falloff_high_rates.update(M, m_batch_logT.data(),
+            m_batch_recipT.data(), m_batch_rfn_high.data());
+        m_falloff_concm.update(M, m_batch_conc.data(), m_batch_ctot.data(),
+                               m_batch_concm_falloff.data());
+        for (size_t m = 0; m < M; m++) {
+            for (size_t i = 0; i < nfall; i++) {
+                m_batch_pr[i] = m_batch_concm_falloff[i*M + m] *
+                    m_batch_rfn_low[i*M + m] /
+                    (m_batch_rfn_high[i*M + m] + SmallNumber);
+            }
+            m_falloffn.updateTemp(T[m], m_batch_falloff_work.data());
+            m_falloffn.pr_to_falloff(m_batch_pr.data(),
+                                     m_batch_falloff_work.data());
+            for (size_t i = 0; i < nfall; i++) {
+                if (reactionType(m_fallindx[i]) == FALLOFF_RXN) {
+                    m_batch_pr[i] *= m_batch_rfn_high[i*M + m];
+                } else { // CHEMACT_RXN
+                    m_batch_pr[i] *= m_batch_rfn_low[i*M + m];
+                }
+                m_batch_ropf[m_fallindx[i]*M + m] = m_batch_pr[i];
+            }
+        }
+    }
+
+    // Reciprocal equilibrium constants for the reversible reactions
+    m_revProductStoich.incrementReactions(m_batch_grt.data(),
+                                          m_batch_rkcn.data(), M);
+    m_reactantStoich.decrementReactions(m_batch_grt.data(),
+                                        m_batch_rkcn.data(), M);
+    for (size_t i : m_revindex) {
+        double dn = m_dn[i];
+        double* rkc = &m_batch_rkcn[i*M];
+        for (size_t m = 0; m < M; m++) {
+            rkc[m] = std::min(exp(rkc[m] - dn * m_batch_logStandConc[m]),
+                              BigNumber);
+        }
+    }
+    for (size_t i : m_irrev) {
+        fill(&m_batch_rkcn[i*M], &m_batch_rkcn[i*M] + M, 0.0);
+    }
+
+    // Rates of progress
+    for (size_t i = 0; i < nr; i++) {
+        double perturb = m_perturb[i];
+        double* ropf = &m_batch_ropf[i*M];
+        double* ropr = &m_batch_ropr[i*M];
+        const double* rkc = &m_batch_rkcn[i*M];
+        for (size_t m = 0; m < M; m++) {
+            ropf[m] *= perturb;
+            ropr[m] = ropf[m] * rkc[m];
+        }
+    }
+    m_reactantStoich.multiply(m_batch_conc.data(), m_batch_ropf.data(), M);
+    m_revProductStoich.multiply(m_batch_conc.data(), m_batch_ropr.data(), M);
+    for (size_t n = 0; n < nr * M; n++) {
+        m_batch_ropf[n] -= m_batch_ropr[n];
+    }
+
+    // Production rates, using m_batch_grt for storage
+    vector_fp& wdot_batch = m_batch_grt;
+    fill(wdot_batch.begin(), wdot_batch.end(), 0.0);
+    m_revProductStoich.incrementSpecies(m_batch_ropf.data(),
+                                        wdot_batch.data(), M);
+    m_irrevProductStoich.incrementSpecies(m_batch_ropf.data(),
+                                          wdot_batch.data(), M);
+    m_reactantStoich.decrementSpecies(m_batch_ropf.data(),
+                                      wdot_batch.data(), M);
+    for (size_t m = 0; m < M; m++) {
+        for (size_t k = 0; k < m_kk; k++) {
+            wdot[m*m_kk + k] = wdot_batch[k*M + m];
+        }
+    }
+}
+
+void GasKinetics::getNetProductionRates_ddC(SparseMatrix& dwdot)
+{
+    updateROP();
+    if (m_ropnet_ddC.nRows() != nReactions() || m_ropnet_ddC.nColumns() != m_kk) {
+        setupDerivatives();
+    }
+    size_t nr = nReactions();
+    size_t nfall = m_falloff_high_rates.nReactions();
+
+    // Effective rate constants, not including the concentration products
+    m_kf_work = m_rfn;
+    if (!concm_3b_values.empty()) {
+        m_3b_concm.multiply(m_kf_work.data(), concm_3b_values.data());
+    }
+
+    // For falloff reactions, m_pr_work holds the derivative of the effective
+    // rate constant with respect to the enhanced third-body concentration.
+    // The derivative of the falloff function with respect to the reduced
+    // pressure is computed using a forward difference.
+    for (size_t i = 0; i < nfall; i++) {
+        double pr = concm_falloff_values[i] * m_rfn_low[i] /
+                    (m_rfn_high[i] + SmallNumber);
+        m_pr_work[i] = 1e-7 * pr + 1e-300; // perturbation in pr
+        m_falloff_work0[i] = pr;
+        m_falloff_work1[i] = pr + m_pr_work[i];
+    }
+    m_falloffn.pr_to_falloff(m_falloff_work0.data(), falloff_work.data());
+    m_falloffn.pr_to_falloff(m_falloff_work1.data(), falloff_work.data());
+    for (size_t i = 0; i < nfall; i++) {
+        double dFdpr = (m_falloff_work1[i] - m_falloff_work0[i]) / m_pr_work[i];
+        double dprdM = m_rfn_low[i] / (m_rfn_high[i] + SmallNumber);
+        size_t irxn = m_fallindx[i];
+        if (reactionType(irxn) == FALLOFF_RXN) {
+            m_kf_work[irxn] = m_rfn_high[i] * m_falloff_work0[i];
+            m_pr_work[i] = m_rfn_high[i] * dFdpr * dprdM;
+        } else { // CHEMACT_RXN
+            m_kf_work[irxn] = m_rfn_low[i] * m_falloff_work0[i];
+            m_pr_work[i] = m_rfn_low[i] * dFdpr * dprdM;
+        }
+    }
+
+    // q = (forward concentration product) - (reverse concentration product)/Kc
+    std::fill(m_q_work.begin(), m_q_work.end(), 1.0);
+    m_reactantStoich.multiply(m_conc.data(), m_q_work.data());
+    std::fill(m_kr_work.begin(), m_kr_work.end(), 1.0);
+    m_revProductStoich.multiply(m_conc.data(), m_kr_work.data());
+    for (size_t i = 0; i < nr; i++) {
+        m_q_work[i] -= m_rkcn[i] * m_kr_work[i];
+        m_kf_work[i] *= m_perturb[i];
+        m_kr_work[i] = - m_kf_work[i] * m_rkcn[i];
+    }
+
+    // Derivatives of the concentration products
+    m_ropnet_ddC.zero();
+    m_reactantStoich.derivatives(m_conc.data(), m_kf_work.data(), m_ropnet_ddC);
+    m_revProductStoich.derivatives(m_conc.data(), m_kr_work.data(), m_ropnet_ddC);
+
+    // Derivatives of the enhanced third-body concentrations
+    vector_fp eff(m_kk);
+    for (size_t i = 0; i < m_3b_concm.workSize(); i++) {
+        size_t irxn = m_3b_concm.reactionIndex(i);
+        double f = m_rfn[irxn] * m_perturb[irxn] * m_q_work[irxn];
+        m_3b_concm.getEfficiencies(i, eff.data(), m_kk);
+        for (size_t k = 0; k < m_kk; k++) {
+            if (eff[k] != 0.0) {
+                m_ropnet_ddC(irxn, k) += f * eff[k];
+            }
+        }
+    }
+    for (size_t i = 0; i < nfall; i++) {
+        size_t irxn = m_fallindx[i];
+        double f = m_pr_work[i] * m_perturb[irxn] * m_q_work[irxn];
+        m_falloff_concm.getEfficiencies(i, eff.data(), m_kk);
+        for (size_t k = 0; k < m_kk; k++) {
+            if (eff[k] != 0.0) {
+                m_ropnet_ddC(irxn, k) += f * eff[k];
+            }
+        }
+    }
+
+    // Derivatives of pressure-dependent rate constants, where
+    // dP/dC_k = P/C_tot for each species
+    if (m_plog_rates.nReactions() || m_cheb_rates.nReactions()) {
+        double logT = log(m_temp);
+        double logP = log(thermo().pressure());
+        double dlogP = 1e-7;
+        m_kr_work = m_rfn;
+        double logP1 = logP + dlogP;
+        double log10P1 = logP1 / log(10.0);
+        m_plog_rates.update_C(&logP1);
+        m_plog_rates.update(m_temp, logT, m_kr_work.data());
+        m_cheb_rates.update_C(&log10P1);
+        m_cheb_rates.update(m_temp, logT, m_kr_work.data());
+        double log10P = log10(thermo().pressure());
+        m_plog_rates.update_C(&logP);
+        m_cheb_rates.update_C(&log10P);
+
+        double rctot = 1.0 / thermo().molarDensity();
+        for (size_t i = 0; i < nr; i++) {
+            int type = reactionType(i);
+            if (type != PLOG_RXN && type != CHEBYSHEV_RXN) {
+                continue;
+            }
+            double f = (m_kr_work[i] - m_rfn[i]) / dlogP * rctot *
+                       m_perturb[i] * m_q_work[i];
+            for (size_t k = 0; k < m_kk; k++) {
+                m_ropnet_ddC(i, k) += f;
+            }
+        }
+    }
+
+    m_wdot_ddC.setProduct(m_netStoich, m_ropnet_ddC);
+    dwdot.assign(m_wdot_ddC);
+}
+
+void GasKinetics::getNetProductionRates_ddT(doublereal* dwdot)
+{
+    // Changing the temperature at constant density and composition leaves
+    // the species concentrations unchanged.
+    double T = thermo().temperature();
+    double dT = 1e-7 * T;
+    vector_fp wdot0(m_kk);
+    getNetProductionRates(wdot0.data());
+    thermo().setTemperature(T + dT);
+    getNetProductionRates(dwdot);
+    thermo().setTemperature(T);
+    for (size_t k = 0; k < m_kk; k++) {
+        dwdot[k] = (dwdot[k] - wdot0[k]) / dT;
+    }
+}
+
+void GasKinetics::setupDerivatives()
+{
+    if (!m_stoich_ok) {
+        updateStoich();
+    }
+    size_t nr = nReactions();
+
+    // Dependencies of the rates of progress on the species concentrations
+    std::vector<std::pair<size_t, size_t> > pattern;
+    m_reactantStoich.getDerivativePattern(pattern);
+    m_revProductStoich.getDerivativePattern(pattern);
+    vector_fp eff(m_kk);
+    for (size_t i = 0; i < m_3b_concm.workSize(); i++) {
+        m_3b_concm.getEfficiencies(i, eff.data(), m_kk);
+        for (size_t k = 0; k < m_kk; k++) {
+            if (eff[k] != 0.0) {
+                pattern.emplace_back(m_3b_concm.reactionIndex(i), k);
+            }
+        }
+    }
+    for (size_t i = 0; i < m_falloff_concm.workSize(); i++) {
+        m_falloff_concm.getEfficiencies(i, eff.data(), m_kk);
+        for (size_t k = 0; k < m_kk; k++) {
+            if (eff[k] != 0.0) {
+                pattern.emplace_back(m_fallindx[i], k);
+            }
+        }
+    }
+    for (size_t i = 0; i < nr; i++) {
+        if (reactionType(i) == PLOG_RXN || reactionType(i) == CHEBYSHEV_RXN) {
+            for (size_t k = 0; k < m_kk; k++) {
+                pattern.emplace_back(i, k);
+            }
+        }
+    }
+    m_ropnet_ddC.resize(nr, m_kk);
+    m_ropnet_ddC.setPattern(pattern);
+    m_wdot_ddC.setProductPattern(m_netStoich, m_ropnet_ddC);
+
+    m_kf_work.resize(nr);
+    m_kr_work.resize(nr);
+    m_q_work.resize(nr);
+    size_t nfall = m_falloff_high_rates.nReactions();
+    m_pr_work.resize(nfall);
+    m_falloff_work0.resize(nfall);
+    m_falloff_work1.resize(nfall);
+}
+
+void GasKinetics::setDynamicReduction(double tol, const vector<string>& targets,
+                                      size_t interval)
+{
+    if (tol <= 0.0) {
+        if (m_drg_reduced) {
+            // force an update of the rates of all reactions
+            m_temp = 0.0;
+            m_ROP_ok = false;
+        }
+        m_drg_tol = 0.0;
+        m_drg_reduced = false;
+        return;
+    }
+    if (targets.empty()) {
+        throw CanteraError("GasKinetics::setDynamicReduction",
+                           "No target species specified.");
+    }
+    m_drg_targets.clear();
+    for (const auto& name : targets) {
+        size_t k = kineticsSpeciesIndex(name);
+        if (k == npos) {
+            throw CanteraError("GasKinetics::setDynamicReduction",
+                               "Unknown target species '{}'.", name);
+        }
+        m_drg_targets.push_back(k);
+    }
+    m_drg_tol = tol;
+    m_drg_interval = std::max<size_t>(interval, 1);
+    // update the active set at the next evaluation of the rates of progress
+    m_drg_count = m_drg_interval;
+    m_ROP_ok = false;
+}
+
+void GasKinetics::updateActiveReactions()
+{
+    if (m_drg_tol <= 0.0) {
+        throw CanteraError("GasKinetics::updateActiveReactions",
+                           "Dynamic reduction is not enabled.");
+    }
+    size_t nr = nReactions();
+    if (!m_stoich_ok) {
+        updateStoich();
+    }
+    if (m_drg_active.size() != nr || m_drg_keep.size() != m_kk) {
+        setupReduction();
+    }
+
+    // Evaluate the rates of progress of the full mechanism
+    if (m_drg_reduced) {
+        m_drg_reduced = false;
+        m_temp = 0.0;
+    }
+    m_drg_count = 0;
+    m_ROP_ok = false;
+    updateROP();
+    m_drg_count = 0;
+
+    // Denominators of the interaction coefficients
+    const vector<size_t>& rxnStart = m_netStoichT.columnStarts();
+    const vector<size_t>& rxnIndex = m_netStoichT.rowIndices();
+    const vector_fp& nu = m_netStoichT.values();
+    for (size_t k = 0; k < m_kk; k++) {
+        double sum = 0.0;
+        for (size_t n = rxnStart[k]; n < rxnStart[k+1]; n++) {
+            sum += std::abs(nu[n] * m_ropnet[rxnIndex[n]]);
+        }
+        m_drg_denom[k] = sum;
+    }
+
+    // Find the species reachable from the targets through edges with an
+    // interaction coefficient of at least m_drg_tol
+    const vector<size_t>& spStart = m_netStoich.columnStarts();
+    const vector<size_t>& spIndex = m_netStoich.rowIndices();
+    fill(m_drg_keep.begin(), m_drg_keep.end(), 0);
+    m_drg_stack.clear();
+    for (size_t k : m_drg_targets) {
+        if (!m_drg_keep[k]) {
+            m_drg_keep[k] = 1;
+            m_drg_stack.push_back(k);
+        }
+    }
+    while (!m_drg_stack.empty()) {
+        size_t a = m_drg_stack.back();
+        m_drg_stack.pop_back();
+        if (m_drg_denom[a] == 0.0) {
+            continue;
+        }
+        for (size_t n = rxnStart[a]; n < rxnStart[a+1]; n++) {
+            size_t i = rxnIndex[n];
+            double c = std::abs(nu[n] * m_ropnet[i]);
+            for (size_t m = spStart[i]; m < spStart[i+1]; m++) {
+                m_drg_rab[spIndex[m]] += c;
+            }
+        }
+        double threshold = m_drg_tol * m_drg_denom[a];
+        for (size_t n = rxnStart[a]; n < rxnStart[a+1]; n++) {
+            size_t i = rxnIndex[n];
+            for (size_t m = spStart[i]; m < spStart[i+1]; m++) {
+                size_t b = spIndex[m];
+                if (!m_drg_keep[b] && m_drg_rab[b] >= threshold) {
+                    m_drg_keep[b] = 1;
+                    m_drg_stack.push_back(b);
+                }
+                m_drg_rab[b] = 0.0;
+            }
+        }
+    }
+
+    // Reactions are active if all of the participating species are kept
+    m_drg_inactive.clear();
+    m_drg_rev.clear();
+    m_drg_rates = Rate1<Arrhenius>();
+    for (size_t i = 0; i < nr; i++) {
+        bool active = true;
+        for (size_t m = spStart[i]; m < spStart[i+1]; m++) {
+            if (!m_drg_keep[spIndex[m]]) {
+                active = false;
+                break;
+            }
+        }
+        m_drg_active[i] = active;
+        if (!active) {
+            m_drg_inactive.push_back(i);
+            m_rfn[i] = 0.0;
+            m_rkcn[i] = 0.0;
+            m_ropf[i] = m_ropr[i] = m_ropnet[i] = 0.0;
+            continue;
+        }
+        int type = reactionType(i);
+        if (type == ELEMENTARY_RXN || type == THREE_BODY_RXN) {
+            m_drg_rates.install(i,
+                dynamic_cast<ElementaryReaction&>(*m_reactions[i]).rate);
+        }
+        if (m_reactions[i]->reversible) {
+            m_drg_rev.push_back(i);
+        }
+    }
+    m_drg_reduced = true;
+}
+
+size_t GasKinetics::nActiveReactions() const
+{
+    if (!m_drg_reduced) {
+        return nReactions();
+    }
+    return nReactions() - m_drg_inactive.size();
+}
+
+bool GasKinetics::isActiveReaction(size_t i) const
+{
+    checkReactionIndex(i);
+    return !m_drg_reduced || m_drg_active[i];
+}
+
+void GasKinetics::setupReduction()
+{
+    size_t nr = nReactions();
+    m_drg_keep.assign(m_kk, 0);
+    m_drg_active.assign(nr, 1);
+    m_drg_denom.assign(m_kk, 0.0);
+    m_drg_rab.assign(m_kk, 0.0);
+}
+
 bool GasKinetics::addReaction(shared_ptr<Reaction> r)
 {
     // operations common to all reaction types
@@ -241,6 +782,11 @@ bool GasKinetics::addReaction(shared_ptr<Reaction> r)
     if (!added) {
         return false;
     }
+    if (m_drg_tol > 0.0) {
+        // evaluate the full mechanism until the active set is updated
+        m_drg_reduced = false;
+        m_drg_count = m_drg_interval;
+    }
 
     switch (r->reaction_type) {
     case ELEMENTARY_RXN:
@@ -263,6 +809,10 @@ bool GasKinetics::addReaction(shared_ptr<Reaction> r)
         throw CanteraError("GasKinetics::addReaction",
             "Unknown reaction type specified: {}", r->reaction_type);
     }
+
+    if (r->reversible) {
+        m_kc_work.push_back(0.0);
+    }
     return true;
 }
 
@@ -358,6 +908,10 @@ void GasKinetics::modifyReaction(size_t i, shared_ptr<Reaction> rNew)
     m_ROP_ok = false;
     m_temp += 0.1234;
     m_pres += 0.1234;
+    if (m_drg_reduced) {
+        // the rate expressions of the active set need to be updated
+        m_drg_count = m_drg_interval;
+    }
 }
 
 void GasKinetics::modifyThreeBodyReaction(size_t i, ThreeBodyReaction& r)
@@ -16,6 +16,7 @@ using namespace std;
 namespace Cantera
 {
 Kinetics::Kinetics() :
+    m_stoich_ok(false),
     m_kk(0),
     m_thermo(0),
     m_surfphase(npos),
@@ -44,6 +45,9 @@ Kinetics& Kinetics::operator=(const Kinetics& right)
     m_reactantStoich = right.m_reactantStoich;
     m_revProductStoich = right.m_revProductStoich;
     m_irrevProductStoich = right.m_irrevProductStoich;
+    m_netStoich = right.m_netStoich;
+    m_netStoichT = right.m_netStoichT;
+    m_stoich_ok = right.m_stoich_ok;
     m_kk = right.m_kk;
     m_perturb = right.m_perturb;
     m_reactions = right.m_reactions;
@@ -61,6 +65,7 @@ Kinetics& Kinetics::operator=(const Kinetics& right)
     m_ropr = right.m_ropr;
     m_ropnet = right.m_ropnet;
     m_skipUndeclaredSpecies = right.m_skipUndeclaredSpecies;
+    m_skipUndeclaredThirdBodies = right.m_skipUndeclaredThirdBodies;
 
     return *this;
 }
@@ -443,9 +448,45 @@ void Kinetics::getRevReactionDelta(const double* prop, double* deltaProp)
     m_reactantStoich.decrementReactions(prop, deltaProp);
 }
 
+void Kinetics::updateStoich()
+{
+    m_reactantStoich.finalize();
+    m_revProductStoich.finalize();
+    m_irrevProductStoich.finalize();
+
+    // Net stoichiometric coefficients of each species
+    vector<map<size_t, double> > nu(m_kk);
+    m_reactantStoich.addCoefficients(nu, -1.0);
+    m_revProductStoich.addCoefficients(nu, 1.0);
+    m_irrevProductStoich.addCoefficients(nu, 1.0);
+    vector<pair<size_t, size_t> > pattern;
+    for (size_t k = 0; k < m_kk; k++) {
+        for (const auto& c : nu[k]) {
+            pattern.emplace_back(k, c.first);
+        }
+    }
+    m_netStoich.resize(m_kk, nReactions());
+    m_netStoich.setPattern(pattern);
+    for (auto& entry : pattern) {
+        std::swap(entry.first, entry.second);
+    }
+    m_netStoichT.resize(nReactions(), m_kk);
+    m_netStoichT.setPattern(pattern);
+    for (size_t k = 0; k < m_kk; k++) {
+        for (const auto& c : nu[k]) {
+            m_netStoich(k, c.first) = c.second;
+            m_netStoichT(c.first, k) = c.second;
+        }
+    }
+    m_stoich_ok = true;
+}
+
 void Kinetics::getCreationRates(double* cdot)
 {
     updateROP();
+    if (!m_stoich_ok) {
+        updateStoich();
+    }
 
     // zero out the output array
     fill(cdot, cdot + m_kk, 0.0);
@@ -461,6 +502,9 @@ void Kinetics::getCreationRates(double* cdot)
 void Kinetics::getDestructionRates(doublereal* ddot)
 {
     updateROP();
+    if (!m_stoich_ok) {
+        updateStoich();
+    }
 
     fill(ddot, ddot + m_kk, 0.0);
     // the reverse direction destroys products in reversible reactions
@@ -472,13 +516,41 @@ void Kinetics::getDestructionRates(doublereal* ddot)
 void Kinetics::getNetProductionRates(doublereal* net)
 {
     updateROP();
+    if (!m_stoich_ok || m_netStoichT.nColumns() != m_kk) {
+        updateStoich();
+    }
+
+    // product of the net stoichiometric coefficients and the net rates of
+    // progress, evaluated one species at a time with two partial sums
+    const double* ropnet = m_ropnet.data();
+    const vector<size_t>& start = m_netStoichT.columnStarts();
+    const vector<size_t>& rxn = m_netStoichT.rowIndices();
+    const vector_fp& nu = m_netStoichT.values();
+    for (size_t k = 0; k < m_kk; k++) {
+        double sum0 = 0.0, sum1 = 0.0;
+        size_t n = start[k];
+        size_t end = start[k+1];
+        for (; n + 1 < end; n += 2) {
+            sum0 += nu[n] * ropnet[rxn[n]];
+            sum1 += nu[n+1] * ropnet[rxn[n+1]];
+        }
+        if (n < end) {
+            sum0 += nu[n] * ropnet[rxn[n]];
+        }
+        net[k] = sum0 + sum1;
+    }
+}
 
-    fill(net, net + m_kk, 0.0);
-    // products are created for positive net rate of progress
-    m_revProductStoich.incrementSpecies(m_ropnet.data(), net);
-    m_irrevProductStoich.incrementSpecies(m_ropnet.data(), net);
-    // reactants are destroyed for positive net rate of progress
-    m_reactantStoich.decrementSpecies(m_ropnet.data(), net);
+void Kinetics::getBatchNetProductionRates(size_t nStates, const double* T,
+                                          const double* P, const double* Y,
+                                          double* wdot)
+{
+    thermo_t& phase = thermo(reactionPhaseIndex());
+    size_t nsp = phase.nSpecies();
+    for (size_t m = 0; m < nStates; m++) {
+        phase.setState_TPY(T[m], P[m], Y + m*nsp);
+        getNetProductionRates(wdot + m*m_kk);
+    }
 }
 
 void Kinetics::addPhase(thermo_t& thermo)
@@ -613,6 +685,7 @@ bool Kinetics::addReaction(shared_ptr<Reaction> r)
     }
 
     m_reactions.push_back(r);
+    m_stoich_ok = false;
     m_rfn.push_back(0.0);
     m_rkcn.push_back(0.0);
     m_ropf.push_back(0.0);
@@ -16,6 +16,7 @@
 #include "cantera/kinetics/Reaction.h"
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/ctml.h"
+#include "cantera/base/ThreadPool.h"
 
 #include <cstring>
 
@@ -39,6 +40,8 @@ bool installReactionArrays(const XML_Node& p, Kinetics& kin,
         kin.finalize();
         return false;
     }
+    size_t nThreads = importThreads();
+    std::unique_ptr<ThreadPool> pool;
     for (size_t n = 0; n < rarrays.size(); n++) {
         // Go get a reference to the current XML element, reactionArray. We will
         // process this element now.
@@ -75,12 +78,10 @@ bool installReactionArrays(const XML_Node& p, Kinetics& kin,
         // reactions if there are no include fields.
         vector<XML_Node*> incl = rxns.getChildren("include");
         vector<XML_Node*> allrxns = rdata->getChildren("reaction");
+        vector<const XML_Node*> nodes;
         // if no 'include' directive, then include all reactions
         if (incl.empty()) {
-            for (size_t i = 0; i < allrxns.size(); i++) {
-                kin.addReaction(newReaction(*allrxns[i]));
-                ++itot;
-            }
+            nodes.assign(allrxns.begin(), allrxns.end());
         } else {
             for (size_t nii = 0; nii < incl.size(); nii++) {
                 const XML_Node& ii = *incl[nii];
@@ -109,13 +110,47 @@ bool installReactionArrays(const XML_Node& p, Kinetics& kin,
                         // do a lexical min max and operation. This sometimes
                         // has surprising results.
                         if ((rxid >= imin) && (rxid <= imax)) {
-                            kin.addReaction(newReaction(*r));
-                            ++itot;
+                            nodes.push_back(r);
                         }
                     }
                 }
             }
         }
+
+        // With more than one thread, create all of the Reaction objects for
+        // this reactionArray before adding any of them. Exceptions are
+        // rethrown when the corresponding reaction is reached below, so that
+        // the reported error is the same as when the reactions are created
+        // one at a time.
+        vector<shared_ptr<Reaction> > reactions;
+        vector<std::exception_ptr> errors;
+        if (nThreads != 1 && nodes.size() > 1) {
+            reactions.resize(nodes.size());
+            errors.resize(nodes.size());
+            if (!pool) {
+                pool.reset(new ThreadPool(
+                    nThreads ? nThreads : ThreadPool::hardwareThreads()));
+            }
+            pool->run(nodes.size(), [&](size_t i, size_t) {
+                try {
+                    reactions[i] = newReaction(*nodes[i]);
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            });
+        }
+
+        for (size_t i = 0; i < nodes.size(); i++) {
+            if (reactions.empty()) {
+                kin.addReaction(newReaction(*nodes[i]));
+            } else {
+                if (errors[i]) {
+                    std::rethrow_exception(errors[i]);
+                }
+                kin.addReaction(reactions[i]);
+            }
+            ++itot;
+        }
     }
 
     if (check_for_duplicates) {
@@ -0,0 +1,242 @@
+//! @file BlockTridiagLU.cpp LU factorization of block-tridiagonal matrices
+
+#include "cantera/numerics/BlockTridiagLU.h"
+#include "cantera/numerics/ctlapack.h"
+#include "cantera/base/ctexceptions.h"
+
+using namespace std;
+
+namespace Cantera
+{
+
+BlockTridiagLU::BlockTridiagLU() :
+    m_n(0),
+    m_minRcond(1.0e-10),
+    m_zero(0.0)
+{
+}
+
+void BlockTridiagLU::setBlockSizes(const vector<size_t>& sizes)
+{
+    size_t nb = sizes.size();
+    m_size = sizes;
+    m_loc.resize(nb);
+    m_diagStart.resize(nb);
+    m_lowerStart.resize(nb);
+    m_upperStart.resize(nb);
+    m_n = 0;
+    size_t ndiag = 0, nlower = 0, nupper = 0, nmax = 0;
+    for (size_t j = 0; j < nb; j++) {
+        m_loc[j] = m_n;
+        m_diagStart[j] = ndiag;
+        m_lowerStart[j] = nlower;
+        m_upperStart[j] = nupper;
+        m_n += sizes[j];
+        nmax = std::max(nmax, sizes[j]);
+        ndiag += sizes[j] * sizes[j];
+        if (j > 0) {
+            nlower += sizes[j] * sizes[j-1];
+        }
+        if (j + 1 < nb) {
+            nupper += sizes[j] * sizes[j+1];
+        }
+    }
+    // Release the storage for the previous block sizes, which may be larger
+    vector_fp(ndiag, 0.0).swap(m_diag);
+    vector_fp(nlower, 0.0).swap(m_lower);
+    vector_fp(nupper, 0.0).swap(m_upper);
+    vector_fp(ndiag, 0.0).swap(m_lu);
+    vector_fp(nupper, 0.0).swap(m_gain);
+    vector_int(m_n, 0).swap(m_ipiv);
+    vector_fp(m_n, 1.0).swap(m_rowScale);
+    vector_fp(m_n, 1.0).swap(m_colScale);
+    m_work.assign(4 * nmax, 0.0);
+    m_iwork.assign(nmax, 0);
+}
+
+void BlockTridiagLU::zero()
+{
+    fill(m_diag.begin(), m_diag.end(), 0.0);
+    fill(m_lower.begin(), m_lower.end(), 0.0);
+    fill(m_upper.begin(), m_upper.end(), 0.0);
+}
+
+double* BlockTridiagLU::block(size_t i, size_t j)
+{
+    if (j == i) {
+        return m_diag.data() + m_diagStart[i];
+    } else if (j + 1 == i) {
+        return m_lower.data() + m_lowerStart[i];
+    } else if (j == i + 1) {
+        return m_upper.data() + m_upperStart[i];
+    }
+    throw CanteraError("BlockTridiagLU::block", "Block ({}, {}) is not part "
+        "of the block-tridiagonal structure", i, j);
+}
+
+const double* BlockTridiagLU::block(size_t i, size_t j) const
+{
+    return const_cast<BlockTridiagLU*>(this)->block(i, j);
+}
+
+size_t BlockTridiagLU::blockIndex(size_t i) const
+{
+    // Empty blocks start at the same row as the following block, so this
+    // finds the last block starting at or before row i
+    return upper_bound(m_loc.begin(), m_loc.end(), i) - m_loc.begin() - 1;
+}
+
+double& BlockTridiagLU::value(size_t i, size_t j)
+{
+    size_t bi = blockIndex(i);
+    size_t bj = blockIndex(j);
+    if (bj + 1 < bi || bj > bi + 1) {
+        return m_zero;
+    }
+    return block(bi, bj)[i - m_loc[bi] + m_size[bi] * (j - m_loc[bj])];
+}
+
+double BlockTridiagLU::value(size_t i, size_t j) const
+{
+    size_t bi = blockIndex(i);
+    size_t bj = blockIndex(j);
+    if (bj + 1 < bi || bj > bi + 1) {
+        return 0.0;
+    }
+    return block(bi, bj)[i - m_loc[bi] + m_size[bi] * (j - m_loc[bj])];
+}
+
+int BlockTridiagLU::factor()
+{
+    size_t nb = m_size.size();
+    for (size_t j = 0; j < nb; j++) {
+        size_t n = m_size[j];
+        size_t i0 = m_loc[j];
+        double* D = m_lu.data() + m_diagStart[j];
+        copy(m_diag.begin() + m_diagStart[j],
+             m_diag.begin() + m_diagStart[j] + n * n, D);
+        if (j > 0 && n != 0 && m_size[j-1] != 0) {
+            // D_j - L_j * G_{j-1}
+            size_t m = m_size[j-1];
+            ct_dgemm(ctlapack::NoTranspose, ctlapack::NoTranspose, n, n, m,
+                     -1.0, m_lower.data() + m_lowerStart[j], n,
+                     m_gain.data() + m_upperStart[j-1], m, 1.0, D, n);
+        }
+
+        if (n == 0) {
+            continue;
+        }
+        // Equilibrate the block, so that the condition number estimate is not
+        // dominated by the different scales of the equations and variables,
+        // and factor the scaled block R_j D_j C_j
+        double* rs = m_rowScale.data() + i0;
+        double* cs = m_colScale.data() + i0;
+        fill(rs, rs + n, 0.0);
+        for (size_t q = 0; q < n; q++) {
+            for (size_t p = 0; p < n; p++) {
+                rs[p] = std::max(rs[p], std::abs(D[p + n*q]));
+            }
+        }
+        for (size_t p = 0; p < n; p++) {
+            if (rs[p] == 0.0) {
+                return static_cast<int>(i0 + p) + 1;
+            }
+            rs[p] = 1.0 / rs[p];
+        }
+        for (size_t q = 0; q < n; q++) {
+            double colmax = 0.0;
+            for (size_t p = 0; p < n; p++) {
+                D[p + n*q] *= rs[p];
+                colmax = std::max(colmax, std::abs(D[p + n*q]));
+            }
+            if (colmax == 0.0) {
+                return static_cast<int>(i0 + q) + 1;
+            }
+            cs[q] = 1.0 / colmax;
+            for (size_t p = 0; p < n; p++) {
+                D[p + n*q] *= cs[q];
+            }
+        }
+
+        int info = 0;
+        double anorm = ct_dlange('1', n, n, D, n, 0);
+        ct_dgetrf(n, n, D, n, &m_ipiv[i0], info);
+        if (info != 0) {
+            return (info > 0) ? static_cast<int>(i0) + info : info;
+        }
+        double rcond = ct_dgecon('1', n, D, n, anorm, m_work.data(),
+                                 m_iwork.data(), info);
+        if (info != 0 || rcond < m_minRcond) {
+            return static_cast<int>(i0) + 1;
+        }
+
+        if (j + 1 < nb && m_size[j+1] != 0) {
+            // G_j = D_j^{-1} U_j = C_j (R_j D_j C_j)^{-1} R_j U_j
+            size_t m = m_size[j+1];
+            double* G = m_gain.data() + m_upperStart[j];
+            const double* U = m_upper.data() + m_upperStart[j];
+            for (size_t q = 0; q < m; q++) {
+                for (size_t p = 0; p < n; p++) {
+                    G[p + n*q] = rs[p] * U[p + n*q];
+                }
+            }
+            ct_dgetrs(ctlapack::NoTranspose, n, m, D, n, &m_ipiv[i0], G, n,
+                      info);
+            if (info != 0) {
+                return info;
+            }
+            for (size_t q = 0; q < m; q++) {
+                for (size_t p = 0; p < n; p++) {
+                    G[p + n*q] *= cs[p];
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+void BlockTridiagLU::solve(double* b)
+{
+    size_t nb = m_size.size();
+    int info = 0;
+    // Forward substitution: y_j = D_j^{-1} (b_j - L_j y_{j-1}), where
+    // D_j^{-1} = C_j (R_j D_j C_j)^{-1} R_j
+    for (size_t j = 0; j < nb; j++) {
+        size_t n = m_size[j];
+        double* y = b + m_loc[j];
+        if (j > 0) {
+            size_t m = m_size[j-1];
+            const double* L = m_lower.data() + m_lowerStart[j];
+            if (n != 0 && m != 0) {
+                ct_dgemv(ctlapack::ColMajor, ctlapack::NoTranspose, n, m,
+                         -1.0, L, n, b + m_loc[j-1], 1, 1.0, y, 1);
+            }
+        }
+        if (n != 0) {
+            const double* rs = m_rowScale.data() + m_loc[j];
+            const double* cs = m_colScale.data() + m_loc[j];
+            for (size_t p = 0; p < n; p++) {
+                y[p] *= rs[p];
+            }
+            ct_dgetrs(ctlapack::NoTranspose, n, 1,
+                      m_lu.data() + m_diagStart[j], n, &m_ipiv[m_loc[j]],
+                      y, n, info);
+            for (size_t p = 0; p < n; p++) {
+                y[p] *= cs[p];
+            }
+        }
+    }
+
+    // Back substitution: x_{j-1} = y_{j-1} - G_{j-1} x_j
+    for (size_t j = nb; j-- > 1;) {
+        size_t n = m_size[j-1];
+        size_t m = m_size[j];
+        if (n != 0 && m != 0) {
+            ct_dgemv(ctlapack::ColMajor, ctlapack::NoTranspose, n, m, -1.0,
+                     m_gain.data() + m_upperStart[j-1], n, b + m_loc[j], 1,
+                     1.0, b + m_loc[j-1], 1);
+        }
+    }
+}
+
+}
@@ -77,6 +77,70 @@ extern "C" {
         return 0; // successful evaluation
     }
 
+    //! Function called by cvodes to evaluate the Jacobian when a direct dense
+    //! linear solver with a user-supplied Jacobian is used. Delegates to
+    //! FuncEval::evalJacobian.
+    static int cvodes_jac(sd_size_t N, realtype t, N_Vector y, N_Vector fy,
+                          DlsMat J, void* f_data, N_Vector tmp1,
+                          N_Vector tmp2, N_Vector tmp3)
+    {
+        try {
+            FuncData* d = (FuncData*)f_data;
+            double* p = (d->m_pars.size() == 0) ? NULL : d->m_pars.data();
+            // The columns of the dense matrix are stored contiguously
+            d->m_func->evalJacobian(t, NV_DATA_S(y), NV_DATA_S(fy), p,
+                                    DENSE_COL(J, 0));
+        } catch (CanteraError& err) {
+            std::cerr << err.what() << std::endl;
+            return 1; // possibly recoverable error
+        } catch (...) {
+            std::cerr << "cvodes_jac: unhandled exception" << std::endl;
+            return -1; // unrecoverable error
+        }
+        return 0;
+    }
+
+    //! Function called by cvodes to prepare the preconditioner for the
+    //! iteration matrix. Delegates to FuncEval::preconditionerSetup.
+    static int cvodes_prec_setup(realtype t, N_Vector y, N_Vector fy,
+                                 booleantype jok, booleantype* jcurPtr,
+                                 realtype gamma, void* f_data,
+                                 N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
+    {
+        try {
+            FuncData* d = (FuncData*)f_data;
+            d->m_func->preconditionerSetup(t, NV_DATA_S(y), gamma, jok);
+            *jcurPtr = !jok;
+        } catch (CanteraError& err) {
+            std::cerr << err.what() << std::endl;
+            return 1; // possibly recoverable error
+        } catch (...) {
+            std::cerr << "cvodes_prec_setup: unhandled exception" << std::endl;
+            return -1; // unrecoverable error
+        }
+        return 0;
+    }
+
+    //! Function called by cvodes to solve the preconditioner system.
+    //! Delegates to FuncEval::preconditionerSolve.
+    static int cvodes_prec_solve(realtype t, N_Vector y, N_Vector fy,
+                                 N_Vector r, N_Vector z, realtype gamma,
+                                 realtype delta, int lr, void* f_data,
+                                 N_Vector tmp)
+    {
+        try {
+            FuncData* d = (FuncData*)f_data;
+            d->m_func->preconditionerSolve(NV_DATA_S(r), NV_DATA_S(z));
+        } catch (CanteraError& err) {
+            std::cerr << err.what() << std::endl;
+            return 1; // possibly recoverable error
+        } catch (...) {
+            std::cerr << "cvodes_prec_solve: unhandled exception" << std::endl;
+            return -1; // unrecoverable error
+        }
+        return 0;
+    }
+
     //! Function called by CVodes when an error is encountered instead of
     //! writing to stdout. Here, save the error message provided by CVodes so
     //! that it can be included in the subsequently raised CanteraError.
@@ -365,10 +429,22 @@ void CVodesIntegrator::applyOptions()
         #else
             CVDense(m_cvode_mem, N);
         #endif
+    } else if (m_type == DENSE + JAC) {
+        sd_size_t N = static_cast<sd_size_t>(m_neq);
+        #if SUNDIALS_USE_LAPACK
+            CVLapackDense(m_cvode_mem, N);
+        #else
+            CVDense(m_cvode_mem, N);
+        #endif
+        CVDlsSetDenseJacFn(m_cvode_mem, cvodes_jac);
     } else if (m_type == DIAG) {
         CVDiag(m_cvode_mem);
     } else if (m_type == GMRES) {
         CVSpgmr(m_cvode_mem, PREC_NONE, 0);
+    } else if (m_type == GMRES + PRECON) {
+        CVSpgmr(m_cvode_mem, PREC_LEFT, 0);
+        CVSpilsSetPreconditioner(m_cvode_mem, cvodes_prec_setup,
+                                 cvodes_prec_solve);
     } else if (m_type == BAND + NOJAC) {
         sd_size_t N = static_cast<sd_size_t>(m_neq);
         long int nu = m_mupper;
@@ -0,0 +1,229 @@
+//! @file SparseLU.cpp LU factorization of sparse matrices
+
+#include "cantera/numerics/SparseLU.h"
+#include "cantera/base/ctexceptions.h"
+
+#include <set>
+#include <algorithm>
+
+using namespace std;
+
+namespace Cantera
+{
+
+SparseLU::SparseLU() :
+    m_n(0)
+{
+}
+
+void SparseLU::analyze(const SparseMatrix& A)
+{
+    m_n = A.nRows();
+    const vector<size_t>& colStart = A.columnStarts();
+    const vector<size_t>& rowIndex = A.rowIndices();
+
+    // Adjacency lists of the graph of A + A^T, excluding the diagonal
+    vector<set<size_t> > adj(m_n);
+    for (size_t j = 0; j < m_n; j++) {
+        for (size_t n = colStart[j]; n < colStart[j+1]; n++) {
+            size_t i = rowIndex[n];
+            if (i != j) {
+                adj[i].insert(j);
+                adj[j].insert(i);
+            }
+        }
+    }
+
+    // Minimum degree ordering. Eliminating a node connects all of its
+    // remaining neighbors, which are the off-diagonal entries in the
+    // corresponding row of U (and column of L).
+    set<pair<size_t, size_t> > degree; // (degree, node)
+    for (size_t i = 0; i < m_n; i++) {
+        degree.emplace(adj[i].size(), i);
+    }
+    vector<vector<size_t> > upper(m_n);
+    m_perm.resize(m_n);
+    for (size_t step = 0; step < m_n; step++) {
+        size_t p = degree.begin()->second;
+        degree.erase(degree.begin());
+        m_perm[step] = p;
+        upper[step].assign(adj[p].begin(), adj[p].end());
+        for (size_t a : upper[step]) {
+            degree.erase({adj[a].size(), a});
+            adj[a].erase(p);
+            for (size_t b : upper[step]) {
+                if (b != a) {
+                    adj[a].insert(b);
+                }
+            }
+            degree.emplace(adj[a].size(), a);
+        }
+        adj[p].clear();
+    }
+    m_iperm.resize(m_n);
+    for (size_t i = 0; i < m_n; i++) {
+        m_iperm[m_perm[i]] = i;
+    }
+
+    // Pattern of L, by rows. Visiting the pivots in order produces the
+    // column indices of each row in increasing order.
+    vector<vector<size_t> > lower(m_n);
+    for (size_t k = 0; k < m_n; k++) {
+        for (auto& i : upper[k]) {
+            i = m_iperm[i];
+            lower[i].push_back(k);
+        }
+        sort(upper[k].begin(), upper[k].end());
+    }
+
+    m_rowStart.assign(1, 0);
+    m_colIndex.clear();
+    m_diag.resize(m_n);
+    for (size_t i = 0; i < m_n; i++) {
+        m_colIndex.insert(m_colIndex.end(), lower[i].begin(), lower[i].end());
+        m_diag[i] = m_colIndex.size();
+        m_colIndex.push_back(i);
+        m_colIndex.insert(m_colIndex.end(), upper[i].begin(), upper[i].end());
+        m_rowStart.push_back(m_colIndex.size());
+    }
+    m_values.resize(m_colIndex.size());
+    m_work.assign(m_n, 0.0);
+
+    // Location of each entry of A within the factors
+    m_map.resize(rowIndex.size());
+    for (size_t j = 0; j < m_n; j++) {
+        size_t pj = m_iperm[j];
+        for (size_t n = colStart[j]; n < colStart[j+1]; n++) {
+            size_t pi = m_iperm[rowIndex[n]];
+            auto begin = m_colIndex.begin() + m_rowStart[pi];
+            auto end = m_colIndex.begin() + m_rowStart[pi+1];
+            m_map[n] = lower_bound(begin, end, pj) - m_colIndex.begin();
+        }
+    }
+    m_colStartA = colStart;
+    m_rowIndexA = rowIndex;
+}
+
+void SparseLU::factor(const SparseMatrix& A)
+{
+    if (A.nRows() != A.nColumns()) {
+        throw CanteraError("SparseLU::factor", "Matrix must be square, but "
+            "has size {} by {}", A.nRows(), A.nColumns());
+    }
+    if (A.nRows() != m_n || A.columnStarts() != m_colStartA ||
+        A.rowIndices() != m_rowIndexA) {
+        analyze(A);
+    }
+
+    fill(m_values.begin(), m_values.end(), 0.0);
+    const vector_fp& values = A.values();
+    for (size_t n = 0; n < values.size(); n++) {
+        m_values[m_map[n]] += values[n];
+    }
+
+    // Row-by-row elimination. The symbolic analysis guarantees that every
+    // entry updated while eliminating row i is part of the pattern of row i.
+    double* w = m_work.data();
+    for (size_t i = 0; i < m_n; i++) {
+        for (size_t p = m_rowStart[i]; p < m_rowStart[i+1]; p++) {
+            w[m_colIndex[p]] = m_values[p];
+        }
+        for (size_t p = m_rowStart[i]; p < m_diag[i]; p++) {
+            size_t k = m_colIndex[p];
+            double lik = w[k] / m_values[m_diag[k]];
+            w[k] = lik;
+            for (size_t q = m_diag[k] + 1; q < m_rowStart[k+1]; q++) {
+                w[m_colIndex[q]] -= lik * m_values[q];
+            }
+        }
+        if (w[i] == 0.0) {
+            throw CanteraError("SparseLU::factor", "Zero pivot encountered "
+                "for row/column {}", m_perm[i]);
+        }
+        for (size_t p = m_rowStart[i]; p < m_rowStart[i+1]; p++) {
+            m_values[p] = w[m_colIndex[p]];
+            w[m_colIndex[p]] = 0.0;
+        }
+    }
+}
+
+void SparseLU::solve(double* b)
+{
+    double* x = m_work.data();
+    for (size_t i = 0; i < m_n; i++) {
+        x[i] = b[m_perm[i]];
+    }
+    // Forward substitution with L, which has a unit diagonal
+    for (size_t i = 0; i < m_n; i++) {
+        for (size_t p = m_rowStart[i]; p < m_diag[i]; p++) {
+            x[i] -= m_values[p] * x[m_colIndex[p]];
+        }
+    }
+    // Back substitution with U
+    for (size_t i = m_n; i-- > 0;) {
+        for (size_t p = m_diag[i] + 1; p < m_rowStart[i+1]; p++) {
+            x[i] -= m_values[p] * x[m_colIndex[p]];
+        }
+        x[i] /= m_values[m_diag[i]];
+    }
+    for (size_t i = 0; i < m_n; i++) {
+        b[m_perm[i]] = x[i];
+        x[i] = 0.0;
+    }
+}
+
+void SparseLUPreconditioner::setup(const SparseMatrix& jac, double gamma)
+{
+    size_t n = jac.nRows();
+    if (jac.nColumns() != n) {
+        throw CanteraError("SparseLUPreconditioner::setup", "Jacobian must be "
+            "square, but has size {} by {}", n, jac.nColumns());
+    }
+    const vector<size_t>& colStart = jac.columnStarts();
+    const vector<size_t>& rowIndex = jac.rowIndices();
+    if (m_P.nRows() != n || colStart != m_colStartJ ||
+        rowIndex != m_rowIndexJ) {
+        // Pattern of the iteration matrix is that of the Jacobian plus the
+        // diagonal
+        vector<pair<size_t, size_t> > pattern;
+        for (size_t j = 0; j < n; j++) {
+            pattern.emplace_back(j, j);
+            for (size_t k = colStart[j]; k < colStart[j+1]; k++) {
+                pattern.emplace_back(rowIndex[k], j);
+            }
+        }
+        m_P.resize(n, n);
+        m_P.setPattern(pattern);
+        m_map.resize(rowIndex.size());
+        for (size_t j = 0; j < n; j++) {
+            for (size_t k = colStart[j]; k < colStart[j+1]; k++) {
+                m_map[k] = m_P.index(rowIndex[k], j);
+            }
+        }
+        m_diag.resize(n);
+        for (size_t j = 0; j < n; j++) {
+            m_diag[j] = m_P.index(j, j);
+        }
+        m_colStartJ = colStart;
+        m_rowIndexJ = rowIndex;
+    }
+
+    vector_fp& P = m_P.values();
+    const vector_fp& J = jac.values();
+    m_P.zero();
+    for (size_t k = 0; k < J.size(); k++) {
+        P[m_map[k]] -= gamma * J[k];
+    }
+    for (size_t j = 0; j < n; j++) {
+        P[m_diag[j]] += 1.0;
+    }
+    m_lu.factor(m_P);
+}
+
+void SparseLUPreconditioner::solve(const double* rhs, double* x)
+{
+    copy(rhs, rhs + m_lu.size(), x);
+    m_lu.solve(x);
+}
+
+}
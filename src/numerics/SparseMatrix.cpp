@@ -0,0 +1,181 @@
+//! @file SparseMatrix.cpp Sparse matrices in compressed column format.
+
+#include "cantera/numerics/SparseMatrix.h"
+#include "cantera/numerics/DenseMatrix.h"
+#include "cantera/base/ctexceptions.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace Cantera
+{
+
+SparseMatrix::SparseMatrix() :
+    m_nrows(0),
+    m_ncols(0),
+    m_colStart(1, 0)
+{
+}
+
+SparseMatrix::SparseMatrix(size_t n, size_t m) :
+    m_nrows(n),
+    m_ncols(m),
+    m_colStart(m+1, 0),
+    m_work(n, 0.0)
+{
+}
+
+void SparseMatrix::resize(size_t n, size_t m)
+{
+    m_nrows = n;
+    m_ncols = m;
+    m_colStart.assign(m+1, 0);
+    m_rowIndex.clear();
+    m_values.clear();
+    m_work.assign(n, 0.0);
+}
+
+void SparseMatrix::setPattern(const vector<pair<size_t, size_t> >& entries)
+{
+    // Sort by column, then by row, and remove duplicates
+    vector<pair<size_t, size_t> > sorted;
+    sorted.reserve(entries.size());
+    for (const auto& entry : entries) {
+        if (entry.first >= m_nrows || entry.second >= m_ncols) {
+            throw CanteraError("SparseMatrix::setPattern", "Entry ({}, {}) is "
+                "out of range for a {} by {} matrix.", entry.first,
+                entry.second, m_nrows, m_ncols);
+        }
+        sorted.emplace_back(entry.second, entry.first);
+    }
+    sort(sorted.begin(), sorted.end());
+    sorted.erase(unique(sorted.begin(), sorted.end()), sorted.end());
+
+    m_colStart.assign(m_ncols+1, 0);
+    m_rowIndex.resize(sorted.size());
+    for (size_t n = 0; n < sorted.size(); n++) {
+        m_colStart[sorted[n].first + 1]++;
+        m_rowIndex[n] = sorted[n].second;
+    }
+    for (size_t j = 0; j < m_ncols; j++) {
+        m_colStart[j+1] += m_colStart[j];
+    }
+    m_values.assign(sorted.size(), 0.0);
+}
+
+void SparseMatrix::setProductPattern(const SparseMatrix& A,
+                                     const SparseMatrix& B)
+{
+    if (A.nColumns() != B.nRows()) {
+        throw CanteraError("SparseMatrix::setProductPattern", "Inner "
+            "dimensions do not match: {} != {}", A.nColumns(), B.nRows());
+    }
+    resize(A.nRows(), B.nColumns());
+
+    // Column j of A*B is a linear combination of the columns of A selected by
+    // the nonzero entries in column j of B.
+    vector<size_t> marker(m_nrows, npos);
+    for (size_t j = 0; j < m_ncols; j++) {
+        size_t start = m_rowIndex.size();
+        for (size_t n = B.m_colStart[j]; n < B.m_colStart[j+1]; n++) {
+            size_t k = B.m_rowIndex[n];
+            for (size_t p = A.m_colStart[k]; p < A.m_colStart[k+1]; p++) {
+                size_t i = A.m_rowIndex[p];
+                if (marker[i] != j) {
+                    marker[i] = j;
+                    m_rowIndex.push_back(i);
+                }
+            }
+        }
+        sort(m_rowIndex.begin() + start, m_rowIndex.end());
+        m_colStart[j+1] = m_rowIndex.size();
+    }
+    m_values.assign(m_rowIndex.size(), 0.0);
+}
+
+void SparseMatrix::setProduct(const SparseMatrix& A, const SparseMatrix& B)
+{
+    double* work = m_work.data();
+    for (size_t j = 0; j < m_ncols; j++) {
+        for (size_t n = B.m_colStart[j]; n < B.m_colStart[j+1]; n++) {
+            size_t k = B.m_rowIndex[n];
+            double b = B.m_values[n];
+            for (size_t p = A.m_colStart[k]; p < A.m_colStart[k+1]; p++) {
+                work[A.m_rowIndex[p]] += A.m_values[p] * b;
+            }
+        }
+        for (size_t n = m_colStart[j]; n < m_colStart[j+1]; n++) {
+            size_t i = m_rowIndex[n];
+            m_values[n] = work[i];
+            work[i] = 0.0;
+        }
+    }
+}
+
+size_t SparseMatrix::index(size_t i, size_t j) const
+{
+    if (j >= m_ncols) {
+        return npos;
+    }
+    auto begin = m_rowIndex.begin() + m_colStart[j];
+    auto end = m_rowIndex.begin() + m_colStart[j+1];
+    auto loc = lower_bound(begin, end, i);
+    if (loc == end || *loc != i) {
+        return npos;
+    }
+    return loc - m_rowIndex.begin();
+}
+
+double& SparseMatrix::operator()(size_t i, size_t j)
+{
+    size_t n = index(i, j);
+    if (n == npos) {
+        throw CanteraError("SparseMatrix::operator()", "Entry ({}, {}) is not "
+            "part of the sparsity pattern.", i, j);
+    }
+    return m_values[n];
+}
+
+double SparseMatrix::value(size_t i, size_t j) const
+{
+    size_t n = index(i, j);
+    return (n == npos) ? 0.0 : m_values[n];
+}
+
+void SparseMatrix::zero()
+{
+    fill(m_values.begin(), m_values.end(), 0.0);
+}
+
+void SparseMatrix::assign(const SparseMatrix& other)
+{
+    if (m_nrows == other.m_nrows && m_ncols == other.m_ncols &&
+        m_colStart == other.m_colStart && m_rowIndex == other.m_rowIndex) {
+        copy(other.m_values.begin(), other.m_values.end(), m_values.begin());
+    } else {
+        *this = other;
+    }
+}
+
+void SparseMatrix::mult(const double* b, double* prod) const
+{
+    fill(prod, prod + m_nrows, 0.0);
+    for (size_t j = 0; j < m_ncols; j++) {
+        for (size_t n = m_colStart[j]; n < m_colStart[j+1]; n++) {
+            prod[m_rowIndex[n]] += m_values[n] * b[j];
+        }
+    }
+}
+
+void SparseMatrix::toDense(DenseMatrix& dense) const
+{
+    dense.resize(m_nrows, m_ncols, 0.0);
+    for (size_t j = 0; j < m_ncols; j++) {
+        for (size_t n = m_colStart[j]; n < m_colStart[j+1]; n++) {
+            dense(m_rowIndex[n], j) = m_values[n];
+        }
+    }
+}
+
+}
@@ -53,7 +53,7 @@ void Domain1D::eval(size_t jg, doublereal* xg, doublereal* rg,
     }
 
     // if evaluating a Jacobian, compute the steady-state residual
-    if (jg != npos) {
+    if (jg != npos || container().evaluatingJacobian()) {
         rdt = 0.0;
     }
 
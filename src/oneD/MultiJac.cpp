@@ -5,7 +5,7 @@
  */
 
 #include "cantera/oneD/MultiJac.h"
-#include <ctime>
+#include "cantera/base/clockWC.h"
 
 using namespace std;
 
@@ -13,16 +13,32 @@ namespace Cantera
 {
 
 MultiJac::MultiJac(OneDim& r)
-    : BandMatrix(r.size(),r.bandwidth(),r.bandwidth())
 {
     m_size = r.size();
     m_points = r.points();
     m_resid = &r;
     m_r1.resize(m_size);
+    m_dx.resize(m_size);
+    m_xsave.resize(m_size);
+    m_single.resize(m_points);
+    m_blockSolver = r.blockTridiagonalSolver();
+    m_blockFactored = false;
+    if (m_blockSolver) {
+        vector<size_t> blockSizes(m_points);
+        for (size_t j = 0; j < m_points; j++) {
+            blockSizes[j] = r.nVars(j);
+        }
+        m_blockLU.setBlockSizes(blockSizes);
+    } else {
+        BandMatrix::resize(m_size, r.bandwidth(), r.bandwidth());
+    }
     m_ssdiag.resize(m_size);
     m_mask.resize(m_size);
     m_elapsed = 0.0;
+    m_factorElapsed = 0.0;
+    m_solveElapsed = 0.0;
     m_nevals = 0;
+    m_nfactors = 0;
     m_age = 100000;
     doublereal ff = 1.0;
     while (1.0 + ff != 1.0) {
@@ -45,39 +61,209 @@ void MultiJac::incrementDiagonal(int j, doublereal d)
     value(j,j) = m_ssdiag[j];
 }
 
+doublereal& MultiJac::value(size_t i, size_t j)
+{
+    if (m_blockSolver) {
+        m_factored = false;
+        return m_blockLU.value(i, j);
+    }
+    return BandMatrix::value(i, j);
+}
+
+doublereal MultiJac::value(size_t i, size_t j) const
+{
+    if (m_blockSolver) {
+        return m_blockLU.value(i, j);
+    }
+    return BandMatrix::value(i, j);
+}
+
+void MultiJac::setBlockTridiagonal(bool blocks)
+{
+    if (blocks == m_blockSolver) {
+        return;
+    }
+    if (blocks) {
+        vector<size_t> blockSizes(m_points);
+        for (size_t j = 0; j < m_points; j++) {
+            blockSizes[j] = m_resid->nVars(j);
+        }
+        m_blockLU.setBlockSizes(blockSizes);
+        copyJacobian(false);
+        releaseBand();
+    } else {
+        copyJacobian(true);
+        m_blockLU.setBlockSizes(vector<size_t>());
+    }
+    m_blockSolver = blocks;
+    m_blockFactored = false;
+    m_factored = false;
+}
+
+void MultiJac::copyJacobian(bool toBand)
+{
+    if (toBand) {
+        // This also sets all elements to zero
+        BandMatrix::resize(m_size, m_resid->bandwidth(),
+                           m_resid->bandwidth());
+    }
+    for (size_t j = 0; j < m_points; j++) {
+        size_t nj = m_resid->nVars(j);
+        size_t i0 = m_resid->loc(j);
+        for (size_t k = (j == 0) ? 0 : j - 1; k < std::min(j + 2, m_points);
+             k++) {
+            double* B = m_blockLU.block(j, k);
+            size_t k0 = m_resid->loc(k);
+            for (size_t q = 0; q < m_resid->nVars(k); q++) {
+                for (size_t p = 0; p < nj; p++) {
+                    if (toBand) {
+                        BandMatrix::value(i0 + p, k0 + q) = B[p + nj*q];
+                    } else {
+                        B[p + nj*q] = BandMatrix::value(i0 + p, k0 + q);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void MultiJac::releaseBand()
+{
+    BandMatrix::resize(0, 0, 0);
+    vector_fp().swap(data);
+    vector_fp().swap(ludata);
+    vector_int().swap(m_ipiv);
+    std::vector<doublereal*>().swap(m_colPtrs);
+}
+
+int MultiJac::solve(const doublereal* const b, doublereal* const x)
+{
+    int info = 0;
+    if (!m_factored) {
+        clockWC t0;
+        m_blockFactored = false;
+        if (m_blockSolver) {
+            // Pivoting is only done within each block, so fall back to the
+            // banded LU factorization if a block is singular or
+            // ill-conditioned.
+            m_blockFactored = (m_blockLU.factor() == 0);
+            if (m_blockFactored && !data.empty()) {
+                releaseBand();
+            } else if (!m_blockFactored) {
+                copyJacobian(true);
+            }
+        }
+        if (m_blockFactored) {
+            m_factored = true;
+        } else {
+            info = factor();
+        }
+        m_nfactors++;
+        m_factorElapsed += t0.secondsWC();
+    }
+
+    clockWC t0;
+    if (m_blockFactored) {
+        if (b != x) {
+            copy(b, b + m_size, x);
+        }
+        m_blockLU.solve(x);
+    } else {
+        // If the factorization failed, this tries again and reports the error
+        info = BandMatrix::solve(b, x);
+    }
+    m_solveElapsed += t0.secondsWC();
+    return info;
+}
+
 void MultiJac::eval(doublereal* x0, doublereal* resid0, doublereal rdt)
 {
     m_nevals++;
-    clock_t t0 = clock();
-    bfill(0.0);
-    size_t n, m, ipt=0, j, nv, mv, iloc;
-    doublereal rdx, dx, xsave;
+    clockWC t0;
+    if (m_blockSolver) {
+        m_blockLU.zero();
+        m_factored = false;
+    } else {
+        bfill(0.0);
+    }
+    size_t n, ipt, j, nv;
+    doublereal xsave;
+
+    // Points at the ends of each domain are perturbed one at a time, since
+    // the residual at points which are not adjacent to them may depend on
+    // them, e.g. through the boundary temperatures used by the radiation
+    // model in StFlow. All points are perturbed one at a time if coloring is
+    // disabled.
+    bool coloring = m_resid->jacobianColoring();
+    std::fill(m_single.begin(), m_single.end(), !coloring);
+    for (size_t i = 0; i < m_resid->nDomains(); i++) {
+        Domain1D& d = m_resid->domain(i);
+        m_single[d.firstPoint()] = true;
+        m_single[d.lastPoint()] = true;
+    }
 
     for (j = 0; j < m_points; j++) {
+        if (!m_single[j]) {
+            continue;
+        }
         nv = m_resid->nVars(j);
+        ipt = m_resid->loc(j);
         for (n = 0; n < nv; n++) {
             // perturb x(n)
             xsave = x0[ipt];
-            dx = m_atol + fabs(xsave)*m_rtol;
-            x0[ipt] = xsave + dx;
-            dx = x0[ipt] - xsave;
-            rdx = 1.0/dx;
+            x0[ipt] = xsave + m_atol + fabs(xsave)*m_rtol;
+            m_dx[ipt] = x0[ipt] - xsave;
 
             // calculate perturbed residual
             m_resid->eval(j, x0, m_r1.data(), rdt, 0);
 
             // compute nth column of Jacobian
-            for (size_t i = j - 1; i != j+2; i++) {
-                if (i != npos && i < m_points) {
-                    mv = m_resid->nVars(i);
-                    iloc = m_resid->loc(i);
-                    for (m = 0; m < mv; m++) {
-                        value(m+iloc,ipt) = (m_r1[m+iloc] - resid0[m+iloc])*rdx;
+            setColumn(j, ipt, resid0);
+            x0[ipt] = xsave;
+            ipt++;
+        }
+    }
+
+    if (coloring) {
+        // The residual at point j depends only on the solution at points j-1,
+        // j, and j+1, so the same component can be perturbed at every third
+        // point, and the change in the residual at points j-1 through j+1 is
+        // due only to the perturbation at point j.
+        size_t nvmax = 0;
+        for (j = 0; j < m_points; j++) {
+            if (!m_single[j]) {
+                nvmax = std::max(nvmax, m_resid->nVars(j));
+            }
+        }
+        for (size_t color = 0; color < 3; color++) {
+            for (n = 0; n < nvmax; n++) {
+                bool perturbed = false;
+                for (j = color; j < m_points; j += 3) {
+                    if (!m_single[j] && n < m_resid->nVars(j)) {
+                        ipt = m_resid->loc(j) + n;
+                        m_xsave[ipt] = x0[ipt];
+                        x0[ipt] += m_atol + fabs(x0[ipt])*m_rtol;
+                        m_dx[ipt] = x0[ipt] - m_xsave[ipt];
+                        perturbed = true;
+                    }
+                }
+                if (!perturbed) {
+                    continue;
+                }
+
+                // calculate perturbed residual at all points. Multiple
+                // threads are used here by domains which support them, e.g.
+                // StFlow::setNumThreads.
+                m_resid->evalJacobianResidual(x0, m_r1.data());
+
+                for (j = color; j < m_points; j += 3) {
+                    if (!m_single[j] && n < m_resid->nVars(j)) {
+                        ipt = m_resid->loc(j) + n;
+                        setColumn(j, ipt, resid0);
+                        x0[ipt] = m_xsave[ipt];
                     }
                 }
             }
-            x0[ipt] = xsave;
-            ipt++;
         }
     }
 
@@ -85,8 +271,30 @@ void MultiJac::eval(doublereal* x0, doublereal* resid0, doublereal rdt)
         m_ssdiag[n] = value(n,n);
     }
 
-    m_elapsed += double(clock() - t0)/CLOCKS_PER_SEC;
+    m_elapsed += t0.secondsWC();
     m_age = 0;
 }
 
+void MultiJac::setColumn(size_t j, size_t ipt, const doublereal* resid0)
+{
+    doublereal rdx = 1.0/m_dx[ipt];
+    for (size_t i = j - 1; i != j+2; i++) {
+        if (i != npos && i < m_points) {
+            size_t mv = m_resid->nVars(i);
+            size_t iloc = m_resid->loc(i);
+            if (m_blockSolver) {
+                double* col = m_blockLU.block(i, j) +
+                              mv * (ipt - m_resid->loc(j));
+                for (size_t m = 0; m < mv; m++) {
+                    col[m] = (m_r1[m+iloc] - resid0[m+iloc])*rdx;
+                }
+            } else {
+                for (size_t m = 0; m < mv; m++) {
+                    value(m+iloc,ipt) = (m_r1[m+iloc] - resid0[m+iloc])*rdx;
+                }
+            }
+        }
+    }
+}
+
 } // namespace
@@ -7,7 +7,7 @@
 #include "cantera/oneD/MultiNewton.h"
 #include "cantera/base/utilities.h"
 
-#include <ctime>
+#include "cantera/base/clockWC.h"
 
 using namespace std;
 
@@ -137,6 +137,10 @@ const size_t NDAMP = 7;
 
 MultiNewton::MultiNewton(int sz)
     : m_maxAge(5)
+    , m_adaptiveJac(false)
+    , m_maxRate(0.5)
+    , m_nsteps(0)
+    , m_nRateJac(0)
 {
     m_n = sz;
     m_elapsed = 0.0;
@@ -148,6 +152,7 @@ void MultiNewton::resize(size_t sz)
     m_x.resize(m_n);
     m_stp.resize(m_n);
     m_stp1.resize(m_n);
+    m_resid.resize(m_n);
 }
 
 doublereal MultiNewton::norm2(const doublereal* x,
@@ -261,7 +266,7 @@ int MultiNewton::dampStep(const doublereal* x0, const doublereal* step0,
 
         // write log information
         if (loglevel > 0) {
-            doublereal ss = r.ssnorm(x1,step1);
+            doublereal ss = r.ssnorm(x1, m_resid.data());
             writelog("\n{:d}  {:9.5f}   {:9.5f}   {:9.5f}   {:9.5f}   {:9.5f} {:4d}  {:d}/{:d}",
                      m, damp, fbound, log10(ss+SmallNumber),
                      log10(s0+SmallNumber), log10(s1+SmallNumber),
@@ -295,7 +300,7 @@ int MultiNewton::dampStep(const doublereal* x0, const doublereal* step0,
 int MultiNewton::solve(doublereal* x0, doublereal* x1,
                        OneDim& r, MultiJac& jac, int loglevel)
 {
-    clock_t t0 = clock();
+    clockWC t0;
     int m = 0;
     bool forceNewJac = false;
     doublereal s1=1.e30;
@@ -307,13 +312,33 @@ int MultiNewton::solve(doublereal* x0, doublereal* x1,
     int j0 = jac.nEvals();
     int nJacReeval = 0;
 
+    // true if m_stp holds the undamped step at m_x for the current Jacobian
+    bool haveStep = false;
+
+    // ratio of the norms of successive undamped steps, or -1 if no step has
+    // been taken yet. The age of a Jacobian from a previous call is never
+    // extended, since it may have been invalidated (see
+    // Domain1D::needJacUpdate).
+    double rate = -1.0;
+
     while (true) {
         // Check whether the Jacobian should be re-evaluated.
         if (jac.age() > m_maxAge) {
+            if (m_adaptiveJac && rate >= 0.0 && rate < m_maxRate) {
+                // keep using the Jacobian while the iteration converges quickly
+            } else {
+                if (loglevel > 0) {
+                    writelog("\nMaximum Jacobian age reached ({})\n", m_maxAge);
+                }
+                forceNewJac = true;
+            }
+        } else if (m_adaptiveJac && jac.age() > 1 && rate > m_maxRate) {
             if (loglevel > 0) {
-                writelog("\nMaximum Jacobian age reached ({})\n", m_maxAge);
+                writelog("\nSlow convergence (rate = {:.3g}) with Jacobian "
+                         "of age {}\n", rate, jac.age());
             }
             forceNewJac = true;
+            m_nRateJac++;
         }
 
         if (forceNewJac) {
@@ -321,16 +346,25 @@ int MultiNewton::solve(doublereal* x0, doublereal* x1,
             jac.eval(&m_x[0], &m_stp[0], 0.0);
             jac.updateTransient(rdt, r.transientMask().data());
             forceNewJac = false;
+            haveStep = false;
         }
 
-        // compute the undamped Newton step
-        step(&m_x[0], &m_stp[0], r, jac, loglevel-1);
+        // compute the undamped Newton step, unless it was already computed
+        // by dampStep() with the same Jacobian
+        if (!haveStep) {
+            step(&m_x[0], &m_stp[0], r, jac, loglevel-1);
+        }
+        m_nsteps++;
 
         // increment the Jacobian age
         jac.incrementAge();
 
         // damp the Newton step
         m = dampStep(&m_x[0], &m_stp[0], x1, &m_stp1[0], s1, r, jac, loglevel-1, frst);
+        haveStep = false;
+        if (m >= 0) {
+            rate = s1 / std::max(norm2(&m_x[0], &m_stp[0], r), SmallNumber);
+        }
         if (loglevel == 1 && m >= 0) {
             if (frst) {
                 writelog("\n\n    {:>10s}    {:>10s}   {:>5s}",
@@ -347,6 +381,8 @@ int MultiNewton::solve(doublereal* x0, doublereal* x1,
         // again.
         if (m == 0) {
             copy(x1, x1 + m_n, m_x.begin());
+            m_stp.swap(m_stp1);
+            haveStep = true;
         } else if (m == 1) {
             // convergence
             jac.setAge(0); // for efficient sensitivity analysis
@@ -376,7 +412,7 @@ int MultiNewton::solve(doublereal* x0, doublereal* x1,
     if (m > 0 && jac.nEvals() == j0) {
         m = 100;
     }
-    m_elapsed += (clock() - t0)/(1.0*CLOCKS_PER_SEC);
+    m_elapsed += t0.secondsWC();
     return m;
 }
 
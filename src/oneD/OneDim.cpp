@@ -3,9 +3,10 @@
 #include "cantera/numerics/Func1.h"
 #include "cantera/base/ctml.h"
 #include "cantera/oneD/MultiNewton.h"
+#include "cantera/base/clockWC.h"
 
-#include <fstream>
 #include <ctime>
+#include <fstream>
 
 using namespace std;
 
@@ -14,22 +15,26 @@ namespace Cantera
 
 OneDim::OneDim()
     : m_tmin(1.0e-16), m_tmax(10.0), m_tfactor(0.5),
-      m_rdt(0.0), m_jac_ok(false),
+      m_rdt(0.0), m_jac_ok(false), m_jac_eval(false), m_jac_coloring(true),
+      m_block_solver(false),
       m_bw(0), m_size(0),
       m_init(false), m_pts(0), m_solve_time(0.0),
       m_ss_jac_age(10), m_ts_jac_age(20),
-      m_interrupt(0), m_nevals(0), m_evaltime(0.0)
+      m_interrupt(0), m_refinetime(0.0), m_nevals(0), m_evaltime(0.0),
+      m_nsteps(0), m_timesteptime(0.0)
 {
     m_newt.reset(new MultiNewton(1));
 }
 
 OneDim::OneDim(vector<Domain1D*> domains) :
     m_tmin(1.0e-16), m_tmax(10.0), m_tfactor(0.5),
-    m_rdt(0.0), m_jac_ok(false),
+    m_rdt(0.0), m_jac_ok(false), m_jac_eval(false), m_jac_coloring(true),
+    m_block_solver(false),
     m_bw(0), m_size(0),
     m_init(false), m_solve_time(0.0),
     m_ss_jac_age(10), m_ts_jac_age(20),
-    m_interrupt(0), m_nevals(0), m_evaltime(0.0)
+    m_interrupt(0), m_refinetime(0.0), m_nevals(0), m_evaltime(0.0),
+    m_nsteps(0), m_timesteptime(0.0)
 {
     // create a Newton iterator, and add each domain.
     m_newt.reset(new MultiNewton(1));
@@ -100,6 +105,21 @@ void OneDim::writeStats(int printTime)
                      m_gridpts[i], m_funcEvals[i], m_jacEvals[i]);
         }
     }
+
+    writelog("\n Grid   Newton   Factor      Solve       Timesteps   Time"
+             "        Refine\n");
+    for (size_t i = 0; i < n; i++) {
+        if (printTime) {
+            writelog("{:5d}   {:5d}  {:9.4f}   {:9.4f}      {:5d}   {:9.4f}"
+                     "   {:9.4f}\n", m_gridpts[i], m_newtonSteps[i],
+                     m_factorElapsed[i], m_solveElapsed[i], m_timeSteps[i],
+                     m_timeStepElapsed[i], m_refineElapsed[i]);
+        } else {
+            writelog("{:5d}   {:5d}      NA          NA         {:5d}       NA"
+                     "          NA\n", m_gridpts[i], m_newtonSteps[i],
+                     m_timeSteps[i]);
+        }
+    }
 }
 
 void OneDim::saveStats()
@@ -110,10 +130,20 @@ void OneDim::saveStats()
             m_gridpts.push_back(m_pts);
             m_jacEvals.push_back(m_jac->nEvals());
             m_jacElapsed.push_back(m_jac->elapsedTime());
+            m_factorElapsed.push_back(m_jac->factorTime());
+            m_solveElapsed.push_back(m_jac->solveTime());
             m_funcEvals.push_back(m_nevals);
             m_nevals = 0;
             m_funcElapsed.push_back(m_evaltime);
             m_evaltime = 0.0;
+            m_newtonSteps.push_back(m_newt->nSteps());
+            m_newt->clearStats();
+            m_timeSteps.push_back(m_nsteps);
+            m_nsteps = 0;
+            m_timeStepElapsed.push_back(m_timesteptime);
+            m_timesteptime = 0.0;
+            m_refineElapsed.push_back(m_refinetime);
+            m_refinetime = 0.0;
         }
     }
 }
@@ -123,10 +153,20 @@ void OneDim::clearStats()
     m_gridpts.clear();
     m_jacEvals.clear();
     m_jacElapsed.clear();
+    m_factorElapsed.clear();
+    m_solveElapsed.clear();
     m_funcEvals.clear();
     m_funcElapsed.clear();
+    m_newtonSteps.clear();
+    m_timeSteps.clear();
+    m_timeStepElapsed.clear();
+    m_refineElapsed.clear();
     m_nevals = 0;
     m_evaltime = 0.0;
+    m_newt->clearStats();
+    m_nsteps = 0;
+    m_timesteptime = 0.0;
+    m_refinetime = 0.0;
 }
 
 void OneDim::resize()
@@ -220,12 +260,17 @@ Domain1D* OneDim::pointDomain(size_t i)
 
 void OneDim::eval(size_t j, double* x, double* r, doublereal rdt, int count)
 {
-    clock_t t0 = clock();
+    clockWC t0;
     if (m_interrupt) {
         m_interrupt->eval(m_nevals);
     }
     fill(r, r + m_size, 0.0);
-    fill(m_mask.begin(), m_mask.end(), 0);
+    // The transient mask is only set for the points being evaluated, so keep
+    // the values from the last evaluation at all points when evaluating a
+    // column of the Jacobian
+    if (j == npos) {
+        fill(m_mask.begin(), m_mask.end(), 0);
+    }
     if (rdt < 0.0) {
         rdt = m_rdt;
     }
@@ -242,12 +287,36 @@ void OneDim::eval(size_t j, double* x, double* r, doublereal rdt, int count)
 
     // increment counter and time
     if (count) {
-        clock_t t1 = clock();
-        m_evaltime += double(t1 - t0)/CLOCKS_PER_SEC;
+        m_evaltime += t0.secondsWC();
         m_nevals++;
     }
 }
 
+void OneDim::evalJacobianResidual(double* x, double* r)
+{
+    m_jac_eval = true;
+    try {
+        eval(npos, x, r, 0.0, 0);
+    } catch (...) {
+        m_jac_eval = false;
+        throw;
+    }
+    m_jac_eval = false;
+}
+
+void OneDim::setAdaptiveJacobian(bool adaptive, double maxRate)
+{
+    m_newt->setAdaptiveJacobian(adaptive, maxRate);
+}
+
+void OneDim::setBlockTridiagonalSolver(bool blocks)
+{
+    m_block_solver = blocks;
+    if (m_jac) {
+        m_jac->setBlockTridiagonal(blocks);
+    }
+}
+
 doublereal OneDim::ssnorm(doublereal* x, doublereal* r)
 {
     eval(npos, x, r, 0.0, 0);
@@ -305,6 +374,8 @@ void OneDim::init()
 doublereal OneDim::timeStep(int nsteps, doublereal dt, doublereal* x,
                             doublereal* r, int loglevel)
 {
+    clockWC t0;
+
     // set the Jacobian age parameter to the transient value
     newton().setOptions(m_ts_jac_age);
 
@@ -328,6 +399,7 @@ doublereal OneDim::timeStep(int nsteps, doublereal dt, doublereal* x,
         // the current solution in x.
         if (m >= 0) {
             n += 1;
+            m_nsteps++;
             debuglog("\n", loglevel);
             copy(r, r + m_size, x);
             if (m == 100) {
@@ -349,6 +421,7 @@ doublereal OneDim::timeStep(int nsteps, doublereal dt, doublereal* x,
     // Prepare to solve the steady problem.
     setSteadyMode();
     newton().setOptions(m_ss_jac_age);
+    m_timesteptime += t0.secondsWC();
 
     // return the value of the last stepsize, which may be smaller
     // than the initial stepsize
@@ -9,6 +9,7 @@
 #include "cantera/base/xml.h"
 
 #include <fstream>
+#include "cantera/base/clockWC.h"
 
 using namespace std;
 
@@ -290,7 +291,9 @@ void Sim1D::solve(int loglevel, bool refine_grid)
         }
 
         if (refine_grid) {
+            clockWC t0;
             new_points = refine(loglevel);
+            m_refinetime += t0.secondsWC();
             if (new_points) {
                 // If the grid has changed, preemptively reduce the timestep
                 // to avoid multiple successive failed time steps.
@@ -3,6 +3,7 @@
 // Copyright 2002  California Institute of Technology
 
 #include "cantera/oneD/StFlow.h"
+#include "cantera/oneD/OneDim.h"
 #include "cantera/base/ctml.h"
 #include "cantera/transport/TransportBase.h"
 #include "cantera/numerics/funcs.h"
@@ -29,6 +30,8 @@ StFlow::StFlow(IdealGasPhase* ph, size_t nsp, size_t points) :
     m_type = cFlowType;
     m_points = points;
     m_thermo = ph;
+    m_work.resize(1);
+    m_work[0].thermo = ph;
 
     if (ph == 0) {
         return; // used to create a dummy object
@@ -58,7 +61,7 @@ StFlow::StFlow(IdealGasPhase* ph, size_t nsp, size_t points) :
     m_multidiff.resize(m_nsp*m_nsp*m_points);
     m_flux.resize(m_nsp,m_points);
     m_wdot.resize(m_nsp,m_points, 0.0);
-    m_ybar.resize(m_nsp);
+    m_work[0].ybar.resize(m_nsp);
     m_qdotRadiation.resize(m_points, 0.0);
 
     //-------------- default solution bounds --------------------
@@ -97,6 +100,10 @@ StFlow::StFlow(IdealGasPhase* ph, size_t nsp, size_t points) :
     m_kRadiating[1] = (kr != npos) ? kr : m_thermo->speciesIndex("h2o");
 }
 
+StFlow::~StFlow()
+{
+}
+
 void StFlow::resize(size_t ncomponents, size_t points)
 {
     Domain1D::resize(ncomponents, points);
@@ -142,6 +149,8 @@ void StFlow::setupGrid(size_t n, const doublereal* z)
 void StFlow::setTransport(Transport& trans, bool withSoret)
 {
     m_trans = &trans;
+    m_work.resize(1);
+    m_work[0].trans = &trans;
     m_do_soret = withSoret;
 
     int model = m_trans->model();
@@ -174,24 +183,117 @@ void StFlow::enableSoret(bool withSoret)
     }
 }
 
+void StFlow::setNumThreads(size_t n)
+{
+    m_work.resize(1);
+    if (n == 0) {
+        n = ThreadPool::hardwareThreads();
+    }
+    if (n > 1) {
+        m_pool.reset(new ThreadPool(n));
+    } else {
+        m_pool.reset();
+    }
+}
+
+void StFlow::updateWorkspaces()
+{
+    size_t nw = numThreads();
+    m_work.resize(nw);
+    for (size_t i = 1; i < nw; i++) {
+        Workspace& ws = m_work[i];
+        if (!ws.thermo) {
+            unique_ptr<ThermoPhase> th(m_thermo->duplMyselfAsThermoPhase());
+            ws.thermoCopy.reset(dynamic_cast<IdealGasPhase*>(th.get()));
+            if (!ws.thermoCopy) {
+                throw CanteraError("StFlow::updateWorkspaces",
+                    "Copy of phase '{}' is not an IdealGasPhase", m_thermo->id());
+            }
+            th.release();
+            ws.thermo = ws.thermoCopy.get();
+            if (m_kin) {
+                ws.kinCopy.reset(m_kin->duplMyselfAsKinetics({ws.thermo}));
+                ws.kin = ws.kinCopy.get();
+            }
+            if (m_trans) {
+                ws.transCopy.reset(m_trans->duplMyselfAsTransport());
+                if (ws.transCopy->model() != m_trans->model()) {
+                    throw CanteraError("StFlow::updateWorkspaces",
+                        "Transport model {} cannot be copied for use by "
+                        "multiple threads", m_trans->model());
+                }
+                ws.transCopy->setThermo(*ws.thermo);
+                ws.trans = ws.transCopy.get();
+            }
+            ws.ybar.resize(m_nsp);
+        }
+        // Reaction rate multipliers may be modified between evaluations, e.g.
+        // for sensitivity analysis
+        if (m_kin) {
+            for (size_t n = 0; n < m_kin->nReactions(); n++) {
+                if (ws.kin->multiplier(n) != m_kin->multiplier(n)) {
+                    ws.kin->setMultiplier(n, m_kin->multiplier(n));
+                }
+            }
+        }
+    }
+}
+
+void StFlow::forEachPoint(size_t j0, size_t j1,
+                          const std::function<void(size_t, Workspace&)>& f)
+{
+    // Ranges with only a few points, e.g. when evaluating a column of the
+    // Jacobian, are evaluated on the calling thread, where the overhead of
+    // distributing the work would exceed its cost.
+    if (m_pool && j1 > j0 + 8) {
+        m_pool->run(j1 - j0, [&](size_t i, size_t w) {
+            f(j0 + i, m_work[w]);
+        });
+    } else {
+        for (size_t j = j0; j < j1; j++) {
+            f(j, m_work[0]);
+        }
+    }
+}
+
 void StFlow::setGas(const doublereal* x, size_t j)
 {
-    m_thermo->setTemperature(T(x,j));
+    setGas(x, j, m_work[0]);
+}
+
+void StFlow::setGas(const doublereal* x, size_t j, Workspace& ws)
+{
+    ws.thermo->setTemperature(T(x,j));
     const doublereal* yy = x + m_nv*j + c_offset_Y;
-    m_thermo->setMassFractions_NoNorm(yy);
-    m_thermo->setPressure(m_press);
+    ws.thermo->setMassFractions_NoNorm(yy);
+    ws.thermo->setPressure(m_press);
 }
 
 void StFlow::setGasAtMidpoint(const doublereal* x, size_t j)
 {
-    m_thermo->setTemperature(0.5*(T(x,j)+T(x,j+1)));
+    setGasAtMidpoint(x, j, m_work[0]);
+}
+
+void StFlow::setGasAtMidpoint(const doublereal* x, size_t j, Workspace& ws)
+{
+    ws.thermo->setTemperature(0.5*(T(x,j)+T(x,j+1)));
     const doublereal* yyj = x + m_nv*j + c_offset_Y;
     const doublereal* yyjp = x + m_nv*(j+1) + c_offset_Y;
     for (size_t k = 0; k < m_nsp; k++) {
-        m_ybar[k] = 0.5*(yyj[k] + yyjp[k]);
+        ws.ybar[k] = 0.5*(yyj[k] + yyjp[k]);
     }
-    m_thermo->setMassFractions_NoNorm(m_ybar.data());
-    m_thermo->setPressure(m_press);
+    ws.thermo->setMassFractions_NoNorm(ws.ybar.data());
+    ws.thermo->setPressure(m_press);
+}
+
+void StFlow::updateThermo(const doublereal* x, size_t j0, size_t j1)
+{
+    forEachPoint(j0, j1 + 1, [&](size_t j, Workspace& ws) {
+        setGas(x, j, ws);
+        m_rho[j] = ws.thermo->density();
+        m_wtm[j] = ws.thermo->meanMolecularWeight();
+        m_cp[j] = ws.thermo->cp_mass();
+    });
 }
 
 void StFlow::_finalize(const doublereal* x)
@@ -224,10 +326,15 @@ void StFlow::eval(size_t jg, doublereal* xg,
     }
 
     // if evaluating a Jacobian, compute the steady-state residual
-    if (jg != npos) {
+    bool jacobian = (jg != npos || container().evaluatingJacobian());
+    if (jacobian) {
         rdt = 0.0;
     }
 
+    if (m_pool && jg == npos) {
+        updateWorkspaces();
+    }
+
     // start of local part of global arrays
     doublereal* x = xg + loc();
     doublereal* rsd = rg + loc();
@@ -247,13 +354,11 @@ void StFlow::eval(size_t jg, doublereal* xg,
     size_t j0 = std::max<size_t>(jmin, 1) - 1;
     size_t j1 = std::min(jmax+1,m_points-1);
 
-    size_t j, k;
-
     // ------------ update properties ------------
 
     updateThermo(x, j0, j1);
     // update transport properties only if a Jacobian is not being evaluated
-    if (jg == npos) {
+    if (!jacobian) {
         updateTransport(x, j0, j1);
     }
 
@@ -265,7 +370,6 @@ void StFlow::eval(size_t jg, doublereal* xg,
     // evaluate the residual equations at all required
     // grid points
     //----------------------------------------------------
-    doublereal sum, sum2, dtdzj;
 
     // calculation of qdotRadiation
 
@@ -332,145 +436,154 @@ void StFlow::eval(size_t jg, doublereal* xg,
         }
     }
 
-    for (j = jmin; j <= jmax; j++) {
-        //----------------------------------------------
-        //         left boundary
-        //----------------------------------------------
+    forEachPoint(jmin, jmax + 1, [&](size_t j, Workspace& ws) {
+        evalPoint(j, x, rsd, diag, rdt, ws);
+    });
+}
+
+void StFlow::evalPoint(size_t j, doublereal* x, doublereal* rsd,
+                       integer* diag, doublereal rdt, Workspace& ws)
+{
+    size_t k;
+    doublereal sum, sum2, dtdzj;
 
-        if (j == 0) {
-            // these may be modified by a boundary object
+    //----------------------------------------------
+    //         left boundary
+    //----------------------------------------------
 
-            // Continuity. This propagates information right-to-left, since
-            // rho_u at point 0 is dependent on rho_u at point 1, but not on
-            // mdot from the inlet.
-            rsd[index(c_offset_U,0)] =
-                -(rho_u(x,1) - rho_u(x,0))/m_dz[0]
-                -(density(1)*V(x,1) + density(0)*V(x,0));
+    if (j == 0) {
+        // these may be modified by a boundary object
+
+        // Continuity. This propagates information right-to-left, since
+        // rho_u at point 0 is dependent on rho_u at point 1, but not on
+        // mdot from the inlet.
+        rsd[index(c_offset_U,0)] =
+            -(rho_u(x,1) - rho_u(x,0))/m_dz[0]
+            -(density(1)*V(x,1) + density(0)*V(x,0));
+
+        // the inlet (or other) object connected to this one will modify
+        // these equations by subtracting its values for V, T, and mdot. As
+        // a result, these residual equations will force the solution
+        // variables to the values for the boundary object
+        rsd[index(c_offset_V,0)] = V(x,0);
+        rsd[index(c_offset_T,0)] = T(x,0);
+        rsd[index(c_offset_L,0)] = -rho_u(x,0);
+
+        // The default boundary condition for species is zero flux. However,
+        // the boundary object may modify this.
+        sum = 0.0;
+        for (k = 0; k < m_nsp; k++) {
+            sum += Y(x,k,0);
+            rsd[index(c_offset_Y + k, 0)] =
+                -(m_flux(k,0) + rho_u(x,0)* Y(x,k,0));
+        }
+        rsd[index(c_offset_Y, 0)] = 1.0 - sum;
+    } else if (j == m_points - 1) {
+        evalRightBoundary(x, rsd, diag, rdt);
+    } else { // interior points
+        evalContinuity(j, x, rsd, diag, rdt);
+
+        //------------------------------------------------
+        //    Radial momentum equation
+        //
+        //    \rho dV/dt + \rho u dV/dz + \rho V^2
+        //       = d(\mu dV/dz)/dz - lambda
+        //-------------------------------------------------
+        rsd[index(c_offset_V,j)]
+        = (shear(x,j) - lambda(x,j) - rho_u(x,j)*dVdz(x,j)
+           - m_rho[j]*V(x,j)*V(x,j))/m_rho[j]
+          - rdt*(V(x,j) - V_prev(j));
+        diag[index(c_offset_V, j)] = 1;
+
+        //-------------------------------------------------
+        //    Species equations
+        //
+        //   \rho dY_k/dt + \rho u dY_k/dz + dJ_k/dz
+        //   = M_k\omega_k
+        //-------------------------------------------------
+        getWdot(x, j, ws);
+        doublereal convec, diffus;
+        for (k = 0; k < m_nsp; k++) {
+            convec = rho_u(x,j)*dYdz(x,k,j);
+            diffus = 2.0*(m_flux(k,j) - m_flux(k,j-1))
+                     /(z(j+1) - z(j-1));
+            rsd[index(c_offset_Y + k, j)]
+            = (m_wt[k]*(wdot(k,j))
+               - convec - diffus)/m_rho[j]
+              - rdt*(Y(x,k,j) - Y_prev(k,j));
+            diag[index(c_offset_Y + k, j)] = 1;
+        }
 
-            // the inlet (or other) object connected to this one will modify
-            // these equations by subtracting its values for V, T, and mdot. As
-            // a result, these residual equations will force the solution
-            // variables to the values for the boundary object
-            rsd[index(c_offset_V,0)] = V(x,0);
-            rsd[index(c_offset_T,0)] = T(x,0);
-            rsd[index(c_offset_L,0)] = -rho_u(x,0);
+        //-----------------------------------------------
+        //    energy equation
+        //
+        //    \rho c_p dT/dt + \rho c_p u dT/dz
+        //    = d(k dT/dz)/dz
+        //      - sum_k(\omega_k h_k_ref)
+        //      - sum_k(J_k c_p_k / M_k) dT/dz
+        //-----------------------------------------------
+        if (m_do_energy[j]) {
+            setGas(x, j, ws);
 
-            // The default boundary condition for species is zero flux. However,
-            // the boundary object may modify this.
+            // heat release term
+            const vector_fp& h_RT = ws.thermo->enthalpy_RT_ref();
+            const vector_fp& cp_R = ws.thermo->cp_R_ref();
             sum = 0.0;
+            sum2 = 0.0;
+            doublereal flxk;
             for (k = 0; k < m_nsp; k++) {
-                sum += Y(x,k,0);
-                rsd[index(c_offset_Y + k, 0)] =
-                    -(m_flux(k,0) + rho_u(x,0)* Y(x,k,0));
-            }
-            rsd[index(c_offset_Y, 0)] = 1.0 - sum;
-        } else if (j == m_points - 1) {
-            evalRightBoundary(x, rsd, diag, rdt);
-        } else { // interior points
-            evalContinuity(j, x, rsd, diag, rdt);
-
-            //------------------------------------------------
-            //    Radial momentum equation
-            //
-            //    \rho dV/dt + \rho u dV/dz + \rho V^2
-            //       = d(\mu dV/dz)/dz - lambda
-            //-------------------------------------------------
-            rsd[index(c_offset_V,j)]
-            = (shear(x,j) - lambda(x,j) - rho_u(x,j)*dVdz(x,j)
-               - m_rho[j]*V(x,j)*V(x,j))/m_rho[j]
-              - rdt*(V(x,j) - V_prev(j));
-            diag[index(c_offset_V, j)] = 1;
-
-            //-------------------------------------------------
-            //    Species equations
-            //
-            //   \rho dY_k/dt + \rho u dY_k/dz + dJ_k/dz
-            //   = M_k\omega_k
-            //-------------------------------------------------
-            getWdot(x,j);
-            doublereal convec, diffus;
-            for (k = 0; k < m_nsp; k++) {
-                convec = rho_u(x,j)*dYdz(x,k,j);
-                diffus = 2.0*(m_flux(k,j) - m_flux(k,j-1))
-                         /(z(j+1) - z(j-1));
-                rsd[index(c_offset_Y + k, j)]
-                = (m_wt[k]*(wdot(k,j))
-                   - convec - diffus)/m_rho[j]
-                  - rdt*(Y(x,k,j) - Y_prev(k,j));
-                diag[index(c_offset_Y + k, j)] = 1;
-            }
-
-            //-----------------------------------------------
-            //    energy equation
-            //
-            //    \rho c_p dT/dt + \rho c_p u dT/dz
-            //    = d(k dT/dz)/dz
-            //      - sum_k(\omega_k h_k_ref)
-            //      - sum_k(J_k c_p_k / M_k) dT/dz
-            //-----------------------------------------------
-            if (m_do_energy[j]) {
-                setGas(x,j);
-
-                // heat release term
-                const vector_fp& h_RT = m_thermo->enthalpy_RT_ref();
-                const vector_fp& cp_R = m_thermo->cp_R_ref();
-                sum = 0.0;
-                sum2 = 0.0;
-                doublereal flxk;
-                for (k = 0; k < m_nsp; k++) {
-                    flxk = 0.5*(m_flux(k,j-1) + m_flux(k,j));
-                    sum += wdot(k,j)*h_RT[k];
-                    sum2 += flxk*cp_R[k]/m_wt[k];
-                }
-                sum *= GasConstant * T(x,j);
-                dtdzj = dTdz(x,j);
-                sum2 *= GasConstant * dtdzj;
-
-                rsd[index(c_offset_T, j)] = - m_cp[j]*rho_u(x,j)*dtdzj
-                                            - divHeatFlux(x,j) - sum - sum2;
-                rsd[index(c_offset_T, j)] /= (m_rho[j]*m_cp[j]);
-                rsd[index(c_offset_T, j)] -= rdt*(T(x,j) - T_prev(j));
-                rsd[index(c_offset_T, j)] -= (m_qdotRadiation[j] / (m_rho[j] * m_cp[j]));
-                diag[index(c_offset_T, j)] = 1;
-            } else {
-                // residual equations if the energy equation is disabled
-                rsd[index(c_offset_T, j)] = T(x,j) - T_fixed(j);
-                diag[index(c_offset_T, j)] = 0;
-            }
-
-            rsd[index(c_offset_L, j)] = lambda(x,j) - lambda(x,j-1);
-            diag[index(c_offset_L, j)] = 0;
+                flxk = 0.5*(m_flux(k,j-1) + m_flux(k,j));
+                sum += wdot(k,j)*h_RT[k];
+                sum2 += flxk*cp_R[k]/m_wt[k];
+            }
+            sum *= GasConstant * T(x,j);
+            dtdzj = dTdz(x,j);
+            sum2 *= GasConstant * dtdzj;
+
+            rsd[index(c_offset_T, j)] = - m_cp[j]*rho_u(x,j)*dtdzj
+                                        - divHeatFlux(x,j) - sum - sum2;
+            rsd[index(c_offset_T, j)] /= (m_rho[j]*m_cp[j]);
+            rsd[index(c_offset_T, j)] -= rdt*(T(x,j) - T_prev(j));
+            rsd[index(c_offset_T, j)] -= (m_qdotRadiation[j] / (m_rho[j] * m_cp[j]));
+            diag[index(c_offset_T, j)] = 1;
+        } else {
+            // residual equations if the energy equation is disabled
+            rsd[index(c_offset_T, j)] = T(x,j) - T_fixed(j);
+            diag[index(c_offset_T, j)] = 0;
         }
+
+        rsd[index(c_offset_L, j)] = lambda(x,j) - lambda(x,j-1);
+        diag[index(c_offset_L, j)] = 0;
     }
 }
 
 void StFlow::updateTransport(doublereal* x, size_t j0, size_t j1)
 {
     if (m_transport_option == c_Mixav_Transport) {
-        for (size_t j = j0; j < j1; j++) {
-            setGasAtMidpoint(x,j);
-            m_visc[j] = (m_dovisc ? m_trans->viscosity() : 0.0);
-            m_trans->getMixDiffCoeffs(&m_diff[j*m_nsp]);
-            m_tcon[j] = m_trans->thermalConductivity();
-        }
+        forEachPoint(j0, j1, [&](size_t j, Workspace& ws) {
+            setGasAtMidpoint(x, j, ws);
+            m_visc[j] = (m_dovisc ? ws.trans->viscosity() : 0.0);
+            ws.trans->getMixDiffCoeffs(&m_diff[j*m_nsp]);
+            m_tcon[j] = ws.trans->thermalConductivity();
+        });
     } else if (m_transport_option == c_Multi_Transport) {
-        for (size_t j = j0; j < j1; j++) {
-            setGasAtMidpoint(x,j);
-            doublereal wtm = m_thermo->meanMolecularWeight();
-            doublereal rho = m_thermo->density();
-            m_visc[j] = (m_dovisc ? m_trans->viscosity() : 0.0);
-            m_trans->getMultiDiffCoeffs(m_nsp, &m_multidiff[mindex(0,0,j)]);
+        forEachPoint(j0, j1, [&](size_t j, Workspace& ws) {
+            setGasAtMidpoint(x, j, ws);
+            doublereal wtm = ws.thermo->meanMolecularWeight();
+            doublereal rho = ws.thermo->density();
+            m_visc[j] = (m_dovisc ? ws.trans->viscosity() : 0.0);
+            ws.trans->getMultiDiffCoeffs(m_nsp, &m_multidiff[mindex(0,0,j)]);
 
             // Use m_diff as storage for the factor outside the summation
             for (size_t k = 0; k < m_nsp; k++) {
                 m_diff[k+j*m_nsp] = m_wt[k] * rho / (wtm*wtm);
             }
 
-            m_tcon[j] = m_trans->thermalConductivity();
+            m_tcon[j] = ws.trans->thermalConductivity();
             if (m_do_soret) {
-                m_trans->getThermalDiffCoeffs(m_dthermal.ptrColumn(0) + j*m_nsp);
+                ws.trans->getThermalDiffCoeffs(m_dthermal.ptrColumn(0) + j*m_nsp);
             }
-        }
+        });
     }
 }
 
@@ -15,6 +15,8 @@
 namespace Cantera
 {
 GeneralSpeciesThermo::GeneralSpeciesThermo() :
+    m_nasa(15),
+    m_nasa_consecutive(true),
     m_tlow_max(0.0),
     m_thigh_min(1.0E30),
     m_p0(OneAtm)
@@ -25,6 +27,9 @@ GeneralSpeciesThermo::GeneralSpeciesThermo(const GeneralSpeciesThermo& b) :
     SpeciesThermo(b),
     m_tpoly(b.m_tpoly),
     m_speciesLoc(b.m_speciesLoc),
+    m_nasa(b.m_nasa),
+    m_nasa_consecutive(b.m_nasa_consecutive),
+    m_nasa_work(b.m_nasa_work),
     m_tlow_max(b.m_tlow_max),
     m_thigh_min(b.m_thigh_min),
     m_p0(b.m_p0)
@@ -62,6 +67,9 @@ GeneralSpeciesThermo::operator=(const GeneralSpeciesThermo& b)
 
     m_tpoly = b.m_tpoly;
     m_speciesLoc = b.m_speciesLoc;
+    m_nasa = b.m_nasa;
+    m_nasa_consecutive = b.m_nasa_consecutive;
+    m_nasa_work = b.m_nasa_work;
     m_tlow_max = b.m_tlow_max;
     m_thigh_min = b.m_thigh_min;
     m_p0 = b.m_p0;
@@ -89,6 +97,18 @@ void GeneralSpeciesThermo::install_STIT(size_t index,
     if (m_sp[type].size() == 1) {
         m_tpoly[type].resize(stit_ptr->temperaturePolySize());
     }
+    if (type == NASA2) {
+        const std::vector<index_STIT>& nasa = m_sp[NASA2];
+        size_t i = nasa.size() - 1;
+        if (index != nasa[0].first + i) {
+            m_nasa_consecutive = false;
+        }
+        for (size_t j = 0; j < m_nasa.size(); j++) {
+            m_nasa[j].push_back(0.0);
+        }
+        storeNasaCoeffs(i);
+        m_nasa_work.resize(3 * nasa.size());
+    }
 
     // Calculate max and min T
     m_tlow_max = std::max(stit_ptr->minTemp(), m_tlow_max);
@@ -121,6 +141,10 @@ void GeneralSpeciesThermo::update(doublereal t, doublereal* cp_R,
         const std::vector<index_STIT>& species = iter->second;
         double* tpoly = &jter->second[0];
         species[0].second->updateTemperaturePoly(t, tpoly);
+        if (iter->first == NASA2) {
+            updateNasa(tpoly, cp_R, h_RT, s_R);
+            continue;
+        }
         for (size_t k = 0; k < species.size(); k++) {
             size_t i = species[k].first;
             species[k].second->updateProperties(tpoly, cp_R+i, h_RT+i, s_R+i);
@@ -128,6 +152,67 @@ void GeneralSpeciesThermo::update(doublereal t, doublereal* cp_R,
     }
 }
 
+void GeneralSpeciesThermo::storeNasaCoeffs(size_t i)
+{
+    const SpeciesThermoInterpType* sp = m_sp[NASA2][i].second.get();
+    double c[15], tlow, thigh, pref;
+    size_t n;
+    int type;
+    sp->reportParameters(n, type, tlow, thigh, pref, c);
+    for (size_t j = 0; j < 15; j++) {
+        m_nasa[j][i] = c[j];
+    }
+}
+
+void GeneralSpeciesThermo::updateNasa(const double* tt, double* cp_R,
+                                      double* h_RT, double* s_R) const
+{
+    const std::vector<index_STIT>& species = m_sp.at(NASA2);
+    size_t n = species.size();
+    double* cp = cp_R + species[0].first;
+    double* h = h_RT + species[0].first;
+    double* s = s_R + species[0].first;
+    if (!m_nasa_consecutive) {
+        cp = &m_nasa_work[0];
+        h = cp + n;
+        s = h + n;
+    }
+
+    const double* tmid = m_nasa[0].data();
+    const double* hi[7];
+    const double* lo[7];
+    for (size_t j = 0; j < 7; j++) {
+        hi[j] = m_nasa[1+j].data();
+        lo[j] = m_nasa[8+j].data();
+    }
+    // Same operations as NasaPoly1::updateProperties, for the temperature
+    // range selected for each species
+    for (size_t i = 0; i < n; i++) {
+        bool low = (tt[0] <= tmid[i]);
+        double ct0 = low ? lo[0][i] : hi[0][i]; // a0
+        double ct1 = (low ? lo[1][i] : hi[1][i]) * tt[0]; // a1 * T
+        double ct2 = (low ? lo[2][i] : hi[2][i]) * tt[1]; // a2 * T^2
+        double ct3 = (low ? lo[3][i] : hi[3][i]) * tt[2]; // a3 * T^3
+        double ct4 = (low ? lo[4][i] : hi[4][i]) * tt[3]; // a4 * T^4
+        double a5 = low ? lo[5][i] : hi[5][i];
+        double a6 = low ? lo[6][i] : hi[6][i];
+        cp[i] = ct0 + ct1 + ct2 + ct3 + ct4;
+        h[i] = ct0 + 0.5*ct1 + 1.0/3.0*ct2 + 0.25*ct3 + 0.2*ct4
+               + a5*tt[4]; // last term is a5/T
+        s[i] = ct0*tt[5] + ct1 + 0.5*ct2 + 1.0/3.0*ct3
+               +0.25*ct4 + a6; // last term is a6
+    }
+
+    if (!m_nasa_consecutive) {
+        for (size_t i = 0; i < n; i++) {
+            size_t k = species[i].first;
+            cp_R[k] = cp[i];
+            h_RT[k] = h[i];
+            s_R[k] = s[i];
+        }
+    }
+}
+
 int GeneralSpeciesThermo::reportType(size_t index) const
 {
     const SpeciesThermoInterpType* sp = provideSTIT(index);
@@ -214,11 +299,23 @@ doublereal GeneralSpeciesThermo::reportOneHf298(const size_t k) const
     return h;
 }
 
+size_t GeneralSpeciesThermo::nasaIndex(size_t k) const
+{
+    auto loc = m_speciesLoc.find(k);
+    if (loc == m_speciesLoc.end() || loc->second.first != NASA2) {
+        return npos;
+    }
+    return loc->second.second;
+}
+
 void GeneralSpeciesThermo::modifyOneHf298(const size_t k, const doublereal Hf298New)
 {
     SpeciesThermoInterpType* sp_ptr = provideSTIT(k);
     if (sp_ptr) {
         sp_ptr->modifyOneHf298(k, Hf298New);
+        if (sp_ptr->reportType() == NASA2) {
+            storeNasaCoeffs(m_speciesLoc[k].second);
+        }
     }
 }
 
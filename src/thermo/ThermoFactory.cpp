@@ -41,6 +41,9 @@
 #include "cantera/thermo/MixedSolventElectrolyte.h"
 #include "cantera/thermo/IdealSolnGasVPSS.h"
 #include "cantera/base/stringUtils.h"
+#include "cantera/base/ThreadPool.h"
+
+#include <atomic>
 
 using namespace std;
 
@@ -50,6 +53,10 @@ namespace Cantera
 ThermoFactory* ThermoFactory::s_factory = 0;
 std::mutex ThermoFactory::thermo_mutex;
 
+//! Number of threads used to create species and reactions while importing
+//! phases and kinetics managers. See setImportThreads().
+static std::atomic<size_t> import_threads(1);
+
 //! Define the number of ThermoPhase types for use in this factory routine
 static int ntypes = 27;
 
@@ -435,13 +442,44 @@ void importPhase(XML_Node& phase, ThermoPhase* th)
         throw CanteraError("importPhase()", "For Slave standard states, "
             "number of species must be zero: {}", nsp);
     }
+
+    // With more than one thread, create all of the Species objects before
+    // adding any of them. Exceptions are rethrown when the corresponding
+    // species is reached below, so that the reported error is the same as
+    // when the species are created one at a time.
+    vector<shared_ptr<Species> > species;
+    vector<std::exception_ptr> errors;
+    size_t nThreads = importThreads();
+    if (nThreads != 1 && nsp > 1) {
+        species.resize(nsp);
+        errors.resize(nsp);
+        ThreadPool pool(std::min(nThreads ? nThreads
+                                          : ThreadPool::hardwareThreads(), nsp));
+        pool.run(nsp, [&](size_t k, size_t) {
+            if (spDataNodeList[k]) {
+                try {
+                    species[k] = newSpecies(*spDataNodeList[k]);
+                } catch (...) {
+                    errors[k] = std::current_exception();
+                }
+            }
+        });
+    }
+
     for (size_t k = 0; k < nsp; k++) {
         XML_Node* s = spDataNodeList[k];
         AssertTrace(s != 0);
         if (spRuleList[k]) {
            th->ignoreUndefinedElements();
         }
-        th->addSpecies(newSpecies(*s));
+        if (species.empty()) {
+            th->addSpecies(newSpecies(*s));
+        } else {
+            if (errors[k]) {
+                std::rethrow_exception(errors[k]);
+            }
+            th->addSpecies(species[k]);
+        }
         if (vpss_ptr) {
             vpss_ptr->createInstallPDSS(k, *s, &phase);
         }
@@ -462,6 +500,16 @@ void importPhase(XML_Node& phase, ThermoPhase* th)
     th->initThermoXML(phase, id);
 }
 
+void setImportThreads(size_t n)
+{
+    import_threads = n;
+}
+
+size_t importThreads()
+{
+    return import_threads;
+}
+
 void installElements(Phase& th, const XML_Node& phaseNode)
 {
     // get the declared element names
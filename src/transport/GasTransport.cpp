@@ -4,6 +4,14 @@
 #include "cantera/base/stringUtils.h"
 #include "cantera/numerics/polyfit.h"
 #include "cantera/transport/TransportData.h"
+#include "cantera/base/ThreadPool.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
 
 namespace Cantera
 {
@@ -12,13 +20,192 @@ namespace Cantera
 //! except in CK mode, where the degree is 6.
 #define COLL_INT_POLY_DEGREE 8
 
+namespace
+{
+
+// Settings for the computation of the polynomial fits. See
+// GasTransport::setFitCache() and GasTransport::setFitThreads().
+std::mutex fit_settings_mutex;
+std::string fit_cache_dir;
+size_t fit_threads = 1;
+
+// Fit cache file header: magic string, format version and byte order mark
+const char fitCacheMagic[8] = {'C', 'T', 'T', 'R', 'F', 'I', 'T', '\0'};
+const uint32_t fitCacheVersion = 1;
+const uint32_t fitCacheByteOrder = 0x01020304;
+
+//! Name of the fit cache file for the given key, using the 64-bit FNV-1a
+//! hash of the key
+std::string cacheFileName(const std::string& dir, const vector_fp& key)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    const unsigned char* data = reinterpret_cast<const unsigned char*>(key.data());
+    for (size_t i = 0; i < key.size() * sizeof(double); i++) {
+        hash = (hash ^ data[i]) * 1099511628211ULL;
+    }
+    return fmt::format("{}/{:016x}.ctfit", dir, hash);
+}
+
+void putData(std::string& buf, const void* data, size_t n)
+{
+    buf.append(static_cast<const char*>(data), n);
+}
+
+template <class T>
+void putVector(std::string& buf, const std::vector<T>& x)
+{
+    uint64_t n = x.size();
+    putData(buf, &n, sizeof(n));
+    putData(buf, x.data(), n * sizeof(T));
+}
+
+template <class T>
+void putVectors(std::string& buf, const std::vector<std::vector<T>>& x)
+{
+    uint64_t n = x.size();
+    putData(buf, &n, sizeof(n));
+    for (const auto& v : x) {
+        putVector(buf, v);
+    }
+}
+
+//! Reads the records of a fit cache file, returning false if a record
+//! extends beyond the end of the file
+class FitCacheReader
+{
+public:
+    explicit FitCacheReader(const std::string& buf) :
+        m_pos(buf.data()), m_end(buf.data() + buf.size()) {}
+
+    bool read(void* data, size_t n) {
+        if (n > static_cast<size_t>(m_end - m_pos)) {
+            return false;
+        }
+        memcpy(data, m_pos, n);
+        m_pos += n;
+        return true;
+    }
+    template <class T>
+    bool getVector(std::vector<T>& x) {
+        uint64_t n;
+        if (!read(&n, sizeof(n)) ||
+            n > static_cast<size_t>(m_end - m_pos) / sizeof(T)) {
+            return false;
+        }
+        x.resize(n);
+        return read(x.data(), n * sizeof(T));
+    }
+    template <class T>
+    bool getVectors(std::vector<std::vector<T>>& x) {
+        uint64_t n;
+        if (!read(&n, sizeof(n)) || n > static_cast<size_t>(m_end - m_pos)) {
+            return false;
+        }
+        x.resize(n);
+        for (auto& v : x) {
+            if (!getVector(v)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    bool atEnd() const {
+        return m_pos == m_end;
+    }
+
+protected:
+    const char* m_pos;
+    const char* m_end;
+};
+
+//! Read the fits from the cache file `filename`. Returns false if the file
+//! does not exist, is invalid, or was written for a different key.
+bool readFitCache(const std::string& filename, const vector_fp& key,
+                  GasTransportFits& fits)
+{
+    std::ifstream in(filename, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+    std::string buf((std::istreambuf_iterator<char>(in)),
+                    std::istreambuf_iterator<char>());
+    FitCacheReader r(buf);
+    char magic[8];
+    uint32_t version, bom;
+    int32_t mode;
+    vector_fp fileKey;
+    if (!r.read(magic, 8) || memcmp(magic, fitCacheMagic, 8) != 0 ||
+        !r.read(&version, sizeof(version)) || version != fitCacheVersion ||
+        !r.read(&bom, sizeof(bom)) || bom != fitCacheByteOrder ||
+        !r.getVector(fileKey) || fileKey != key ||
+        !r.read(&mode, sizeof(mode))) {
+        return false;
+    }
+    fits.mode = mode;
+    return r.getVectors(fits.visccoeffs) && r.getVectors(fits.condcoeffs) &&
+           r.getVectors(fits.diffcoeffs) && r.getVectors(fits.poly) &&
+           r.getVectors(fits.omega22) && r.getVectors(fits.astar) &&
+           r.getVectors(fits.bstar) && r.getVectors(fits.cstar) && r.atEnd();
+}
+
+//! Write the fits to the cache file `filename`. The file is written under a
+//! temporary name and then renamed, so that other processes never read a
+//! partially written file. Returns false if the file could not be written.
+bool writeFitCache(const std::string& filename, const vector_fp& key,
+                   const GasTransportFits& fits)
+{
+    std::string buf(fitCacheMagic, 8);
+    putData(buf, &fitCacheVersion, sizeof(fitCacheVersion));
+    putData(buf, &fitCacheByteOrder, sizeof(fitCacheByteOrder));
+    putVector(buf, key);
+    int32_t mode = fits.mode;
+    putData(buf, &mode, sizeof(mode));
+    putVectors(buf, fits.visccoeffs);
+    putVectors(buf, fits.condcoeffs);
+    putVectors(buf, fits.diffcoeffs);
+    putVectors(buf, fits.poly);
+    putVectors(buf, fits.omega22);
+    putVectors(buf, fits.astar);
+    putVectors(buf, fits.bstar);
+    putVectors(buf, fits.cstar);
+
+    std::string tmpname = fmt::format("{}.{:x}.{:x}", filename,
+        reinterpret_cast<uintptr_t>(&fits),
+        std::chrono::steady_clock::now().time_since_epoch().count());
+    {
+        std::ofstream out(tmpname, std::ios::binary);
+        out.write(buf.data(), buf.size());
+        if (!out) {
+            out.close();
+            std::remove(tmpname.c_str());
+            return false;
+        }
+    }
+    if (std::rename(tmpname.c_str(), filename.c_str()) != 0) {
+        // On some platforms, an existing file is not replaced. In that case,
+        // another process has already written the same fits.
+        std::remove(tmpname.c_str());
+    }
+    return true;
+}
+
+}
+
 GasTransport::GasTransport(ThermoPhase* thermo) :
     Transport(thermo),
+    m_tabulate(false),
+    m_tab_inrange(false),
+    m_tab_width(0),
+    m_tab_logtmin(0.0),
+    m_tab_dlogt(0.0),
+    m_tab_j0(0),
+    m_tab_w(),
     m_viscmix(0.0),
     m_visc_ok(false),
     m_viscwt_ok(false),
     m_spvisc_ok(false),
     m_bindiff_ok(false),
+    m_bdiff_rinv_ok(false),
     m_mode(0),
     m_polytempvec(5),
     m_temp(-1.0),
@@ -33,11 +220,20 @@ GasTransport::GasTransport(ThermoPhase* thermo) :
 }
 
 GasTransport::GasTransport(const GasTransport& right) :
+    Transport(right),
+    m_tabulate(false),
+    m_tab_inrange(false),
+    m_tab_width(0),
+    m_tab_logtmin(0.0),
+    m_tab_dlogt(0.0),
+    m_tab_j0(0),
+    m_tab_w(),
     m_viscmix(0.0),
     m_visc_ok(false),
     m_viscwt_ok(false),
     m_spvisc_ok(false),
     m_bindiff_ok(false),
+    m_bdiff_rinv_ok(false),
     m_mode(0),
     m_polytempvec(5),
     m_temp(-1.0),
@@ -49,20 +245,36 @@ GasTransport::GasTransport(const GasTransport& right) :
     m_t32(0.0),
     m_log_level(0)
 {
+    *this = right;
 }
 
 GasTransport& GasTransport::operator=(const GasTransport& right)
 {
+    if (&right == this) {
+        return *this;
+    }
+    Transport::operator=(right);
+    m_tabulate = right.m_tabulate;
+    m_tab_inrange = right.m_tab_inrange;
+    m_tab_width = right.m_tab_width;
+    m_table = right.m_table;
+    m_tab_logtmin = right.m_tab_logtmin;
+    m_tab_dlogt = right.m_tab_dlogt;
+    m_tab_j0 = right.m_tab_j0;
+    std::copy(right.m_tab_w, right.m_tab_w + 4, m_tab_w);
+    m_tab_work = right.m_tab_work;
     m_molefracs = right.m_molefracs;
     m_viscmix = right.m_viscmix;
     m_visc_ok = right.m_visc_ok;
     m_viscwt_ok = right.m_viscwt_ok;
     m_spvisc_ok = right.m_spvisc_ok;
     m_bindiff_ok = right.m_bindiff_ok;
+    m_bdiff_rinv_ok = right.m_bdiff_rinv_ok;
     m_mode = right.m_mode;
     m_phi = right.m_phi;
     m_spwork = right.m_spwork;
     m_visc = right.m_visc;
+    m_visccoeffs = right.m_visccoeffs;
     m_mw = right.m_mw;
     m_wratjk = right.m_wratjk;
     m_wratkj1 = right.m_wratkj1;
@@ -77,6 +289,9 @@ GasTransport& GasTransport::operator=(const GasTransport& right)
     m_t32 = right.m_t32;
     m_diffcoeffs = right.m_diffcoeffs;
     m_bdiff = right.m_bdiff;
+    m_bdiff_rinv = right.m_bdiff_rinv;
+    m_diffsum1 = right.m_diffsum1;
+    m_diffsum2 = right.m_diffsum2;
     m_condcoeffs = right.m_condcoeffs;
     m_poly = right.m_poly;
     m_omega22_poly = right.m_omega22_poly;
@@ -84,6 +299,7 @@ GasTransport& GasTransport::operator=(const GasTransport& right)
     m_bstar_poly = right.m_bstar_poly;
     m_cstar_poly = right.m_cstar_poly;
     m_zrot = right.m_zrot;
+    m_crot = right.m_crot;
     m_polar = right.m_polar;
     m_alpha = right.m_alpha;
     m_eps = right.m_eps;
@@ -95,6 +311,7 @@ GasTransport& GasTransport::operator=(const GasTransport& right)
     m_delta = right.m_delta;
     m_w_ac = right.m_w_ac;
     m_log_level = right.m_log_level;
+    m_fitCacheFile = right.m_fitCacheFile;
 
     return *this;
 }
@@ -121,11 +338,16 @@ void GasTransport::update_T()
     m_polytempvec[3] = m_logt*m_logt*m_logt;
     m_polytempvec[4] = m_logt*m_logt*m_logt*m_logt;
 
+    if (m_tabulate) {
+        m_tab_inrange = interpolationWeights(m_logt, m_tab_j0, m_tab_w);
+    }
+
     // temperature has changed, so polynomial fits will need to be redone
     m_visc_ok = false;
     m_spvisc_ok = false;
     m_viscwt_ok = false;
     m_bindiff_ok = false;
+    m_bdiff_rinv_ok = false;
 }
 
 doublereal GasTransport::viscosity()
@@ -177,7 +399,20 @@ void GasTransport::updateViscosity_T()
 void GasTransport::updateSpeciesViscosities()
 {
     update_T();
-    if (m_mode == CK_Mode) {
+    if (m_tabulate && m_tab_inrange) {
+        if (m_mode == CK_Mode) {
+            interpolate(0, m_nsp, m_visc.data());
+            for (size_t k = 0; k < m_nsp; k++) {
+                m_sqvisc[k] = sqrt(m_visc[k]);
+            }
+        } else {
+            interpolate(0, m_nsp, m_sqvisc.data());
+            for (size_t k = 0; k < m_nsp; k++) {
+                m_sqvisc[k] *= m_t14;
+                m_visc[k] = m_sqvisc[k] * m_sqvisc[k];
+            }
+        }
+    } else if (m_mode == CK_Mode) {
         for (size_t k = 0; k < m_nsp; k++) {
             m_visc[k] = exp(dot4(m_polytempvec, m_visccoeffs[k]));
             m_sqvisc[k] = sqrt(m_visc[k]);
@@ -196,26 +431,302 @@ void GasTransport::updateDiff_T()
 {
     update_T();
     // evaluate binary diffusion coefficients at unit pressure
-    size_t ic = 0;
-    if (m_mode == CK_Mode) {
-        for (size_t i = 0; i < m_nsp; i++) {
-            for (size_t j = i; j < m_nsp; j++) {
-                m_bdiff(i,j) = exp(dot4(m_polytempvec, m_diffcoeffs[ic]));
-                m_bdiff(j,i) = m_bdiff(i,j);
-                ic++;
+    for (size_t i = 0; i < m_nsp; i++) {
+        evalBinaryDiffRow(i, m_spwork.data());
+        for (size_t j = i; j < m_nsp; j++) {
+            m_bdiff(i,j) = m_spwork[j-i];
+            m_bdiff(j,i) = m_bdiff(i,j);
+        }
+    }
+    m_bindiff_ok = true;
+}
+
+void GasTransport::evalBinaryDiffRow(size_t i, double* d) const
+{
+    // index of the pair (i,i) in the packed upper triangle
+    size_t ic0 = i*m_nsp - i*(i-1)/2;
+    size_t n = m_nsp - i;
+    if (m_tabulate && m_tab_inrange) {
+        interpolate(2*m_nsp + ic0, n, d);
+        if (m_mode != CK_Mode) {
+            double pre = m_temp * m_sqrt_t;
+            for (size_t j = 0; j < n; j++) {
+                d[j] *= pre;
+            }
+        }
+    } else if (m_mode == CK_Mode) {
+        for (size_t j = 0; j < n; j++) {
+            d[j] = exp(dot4(m_polytempvec, m_diffcoeffs[ic0 + j]));
+        }
+    } else {
+        for (size_t j = 0; j < n; j++) {
+            d[j] = m_temp * m_sqrt_t*dot5(m_polytempvec, m_diffcoeffs[ic0 + j]);
+        }
+    }
+}
+
+void GasTransport::updateMixDiffSums(bool weighted)
+{
+    const double* x = m_molefracs.data();
+    double* s1 = m_diffsum1.data();
+    double* s2 = m_diffsum2.data();
+    std::fill(m_diffsum1.begin(), m_diffsum1.end(), 0.0);
+    if (weighted) {
+        std::fill(m_diffsum2.begin(), m_diffsum2.end(), 0.0);
+    }
+    double* r = m_bdiff_rinv.data();
+    for (size_t i = 0; i < m_nsp; i++) {
+        size_t n = m_nsp - i;
+        if (!m_bdiff_rinv_ok) {
+            evalBinaryDiffRow(i, r);
+            for (size_t j = 0; j < n; j++) {
+                r[j] = 1.0 / r[j];
+            }
+        }
+        // The row of pairs (i,j) contributes to the sums for species i and
+        // for each species j
+        double xi = x[i];
+        double si = 0.0;
+        if (weighted) {
+            double xwi = xi * m_mw[i];
+            double swi = 0.0;
+            for (size_t j = i + 1; j < m_nsp; j++) {
+                double rij = r[j-i];
+                si += x[j] * rij;
+                swi += x[j] * m_mw[j] * rij;
+                s1[j] += xi * rij;
+                s2[j] += xwi * rij;
+            }
+            s2[i] += swi;
+        } else {
+            for (size_t j = i + 1; j < m_nsp; j++) {
+                double rij = r[j-i];
+                si += x[j] * rij;
+                s1[j] += xi * rij;
             }
         }
+        s1[i] += si;
+        r += n;
+    }
+    m_bdiff_rinv_ok = true;
+}
+
+const size_t GasTransport::BatchSize;
+
+void GasTransport::evalFitBatch(const vector_fp& c, size_t col, size_t nb,
+                                const double* logt, const size_t* j0,
+                                const double* w, double* out) const
+{
+    if (m_tabulate) {
+        // Interpolate as in interpolate(), for the states within the table
+        const double* t = m_table.data() + col;
+        const size_t tw = m_tab_width;
+        for (size_t i = 0; i < nb; i++) {
+            if (j0[i] != npos) {
+                const double* r = t + j0[i] * tw;
+                const double* wi = w + 4*i;
+                out[i] = wi[0] * r[0] + wi[1] * r[tw] + wi[2] * r[2*tw] +
+                         wi[3] * r[3*tw];
+            } else if (m_mode == CK_Mode) {
+                out[i] = exp(poly3(logt[i], c.data()));
+            } else {
+                out[i] = poly4(logt[i], c.data());
+            }
+        }
+    } else if (m_mode == CK_Mode) {
+        const double c0 = c[0], c1 = c[1], c2 = c[2], c3 = c[3];
+        for (size_t i = 0; i < nb; i++) {
+            double L = logt[i];
+            out[i] = exp(c0 + L*(c1 + L*(c2 + L*c3)));
+        }
     } else {
-        for (size_t i = 0; i < m_nsp; i++) {
-            for (size_t j = i; j < m_nsp; j++) {
-                m_bdiff(i,j) = m_temp * m_sqrt_t*dot5(m_polytempvec,
-                                                      m_diffcoeffs[ic]);
-                m_bdiff(j,i) = m_bdiff(i,j);
+        const double c0 = c[0], c1 = c[1], c2 = c[2], c3 = c[3], c4 = c[4];
+        for (size_t i = 0; i < nb; i++) {
+            double L = logt[i];
+            out[i] = c0 + L*(c1 + L*(c2 + L*(c3 + L*c4)));
+        }
+    }
+}
+
+void GasTransport::tableWeightsBatch(size_t nb, const double* logt,
+                                     size_t* j0, double* w) const
+{
+    for (size_t i = 0; i < nb; i++) {
+        if (!interpolationWeights(logt[i], j0[i], w + 4*i)) {
+            j0[i] = npos;
+        }
+    }
+}
+
+void GasTransport::prepareBatch(size_t nb, const double* T, const double* X,
+                                double* logt, double* xb, double* mmw) const
+{
+    for (size_t i = 0; i < nb; i++) {
+        if (T[i] <= 0.0) {
+            throw CanteraError("GasTransport::prepareBatch",
+                               "negative temperature {}", T[i]);
+        }
+        logt[i] = log(T[i]);
+        const double* x = X + i*m_nsp;
+        double sum = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            sum += x[k];
+        }
+        double rsum = 1.0 / sum;
+        mmw[i] = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            double xk = rsum * x[k];
+            mmw[i] += xk * m_mw[k];
+            xb[k*nb + i] = std::max(Tiny, xk);
+        }
+    }
+}
+
+void GasTransport::getBatchViscosity(size_t n, const double* T,
+                                     const double* X, double* visc)
+{
+    size_t K = m_nsp;
+    vector_fp logt(BatchSize), mmw(BatchSize), work(BatchSize);
+    vector_fp xb(K*BatchSize), spvisc(K*BatchSize), sqvisc(K*BatchSize),
+              denom(K*BatchSize), w(4*BatchSize);
+    std::vector<size_t> j0(BatchSize);
+    const double rsqrt8 = 1.0 / sqrt(8.0);
+    for (size_t i0 = 0; i0 < n; i0 += BatchSize) {
+        size_t nb = std::min(n - i0, BatchSize);
+        prepareBatch(nb, T + i0, X + i0*K, logt.data(), xb.data(), mmw.data());
+        if (m_tabulate) {
+            tableWeightsBatch(nb, logt.data(), j0.data(), w.data());
+        }
+
+        // pure species viscosities
+        for (size_t k = 0; k < K; k++) {
+            double* v = &spvisc[k*nb];
+            double* sv = &sqvisc[k*nb];
+            evalFitBatch(m_visccoeffs[k], k, nb, logt.data(), j0.data(),
+                         w.data(), v);
+            if (m_mode == CK_Mode) {
+                for (size_t i = 0; i < nb; i++) {
+                    sv[i] = sqrt(v[i]);
+                }
+            } else {
+                for (size_t i = 0; i < nb; i++) {
+                    sv[i] = sqrt(sqrt(T[i0 + i])) * v[i];
+                    v[i] = sv[i] * sv[i];
+                }
+            }
+        }
+
+        // denominators of the Wilke mixture rule, accumulated for each pair
+        // of species as in updateViscosity_T()
+        std::fill(denom.begin(), denom.begin() + K*nb, 0.0);
+        for (size_t j = 0; j < K; j++) {
+            for (size_t k = j; k < K; k++) {
+                const double* vj = &spvisc[j*nb];
+                const double* vk = &spvisc[k*nb];
+                const double* svj = &sqvisc[j*nb];
+                const double* svk = &sqvisc[k*nb];
+                const double* xj = &xb[j*nb];
+                const double* xk = &xb[k*nb];
+                double* dj = &denom[j*nb];
+                double* dk = &denom[k*nb];
+                double wratiojk = m_mw[j]/m_mw[k];
+                double wkj = m_wratjk(k,j);
+                double c = rsqrt8 / m_wratkj1(j,k);
+                if (j == k) {
+                    for (size_t i = 0; i < nb; i++) {
+                        double factor1 = 1.0 + (svk[i]/svj[i]) * wkj;
+                        dk[i] += c * factor1 * factor1 * xj[i];
+                    }
+                } else {
+                    for (size_t i = 0; i < nb; i++) {
+                        double factor1 = 1.0 + (svk[i]/svj[i]) * wkj;
+                        double phikj = c * factor1 * factor1;
+                        dk[i] += phikj * xj[i];
+                        dj[i] += phikj / (vk[i]/vj[i] * wratiojk) * xk[i];
+                    }
+                }
+            }
+        }
+
+        std::fill(work.begin(), work.begin() + nb, 0.0);
+        for (size_t k = 0; k < K; k++) {
+            for (size_t i = 0; i < nb; i++) {
+                work[i] += xb[k*nb + i] * spvisc[k*nb + i] / denom[k*nb + i];
+            }
+        }
+        std::copy(work.begin(), work.begin() + nb, visc + i0);
+    }
+}
+
+void GasTransport::getBatchMixDiffCoeffs(size_t n, const double* T,
+                                         const double* P, const double* X,
+                                         double* d)
+{
+    size_t K = m_nsp;
+    vector_fp logt(BatchSize), mmw(BatchSize), pre(BatchSize), dij(BatchSize);
+    vector_fp xb(K*BatchSize), sums(K*BatchSize), dself(K*BatchSize),
+              w(4*BatchSize);
+    std::vector<size_t> j0(BatchSize);
+    for (size_t i0 = 0; i0 < n; i0 += BatchSize) {
+        size_t nb = std::min(n - i0, BatchSize);
+        prepareBatch(nb, T + i0, X + i0*K, logt.data(), xb.data(), mmw.data());
+        if (m_tabulate) {
+            tableWeightsBatch(nb, logt.data(), j0.data(), w.data());
+        }
+        for (size_t i = 0; i < nb; i++) {
+            pre[i] = (m_mode == CK_Mode) ? 1.0 : T[i0 + i] * sqrt(T[i0 + i]);
+        }
+
+        // Sum the terms X_j / D_kj for each pair of species, evaluating the
+        // binary diffusion coefficients (at unit pressure) for all states
+        // in the block
+        std::fill(sums.begin(), sums.begin() + K*nb, 0.0);
+        size_t ic = 0;
+        for (size_t k = 0; k < K; k++) {
+            for (size_t j = k; j < K; j++) {
+                evalFitBatch(m_diffcoeffs[ic], 2*K + ic, nb, logt.data(),
+                             j0.data(), w.data(), dij.data());
                 ic++;
+                if (j == k) {
+                    for (size_t i = 0; i < nb; i++) {
+                        dself[k*nb + i] = pre[i] * dij[i];
+                    }
+                    continue;
+                }
+                double* sk = &sums[k*nb];
+                double* sj = &sums[j*nb];
+                const double* xk = &xb[k*nb];
+                const double* xj = &xb[j*nb];
+                for (size_t i = 0; i < nb; i++) {
+                    double r = 1.0 / (pre[i] * dij[i]);
+                    sk[i] += xj[i] * r;
+                    sj[i] += xk[i] * r;
+                }
+            }
+        }
+
+        for (size_t i = 0; i < nb; i++) {
+            double p = P[i0 + i];
+            double* di = d + (i0 + i)*K;
+            if (K == 1) {
+                di[0] = dself[i] / p;
+                continue;
+            }
+            double sumxw = 0.0;
+            for (size_t k = 0; k < K; k++) {
+                sumxw += xb[k*nb + i] * m_mw[k];
+            }
+            for (size_t k = 0; k < K; k++) {
+                double sum2 = sums[k*nb + i];
+                if (sum2 <= 0.0) {
+                    di[k] = dself[k*nb + i] / p;
+                } else {
+                    di[k] = (sumxw - xb[k*nb + i] * m_mw[k]) /
+                            (p * mmw[i] * sum2);
+                }
             }
         }
     }
-    m_bindiff_ok = true;
 }
 
 void GasTransport::getBinaryDiffCoeffs(const size_t ld, doublereal* const d)
@@ -240,30 +751,21 @@ void GasTransport::getMixDiffCoeffs(doublereal* const d)
 {
     update_T();
     update_C();
-
-    // update the binary diffusion coefficients if necessary
-    if (!m_bindiff_ok) {
-        updateDiff_T();
-    }
+    updateMixDiffSums(false);
 
     doublereal mmw = m_thermo->meanMolecularWeight();
     doublereal sumxw = 0.0;
     doublereal p = m_thermo->pressure();
     if (m_nsp == 1) {
-        d[0] = m_bdiff(0,0) / p;
+        d[0] = 1.0 / (m_bdiff_rinv[0] * p);
     } else {
         for (size_t k = 0; k < m_nsp; k++) {
             sumxw += m_molefracs[k] * m_mw[k];
         }
         for (size_t k = 0; k < m_nsp; k++) {
-            double sum2 = 0.0;
-            for (size_t j = 0; j < m_nsp; j++) {
-                if (j != k) {
-                    sum2 += m_molefracs[j] / m_bdiff(j,k);
-                }
-            }
+            double sum2 = m_diffsum1[k];
             if (sum2 <= 0.0) {
-                d[k] = m_bdiff(k,k) / p;
+                d[k] = 1.0 / (m_bdiff_rinv[k*m_nsp - k*(k-1)/2] * p);
             } else {
                 d[k] = (sumxw - m_molefracs[k] * m_mw[k])/(p * mmw * sum2);
             }
@@ -275,25 +777,16 @@ void GasTransport::getMixDiffCoeffsMole(doublereal* const d)
 {
     update_T();
     update_C();
-
-    // update the binary diffusion coefficients if necessary
-    if (!m_bindiff_ok) {
-        updateDiff_T();
-    }
+    updateMixDiffSums(false);
 
     doublereal p = m_thermo->pressure();
     if (m_nsp == 1) {
-        d[0] = m_bdiff(0,0) / p;
+        d[0] = 1.0 / (m_bdiff_rinv[0] * p);
     } else {
         for (size_t k = 0; k < m_nsp; k++) {
-            double sum2 = 0.0;
-            for (size_t j = 0; j < m_nsp; j++) {
-                if (j != k) {
-                    sum2 += m_molefracs[j] / m_bdiff(j,k);
-                }
-            }
+            double sum2 = m_diffsum1[k];
             if (sum2 <= 0.0) {
-                d[k] = m_bdiff(k,k) / p;
+                d[k] = 1.0 / (m_bdiff_rinv[k*m_nsp - k*(k-1)/2] * p);
             } else {
                 d[k] = (1 - m_molefracs[k]) / (p * sum2);
             }
@@ -305,30 +798,18 @@ void GasTransport::getMixDiffCoeffsMass(doublereal* const d)
 {
     update_T();
     update_C();
-
-    // update the binary diffusion coefficients if necessary
-    if (!m_bindiff_ok) {
-        updateDiff_T();
-    }
+    updateMixDiffSums(true);
 
     doublereal mmw = m_thermo->meanMolecularWeight();
     doublereal p = m_thermo->pressure();
 
     if (m_nsp == 1) {
-        d[0] = m_bdiff(0,0) / p;
+        d[0] = 1.0 / (m_bdiff_rinv[0] * p);
     } else {
         for (size_t k=0; k<m_nsp; k++) {
-            double sum1 = 0.0;
-            double sum2 = 0.0;
-            for (size_t i=0; i<m_nsp; i++) {
-                if (i==k) {
-                    continue;
-                }
-                sum1 += m_molefracs[i] / m_bdiff(k,i);
-                sum2 += m_molefracs[i] * m_mw[i] / m_bdiff(k,i);
-            }
-            sum1 *= p;
-            sum2 *= p * m_molefracs[k] / (mmw - m_mw[k]*m_molefracs[k]);
+            double sum1 = p * m_diffsum1[k];
+            double sum2 = p * m_diffsum2[k] * m_molefracs[k] /
+                          (mmw - m_mw[k]*m_molefracs[k]);
             d[k] = 1.0 / (sum1 + sum2);
         }
     }
@@ -349,6 +830,9 @@ void GasTransport::init(thermo_t* thermo, int mode, int log_level)
     m_sqvisc.resize(m_nsp);
     m_phi.resize(m_nsp, m_nsp, 0.0);
     m_bdiff.resize(m_nsp, m_nsp);
+    m_bdiff_rinv.resize(m_nsp*(m_nsp+1)/2);
+    m_diffsum1.resize(m_nsp);
+    m_diffsum2.resize(m_nsp);
 
     // make a local copy of the molecular weights
     m_mw = m_thermo->molecularWeights();
@@ -368,6 +852,129 @@ void GasTransport::init(thermo_t* thermo, int mode, int log_level)
     m_viscwt_ok = false;
     m_spvisc_ok = false;
     m_bindiff_ok = false;
+
+    // the polynomial fits may have changed, so any existing table is invalid
+    m_tabulate = false;
+    m_table.clear();
+}
+
+void GasTransport::setTabulation(bool tabulate, double rtol)
+{
+    m_tabulate = false;
+    m_table.clear();
+    m_temp = -1.0; // force update_T() to recompute everything
+    if (!tabulate) {
+        return;
+    }
+    if (m_visccoeffs.size() != m_nsp) {
+        throw CanteraError("GasTransport::setTabulation",
+                           "Transport manager has not been initialized");
+    }
+    if (rtol <= 0.0) {
+        throw CanteraError("GasTransport::setTabulation",
+                           "Tolerance must be positive; got {}", rtol);
+    }
+
+    m_tab_width = 2*m_nsp + m_diffcoeffs.size();
+    m_tab_work.resize(m_diffcoeffs.size());
+    m_tab_logtmin = log(m_thermo->minTemp());
+    double logtmax = log(m_thermo->maxTemp());
+    if (logtmax <= m_tab_logtmin) {
+        throw CanteraError("GasTransport::setTabulation", "Invalid "
+            "temperature range for tabulation: {} to {}",
+            m_thermo->minTemp(), m_thermo->maxTemp());
+    }
+
+    // In the default mode, the fit for the viscosity is squared, doubling
+    // its relative error
+    vector_fp scale(m_tab_width, 1.0);
+    if (m_mode != CK_Mode) {
+        std::fill(scale.begin(), scale.begin() + m_nsp, 2.0);
+    }
+
+    // Double the number of intervals until the interpolation error at the
+    // midpoint of every interval satisfies the tolerance. Since the
+    // interpolation error of each column is proportional to the fourth power
+    // of the grid spacing, this quickly leads to a table which is not
+    // unnecessarily large.
+    const size_t max_intervals = 4096;
+    vector_fp exact(m_tab_width), approx(m_tab_width);
+    for (size_t nint = 8; nint <= max_intervals; nint *= 2) {
+        m_tab_dlogt = (logtmax - m_tab_logtmin) / nint;
+        m_table.resize((nint + 1) * m_tab_width);
+        for (size_t n = 0; n <= nint; n++) {
+            evalPropertyFits(m_tab_logtmin + n * m_tab_dlogt,
+                             &m_table[n * m_tab_width]);
+        }
+
+        double maxerr = 0.0;
+        for (size_t n = 0; n < nint && maxerr <= rtol; n++) {
+            double logt = m_tab_logtmin + (n + 0.5) * m_tab_dlogt;
+            interpolationWeights(logt, m_tab_j0, m_tab_w);
+            interpolate(0, m_tab_width, approx.data());
+            evalPropertyFits(logt, exact.data());
+            for (size_t k = 0; k < m_tab_width; k++) {
+                maxerr = std::max(maxerr, scale[k] *
+                    std::abs(approx[k] - exact[k]) / std::abs(exact[k]));
+            }
+        }
+        if (maxerr <= rtol) {
+            m_tabulate = true;
+            if (m_log_level) {
+                writelogf("Tabulated species transport properties at %d "
+                          "temperatures; maximum relative error: %12.6g\n",
+                          nint + 1, maxerr);
+            }
+            return;
+        }
+    }
+    m_table.clear();
+    throw CanteraError("GasTransport::setTabulation", "Unable to satisfy the "
+        "tolerance {} with a table of {} temperatures", rtol,
+        max_intervals + 1);
+}
+
+void GasTransport::evalPropertyFits(double logt, double* g) const
+{
+    if (m_mode == CK_Mode) {
+        for (size_t k = 0; k < m_nsp; k++) {
+            g[k] = exp(poly3(logt, m_visccoeffs[k].data()));
+            g[m_nsp + k] = exp(poly3(logt, m_condcoeffs[k].data()));
+        }
+        for (size_t ic = 0; ic < m_diffcoeffs.size(); ic++) {
+            g[2*m_nsp + ic] = exp(poly3(logt, m_diffcoeffs[ic].data()));
+        }
+    } else {
+        for (size_t k = 0; k < m_nsp; k++) {
+            g[k] = poly4(logt, m_visccoeffs[k].data());
+            g[m_nsp + k] = poly4(logt, m_condcoeffs[k].data());
+        }
+        for (size_t ic = 0; ic < m_diffcoeffs.size(); ic++) {
+            g[2*m_nsp + ic] = poly4(logt, m_diffcoeffs[ic].data());
+        }
+    }
+}
+
+bool GasTransport::interpolationWeights(double logt, size_t& j0,
+                                        double* w) const
+{
+    size_t nint = m_table.size() / m_tab_width - 1;
+    double x = (logt - m_tab_logtmin) / m_tab_dlogt;
+    if (!(x >= 0.0 && x <= nint)) {
+        return false;
+    }
+    // Use the two table rows on either side of logt, or the four rows at the
+    // end of the table if logt is in the first or last interval
+    size_t j = static_cast<size_t>(x);
+    j0 = std::min(std::max(j, size_t(1)) - 1, nint - 3);
+    x -= j0;
+
+    // Lagrange interpolation weights for the rows j0, ..., j0+3
+    w[0] = -(x - 1.0) * (x - 2.0) * (x - 3.0) / 6.0;
+    w[1] = 0.5 * x * (x - 2.0) * (x - 3.0);
+    w[2] = -0.5 * x * (x - 1.0) * (x - 3.0);
+    w[3] = x * (x - 1.0) * (x - 2.0) / 6.0;
+    return true;
 }
 
 void GasTransport::setupMM()
@@ -439,16 +1046,198 @@ void GasTransport::setupMM()
         tstar_max = 99.9;
     }
 
+    m_visccoeffs.clear();
+    m_condcoeffs.clear();
+    m_diffcoeffs.clear();
+    m_omega22_poly.clear();
+    m_astar_poly.clear();
+    m_bstar_poly.clear();
+    m_cstar_poly.clear();
+    m_fitCacheFile.clear();
+    GasTransportFits fits;
+    if (!m_presetFits.visccoeffs.empty()) {
+        std::swap(fits, m_presetFits);
+        if (!checkFits(fits)) {
+            throw CanteraError("GasTransport::setupMM", "Precomputed "
+                "polynomial fits are inconsistent with the phase '{}'",
+                m_thermo->id());
+        }
+        useFits(fits);
+        return;
+    }
+
+    vector_fp cp_R = fitHeatCapacities();
+    std::string cacheDir = fitCache();
+    size_t nThreads;
+    {
+        std::unique_lock<std::mutex> lock(fit_settings_mutex);
+        nThreads = fit_threads;
+    }
+    vector_fp key;
+    std::string cacheFile;
+    if (!cacheDir.empty()) {
+        key = fitCacheKey(cp_R);
+        cacheFile = cacheFileName(cacheDir, key);
+        if (readFitCache(cacheFile, key, fits) && checkFits(fits)) {
+            debuglog("Polynomial fits read from '" + cacheFile + "'\n",
+                     m_log_level);
+            m_fitCacheFile = cacheFile;
+            useFits(fits);
+            return;
+        }
+    }
+
+    // The fits are computed in parallel only if no log output is requested,
+    // so that the output does not depend on the thread scheduling
+    std::unique_ptr<ThreadPool> pool;
+    if (nThreads != 1 && m_log_level == 0) {
+        pool.reset(new ThreadPool(nThreads));
+    }
+
     // initialize the collision integral calculator for the desired T* range
     debuglog("*** collision_integrals ***\n", m_log_level);
     MMCollisionInt integrals;
     integrals.init(tstar_min, tstar_max, m_log_level);
-    fitCollisionIntegrals(integrals);
+    fitCollisionIntegrals(integrals, pool.get());
     debuglog("*** end of collision_integrals ***\n", m_log_level);
     // make polynomial fits
     debuglog("*** property fits ***\n", m_log_level);
-    fitProperties(integrals);
+    fitProperties(integrals, cp_R, pool.get());
     debuglog("*** end of property fits ***\n", m_log_level);
+
+    if (!cacheFile.empty()) {
+        getFits(fits);
+        if (writeFitCache(cacheFile, key, fits)) {
+            debuglog("Polynomial fits written to '" + cacheFile + "'\n",
+                     m_log_level);
+            m_fitCacheFile = cacheFile;
+        }
+    }
+}
+
+vector_fp GasTransport::fitHeatCapacities()
+{
+    // must match the temperatures used in fitProperties()
+    const size_t np = 50;
+    double dt = (m_thermo->maxTemp() - m_thermo->minTemp())/(np-1);
+    vector_fp cp_R(np * m_nsp);
+    if (m_nsp == 0) {
+        return cp_R;
+    }
+    for (size_t n = 0; n < np; n++) {
+        m_thermo->setTemperature(m_thermo->minTemp() + dt*n);
+        m_thermo->getCp_R_ref(&cp_R[n*m_nsp]);
+    }
+    return cp_R;
+}
+
+vector_fp GasTransport::fitCacheKey(const vector_fp& cp_R) const
+{
+    const vector_fp& mw = m_thermo->molecularWeights();
+    vector_fp key{static_cast<double>(m_mode), COLL_INT_POLY_DEGREE,
+                  static_cast<double>(m_nsp), m_thermo->minTemp(),
+                  m_thermo->maxTemp()};
+    for (size_t k = 0; k < m_nsp; k++) {
+        double data[] = {mw[k], m_crot[k], m_zrot[k], m_sigma[k], m_eps[k],
+                         m_dipole(k,k), m_alpha[k]};
+        key.insert(key.end(), std::begin(data), std::end(data));
+    }
+    key.insert(key.end(), cp_R.begin(), cp_R.end());
+    return key;
+}
+
+bool GasTransport::checkFits(const GasTransportFits& fits) const
+{
+    if (fits.mode != m_mode || fits.visccoeffs.size() != m_nsp ||
+        fits.condcoeffs.size() != m_nsp ||
+        fits.diffcoeffs.size() != m_nsp*(m_nsp+1)/2 ||
+        fits.poly.size() != m_nsp) {
+        return false;
+    }
+    // must match the degrees used in fitProperties()
+    size_t ncoeffs = (m_mode == CK_Mode ? 4 : 5);
+    for (const auto* coeffs : {&fits.visccoeffs, &fits.condcoeffs,
+                               &fits.diffcoeffs}) {
+        for (const auto& c : *coeffs) {
+            if (c.size() != ncoeffs) {
+                return false;
+            }
+        }
+    }
+    size_t nfits = fits.omega22.size();
+    if (fits.astar.size() != nfits || fits.bstar.size() != nfits ||
+        fits.cstar.size() != nfits) {
+        return false;
+    }
+    // must match the degree used in fitCollisionIntegrals()
+    size_t nCollCoeffs = (m_mode == CK_Mode ? 6 : COLL_INT_POLY_DEGREE) + 1;
+    for (const auto* coeffs : {&fits.omega22, &fits.astar, &fits.bstar,
+                               &fits.cstar}) {
+        for (const auto& c : *coeffs) {
+            if (c.size() != nCollCoeffs) {
+                return false;
+            }
+        }
+    }
+    for (const auto& row : fits.poly) {
+        if (row.size() != m_nsp) {
+            return false;
+        }
+        for (int i : row) {
+            if (i < 0 || static_cast<size_t>(i) >= nfits) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void GasTransport::useFits(GasTransportFits& fits)
+{
+    m_visccoeffs.swap(fits.visccoeffs);
+    m_condcoeffs.swap(fits.condcoeffs);
+    m_diffcoeffs.swap(fits.diffcoeffs);
+    m_poly.swap(fits.poly);
+    m_omega22_poly.swap(fits.omega22);
+    m_astar_poly.swap(fits.astar);
+    m_bstar_poly.swap(fits.bstar);
+    m_cstar_poly.swap(fits.cstar);
+}
+
+void GasTransport::getFits(GasTransportFits& fits) const
+{
+    fits.mode = m_mode;
+    fits.visccoeffs = m_visccoeffs;
+    fits.condcoeffs = m_condcoeffs;
+    fits.diffcoeffs = m_diffcoeffs;
+    fits.poly = m_poly;
+    fits.omega22 = m_omega22_poly;
+    fits.astar = m_astar_poly;
+    fits.bstar = m_bstar_poly;
+    fits.cstar = m_cstar_poly;
+}
+
+void GasTransport::setFits(const GasTransportFits& fits)
+{
+    m_presetFits = fits;
+}
+
+void GasTransport::setFitCache(const std::string& dir)
+{
+    std::unique_lock<std::mutex> lock(fit_settings_mutex);
+    fit_cache_dir = dir;
+}
+
+std::string GasTransport::fitCache()
+{
+    std::unique_lock<std::mutex> lock(fit_settings_mutex);
+    return fit_cache_dir;
+}
+
+void GasTransport::setFitThreads(size_t n)
+{
+    std::unique_lock<std::mutex> lock(fit_settings_mutex);
+    fit_threads = (n == 0) ? ThreadPool::hardwareThreads() : n;
 }
 
 void GasTransport::getTransportData()
@@ -505,10 +1294,9 @@ void GasTransport::makePolarCorrections(size_t i, size_t j,
     f_eps = xi*xi;
 }
 
-void GasTransport::fitCollisionIntegrals(MMCollisionInt& integrals)
+void GasTransport::fitCollisionIntegrals(MMCollisionInt& integrals,
+                                         ThreadPool* pool)
 {
-    double dstar;
-
     // Chemkin fits to sixth order polynomials
     int degree = (m_mode == CK_Mode ? 6 : COLL_INT_POLY_DEGREE);
     if (m_log_level) {
@@ -519,51 +1307,59 @@ void GasTransport::fitCollisionIntegrals(MMCollisionInt& integrals)
             writelog("*** polynomial coefficients not printed (log_level < 3) ***\n");
         }
     }
+
+    // Find the distinct values of delta* for which fits are required. If a
+    // fit has already been assigned for delta* = m_delta(i,j), then use it.
+    // Otherwise, add m_delta(i,j) to the list of delta* values for which fits
+    // will be done.
     vector_fp fitlist;
+    std::map<double, int> fitindex;
     for (size_t i = 0; i < m_nsp; i++) {
         for (size_t j = i; j < m_nsp; j++) {
             // Chemkin fits only delta* = 0
-            if (m_mode != CK_Mode) {
-                dstar = m_delta(i,j);
+            double dstar = (m_mode != CK_Mode) ? m_delta(i,j) : 0.0;
+            auto iter = fitindex.find(dstar);
+            if (iter != fitindex.end()) {
+                // delta* found in fitlist, so just point to this polynomial
+                m_poly[i][j] = iter->second;
             } else {
-                dstar = 0.0;
-            }
-
-            // if a fit has already been generated for delta* = m_delta(i,j),
-            // then use it. Otherwise, make a new fit, and add m_delta(i,j) to
-            // the list of delta* values for which fits have been done.
-
-            // 'find' returns a pointer to end() if not found
-            auto dptr = find(fitlist.begin(), fitlist.end(), dstar);
-            if (dptr == fitlist.end()) {
-                vector_fp ca(degree+1), cb(degree+1), cc(degree+1);
-                vector_fp co22(degree+1);
-                integrals.fit(degree, dstar, ca.data(), cb.data(), cc.data());
-                integrals.fit_omega22(degree, dstar, co22.data());
-                m_omega22_poly.push_back(co22);
-                m_astar_poly.push_back(ca);
-                m_bstar_poly.push_back(cb);
-                m_cstar_poly.push_back(cc);
-                m_poly[i][j] = static_cast<int>(m_astar_poly.size()) - 1;
+                m_poly[i][j] = static_cast<int>(fitlist.size());
+                if (dstar == dstar) { // NaN never matches an existing fit
+                    fitindex[dstar] = m_poly[i][j];
+                }
                 fitlist.push_back(dstar);
-            } else {
-                // delta* found in fitlist, so just point to this polynomial
-                m_poly[i][j] = static_cast<int>((dptr - fitlist.begin()));
             }
             m_poly[j][i] = m_poly[i][j];
         }
     }
+
+    size_t nfits = fitlist.size();
+    m_omega22_poly.assign(nfits, vector_fp(degree+1));
+    m_astar_poly.assign(nfits, vector_fp(degree+1));
+    m_bstar_poly.assign(nfits, vector_fp(degree+1));
+    m_cstar_poly.assign(nfits, vector_fp(degree+1));
+    auto fit = [&](size_t n, size_t worker) {
+        integrals.fit(degree, fitlist[n], m_astar_poly[n].data(),
+                      m_bstar_poly[n].data(), m_cstar_poly[n].data());
+        integrals.fit_omega22(degree, fitlist[n], m_omega22_poly[n].data());
+    };
+    if (pool) {
+        pool->run(nfits, fit);
+    } else {
+        for (size_t n = 0; n < nfits; n++) {
+            fit(n, 0);
+        }
+    }
 }
 
-void GasTransport::fitProperties(MMCollisionInt& integrals)
+void GasTransport::fitProperties(MMCollisionInt& integrals,
+                                 const vector_fp& cp_R, ThreadPool* pool)
 {
-    int ndeg = 0;
     // number of points to use in generating fit data
     const size_t np = 50;
     int degree = (m_mode == CK_Mode ? 3 : 4);
     double dt = (m_thermo->maxTemp() - m_thermo->minTemp())/(np-1);
-    vector_fp tlog(np), spvisc(np), spcond(np);
-    vector_fp w(np), w2(np);
+    vector_fp tlog(np);
 
     // generate array of log(t) values
     for (size_t n = 0; n < np; n++) {
@@ -571,16 +1367,25 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
         tlog[n] = log(t);
     }
 
-    // vector of polynomial coefficients
-    vector_fp c(degree + 1), c2(degree + 1);
+    // The fits for each species and each species pair are independent, and
+    // are evaluated by the following functions, which may be called in
+    // parallel. The maximum absolute and relative errors of the fits for each
+    // species or each row of species pairs are stored in these arrays.
+    vector_fp visc_err(2*m_nsp), cond_err(2*m_nsp), diff_err(2*m_nsp);
+    auto run = [&](size_t nTasks, const std::function<void(size_t, size_t)>& task) {
+        if (pool) {
+            pool->run(nTasks, task);
+        } else {
+            for (size_t n = 0; n < nTasks; n++) {
+                task(n, 0);
+            }
+        }
+    };
 
     // fit the pure-species viscosity and thermal conductivity for each species
     if (m_log_level && m_log_level < 2) {
         writelog("*** polynomial coefficients not printed (log_level < 2) ***\n");
     }
-    double sqrt_T, visc, err, relerr,
-               mxerr = 0.0, mxrelerr = 0.0, mxerr_cond = 0.0, mxrelerr_cond = 0.0;
-
     if (m_log_level) {
         writelog("Polynomial fits for viscosity:\n");
         if (m_mode == CK_Mode) {
@@ -591,17 +1396,20 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
         }
     }
 
-    double cp_R, cond, w_RT, f_int, A_factor, B_factor, c1, cv_rot, cv_int,
-           f_rot, f_trans, om11, diffcoeff;
-
     const vector_fp& mw = m_thermo->molecularWeights();
-    for (size_t k = 0; k < m_nsp; k++) {
+    m_visccoeffs.assign(m_nsp, vector_fp(degree + 1));
+    m_condcoeffs.assign(m_nsp, vector_fp(degree + 1));
+    run(m_nsp, [&](size_t k, size_t worker) {
+        int ndeg = 0;
+        vector_fp spvisc(np), spcond(np), w(np), w2(np);
+        double* c = m_visccoeffs[k].data();
+        double* c2 = m_condcoeffs[k].data();
+        double sqrt_T, visc, err, relerr, mxerr = 0.0, mxrelerr = 0.0,
+               mxerr_cond = 0.0, mxrelerr_cond = 0.0;
+        double cond, w_RT, f_int, A_factor, B_factor, c1, cv_rot, cv_int,
+               f_rot, f_trans, om11, diffcoeff;
         for (size_t n = 0; n < np; n++) {
             double t = m_thermo->minTemp() + dt*n;
-            m_thermo->setTemperature(t);
-            vector_fp cp_R_all(m_thermo->nSpecies());
-            m_thermo->getCp_R_ref(&cp_R_all[0]);
-            cp_R = cp_R_all[k];
             double tstar = Boltzmann * t/ m_eps[k];
             sqrt_T = sqrt(t);
             double om22 = integrals.omega22(tstar, m_delta(k,k));
@@ -623,7 +1431,7 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
             A_factor = 2.5 - f_int;
             B_factor = m_zrot[k] + 2.0/Pi * (5.0/3.0 * cv_rot + f_int);
             c1 = 2.0/Pi * A_factor/B_factor;
-            cv_int = cp_R - 2.5 - cv_rot;
+            cv_int = cp_R[n*m_nsp + k] - 2.5 - cv_rot;
             f_rot = f_int * (1.0 + c1);
             f_trans = 2.5 * (1.0 - c1 * cv_rot/1.5);
             cond = (visc/mw[k])*GasConstant*(f_trans * 1.5
@@ -652,20 +1460,20 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
             }
         }
         polyfit(np, tlog.data(), spvisc.data(),
-                w.data(), degree, ndeg, 0.0, c.data());
+                w.data(), degree, ndeg, 0.0, c);
         polyfit(np, tlog.data(), spcond.data(),
-                w.data(), degree, ndeg, 0.0, c2.data());
+                w.data(), degree, ndeg, 0.0, c2);
 
         // evaluate max fit errors for viscosity
         for (size_t n = 0; n < np; n++) {
             double val, fit;
             if (m_mode == CK_Mode) {
                 val = exp(spvisc[n]);
-                fit = exp(poly3(tlog[n], c.data()));
+                fit = exp(poly3(tlog[n], c));
             } else {
                 sqrt_T = exp(0.5*tlog[n]);
                 val = sqrt_T * pow(spvisc[n],2);
-                fit = sqrt_T * pow(poly4(tlog[n], c.data()),2);
+                fit = sqrt_T * pow(poly4(tlog[n], c),2);
             }
             err = fit - val;
             relerr = err/val;
@@ -678,25 +1486,36 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
             double val, fit;
             if (m_mode == CK_Mode) {
                 val = exp(spcond[n]);
-                fit = exp(poly3(tlog[n], c2.data()));
+                fit = exp(poly3(tlog[n], c2));
             } else {
                 sqrt_T = exp(0.5*tlog[n]);
                 val = sqrt_T * spcond[n];
-                fit = sqrt_T * poly4(tlog[n], c2.data());
+                fit = sqrt_T * poly4(tlog[n], c2);
             }
             err = fit - val;
             relerr = err/val;
             mxerr_cond = std::max(mxerr_cond, fabs(err));
             mxrelerr_cond = std::max(mxrelerr_cond, fabs(relerr));
         }
-        m_visccoeffs.push_back(c);
-        m_condcoeffs.push_back(c2);
+        visc_err[2*k] = mxerr;
+        visc_err[2*k+1] = mxrelerr;
+        cond_err[2*k] = mxerr_cond;
+        cond_err[2*k+1] = mxrelerr_cond;
+    });
 
-        if (m_log_level >= 2) {
-            writelog(m_thermo->speciesName(k) + ": [" + vec2str(c) + "]\n");
-        }
-    }
     if (m_log_level) {
+        double mxerr = 0.0, mxrelerr = 0.0, mxerr_cond = 0.0,
+               mxrelerr_cond = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            mxerr = std::max(mxerr, visc_err[2*k]);
+            mxrelerr = std::max(mxrelerr, visc_err[2*k+1]);
+            mxerr_cond = std::max(mxerr_cond, cond_err[2*k]);
+            mxrelerr_cond = std::max(mxrelerr_cond, cond_err[2*k+1]);
+            if (m_log_level >= 2) {
+                writelog(m_thermo->speciesName(k) + ": [" +
+                         vec2str(m_visccoeffs[k]) + "]\n");
+            }
+        }
         writelogf("Maximum viscosity absolute error:  %12.6g\n", mxerr);
         writelogf("Maximum viscosity relative error:  %12.6g\n", mxrelerr);
         writelog("\nPolynomial fits for conductivity:\n");
@@ -724,25 +1543,28 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
         }
     }
 
-    mxerr = 0.0, mxrelerr = 0.0;
-    vector_fp diff(np + 1);
-    double eps, sigma;
-    for (size_t k = 0; k < m_nsp; k++) {
-        for (size_t j = k; j < m_nsp; j++) {
+    // The fits for the pairs (k, j) with j >= k are stored consecutively,
+    // starting with the pairs for k = 0.
+    m_diffcoeffs.assign(m_nsp*(m_nsp+1)/2, vector_fp(degree + 1));
+    run(m_nsp, [&](size_t k, size_t worker) {
+        int ndeg = 0;
+        vector_fp diff(np + 1), w(np);
+        double err, relerr, mxerr = 0.0, mxrelerr = 0.0;
+        size_t ic = k*m_nsp - k*(k-1)/2;
+        for (size_t j = k; j < m_nsp; j++, ic++) {
+            double* c = m_diffcoeffs[ic].data();
             for (size_t n = 0; n < np; n++) {
                 double t = m_thermo->minTemp() + dt*n;
-                eps = m_epsilon(j,k);
+                double eps = m_epsilon(j,k);
                 double tstar = Boltzmann * t/eps;
-                sigma = m_diam(j,k);
-                om11 = integrals.omega11(tstar, m_delta(j,k));
-                diffcoeff = 3.0/16.0 * sqrt(2.0 * Pi/m_reducedMass(k,j)) *
+                double sigma = m_diam(j,k);
+                double om11 = integrals.omega11(tstar, m_delta(j,k));
+                double diffcoeff = 3.0/16.0 * sqrt(2.0 * Pi/m_reducedMass(k,j)) *
                             pow(Boltzmann * t, 1.5) /
                             (Pi * sigma * sigma * om11);
 
-                // 2nd order correction
-                // NOTE: THIS CORRECTION IS NOT APPLIED
-                double fkj, fjk;
-                getBinDiffCorrection(t, integrals, k, j, 1.0, 1.0, fkj, fjk);
+                // The 2nd order correction computed by getBinDiffCorrection()
+                // is not applied.
 
                 if (m_mode == CK_Mode) {
                     diff[n] = log(diffcoeff);
@@ -753,32 +1575,43 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
                 }
             }
             polyfit(np, tlog.data(), diff.data(),
-                    w.data(), degree, ndeg, 0.0, c.data());
+                    w.data(), degree, ndeg, 0.0, c);
 
             for (size_t n = 0; n < np; n++) {
                 double val, fit;
                 if (m_mode == CK_Mode) {
                     val = exp(diff[n]);
-                    fit = exp(poly3(tlog[n], c.data()));
+                    fit = exp(poly3(tlog[n], c));
                 } else {
                     double t = exp(tlog[n]);
                     double pre = pow(t, 1.5);
                     val = pre * diff[n];
-                    fit = pre * poly4(tlog[n], c.data());
+                    fit = pre * poly4(tlog[n], c);
                 }
                 err = fit - val;
                 relerr = err/val;
                 mxerr = std::max(mxerr, fabs(err));
                 mxrelerr = std::max(mxrelerr, fabs(relerr));
             }
-            m_diffcoeffs.push_back(c);
-            if (m_log_level >= 2) {
-                writelog(m_thermo->speciesName(k) + "__" +
-                         m_thermo->speciesName(j) + ": [" + vec2str(c) + "]\n");
-            }
         }
-    }
+        diff_err[2*k] = mxerr;
+        diff_err[2*k+1] = mxrelerr;
+    });
+
     if (m_log_level) {
+        double mxerr = 0.0, mxrelerr = 0.0;
+        size_t ic = 0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            mxerr = std::max(mxerr, diff_err[2*k]);
+            mxrelerr = std::max(mxrelerr, diff_err[2*k+1]);
+            for (size_t j = k; j < m_nsp; j++, ic++) {
+                if (m_log_level >= 2) {
+                    writelog(m_thermo->speciesName(k) + "__" +
+                             m_thermo->speciesName(j) + ": [" +
+                             vec2str(m_diffcoeffs[ic]) + "]\n");
+                }
+            }
+        }
         writelogf("Maximum binary diffusion coefficient absolute error:"
                  "  %12.6g\n", mxerr);
         writelogf("Maximum binary diffusion coefficient relative error:"
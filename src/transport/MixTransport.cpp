@@ -88,6 +88,42 @@ doublereal MixTransport::thermalConductivity()
     return m_lambda;
 }
 
+void MixTransport::getBatchThermalConductivity(size_t n, const double* T,
+                                               const double* X, double* cond)
+{
+    vector_fp logt(BatchSize), mmw(BatchSize), sum1(BatchSize),
+              sum2(BatchSize), spcond(BatchSize);
+    vector_fp xb(m_nsp*BatchSize), w(4*BatchSize);
+    std::vector<size_t> j0(BatchSize);
+    for (size_t i0 = 0; i0 < n; i0 += BatchSize) {
+        size_t nb = std::min(n - i0, BatchSize);
+        prepareBatch(nb, T + i0, X + i0*m_nsp, logt.data(), xb.data(),
+                     mmw.data());
+        if (m_tabulate) {
+            tableWeightsBatch(nb, logt.data(), j0.data(), w.data());
+        }
+        std::fill(sum1.begin(), sum1.end(), 0.0);
+        std::fill(sum2.begin(), sum2.end(), 0.0);
+        for (size_t k = 0; k < m_nsp; k++) {
+            evalFitBatch(m_condcoeffs[k], m_nsp + k, nb, logt.data(),
+                         j0.data(), w.data(), spcond.data());
+            if (m_mode != CK_Mode) {
+                for (size_t i = 0; i < nb; i++) {
+                    spcond[i] *= sqrt(T[i0 + i]);
+                }
+            }
+            const double* xk = &xb[k*nb];
+            for (size_t i = 0; i < nb; i++) {
+                sum1[i] += xk[i] * spcond[i];
+                sum2[i] += xk[i] / spcond[i];
+            }
+        }
+        for (size_t i = 0; i < nb; i++) {
+            cond[i0 + i] = 0.5*(sum1[i] + 1.0/sum2[i]);
+        }
+    }
+}
+
 void MixTransport::getThermalDiffCoeffs(doublereal* const dt)
 {
     for (size_t k = 0; k < m_nsp; k++) {
@@ -153,7 +189,14 @@ void MixTransport::update_C()
 
 void MixTransport::updateCond_T()
 {
-    if (m_mode == CK_Mode) {
+    if (m_tabulate && m_tab_inrange) {
+        interpolate(m_nsp, m_nsp, m_cond.data());
+        if (m_mode != CK_Mode) {
+            for (size_t k = 0; k < m_nsp; k++) {
+                m_cond[k] *= m_sqrt_t;
+            }
+        }
+    } else if (m_mode == CK_Mode) {
         for (size_t k = 0; k < m_nsp; k++) {
             m_cond[k] = exp(dot4(m_polytempvec, m_condcoeffs[k]));
         }
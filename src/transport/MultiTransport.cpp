@@ -9,6 +9,7 @@
 
 #include "cantera/transport/MultiTransport.h"
 #include "cantera/thermo/IdealGasPhase.h"
+#include "cantera/numerics/ctlapack.h"
 #include "cantera/base/stringUtils.h"
 
 using namespace std;
@@ -36,17 +37,30 @@ doublereal Frot(doublereal tr, doublereal sqtr)
 
 MultiTransport::MultiTransport(thermo_t* thermo)
     : GasTransport(thermo)
+    , m_lfactor_ok(false)
+    , m_lmatrix_reuse(false)
+    , m_lmatrix_rtol(1e-8)
+    , m_nfactor(0)
+    , m_nsolve(0)
 {
 }
 
+Transport* MultiTransport::duplMyselfAsTransport() const
+{
+    return new MultiTransport(*this);
+}
+
 void MultiTransport::init(ThermoPhase* thermo, int mode, int log_level)
 {
     GasTransport::init(thermo, mode, log_level);
 
     // the L matrix
-    m_Lmatrix.resize(3*m_nsp, 3*m_nsp);
+    m_Lmatrix.resize(2*m_nsp, 2*m_nsp);
     m_a.resize(3*m_nsp, 1.0);
     m_b.resize(3*m_nsp, 0.0);
+    m_lrhs.resize(2*m_nsp);
+    m_lresid.resize(2*m_nsp);
+    m_lfactor_ok = false;
     m_aa.resize(m_nsp, m_nsp, 0.0);
     m_molefracs_last.resize(m_nsp, -1.0);
     m_frot_298.resize(m_nsp);
@@ -117,8 +131,7 @@ void MultiTransport::solveLMatrixEquation()
     }
 
     // Copy the mole fractions twice into the last two blocks of the right-hand-
-    // side vector m_b. The first block of m_b was set to zero when it was
-    // created, and is not modified so doesn't need to be reset to zero.
+    // side vector m_b. The first block of m_b is zero.
     for (size_t k = 0; k < m_nsp; k++) {
         m_b[k] = 0.0;
         m_b[k + m_nsp] = m_molefracs[k];
@@ -126,10 +139,10 @@ void MultiTransport::solveLMatrixEquation()
     }
 
     // Set the right-hand side vector to zero in the 3rd block for all species
-    // with no internal energy modes.  The corresponding third-block rows and
-    // columns will be set to zero, except on the diagonal of L01,01, where they
-    // are set to 1.0. This has the effect of eliminating these equations from
-    // the system, since the equation becomes: m_a[2*m_nsp + k] = 0.0.
+    // with no internal energy modes. The corresponding third-block rows and
+    // columns of the L matrix are zero, except on the diagonal of L01,01, so
+    // these equations reduce to m_a[2*m_nsp + k] = 0.0, and are eliminated
+    // from the system.
 
     // Note that this differs from the Chemkin procedure, where all *monatomic*
     // species are excluded. Since monatomic radicals can have non-zero internal
@@ -141,27 +154,125 @@ void MultiTransport::solveLMatrixEquation()
     }
 
     // evaluate the submatrices of the L matrix
-    m_Lmatrix.resize(3*m_nsp, 3*m_nsp, 0.0);
-
-    //! Evaluate the upper-left block of the L matrix.
     eval_L0000(m_molefracs.data());
     eval_L0010(m_molefracs.data());
-    eval_L0001();
-    eval_L1000();
     eval_L1010(m_molefracs.data());
     eval_L1001(m_molefracs.data());
-    eval_L0100();
-    eval_L0110();
     eval_L0101(m_molefracs.data());
 
-    // Solve it using GMRES or LU decomposition. The last solution in m_a should
-    // provide a good starting guess, so convergence should be fast.
-    m_a = m_b;
-    solve(m_Lmatrix, m_a.data());
+    // The L01,01 block is diagonal, the L00,01 and L01,00 blocks are zero, and
+    // the L01,10 block is the transpose of the L10,01 block. The internal
+    // energy equations can therefore be solved for the last block of the
+    // solution vector:
+    //
+    //     a_01 = (L01,01)^-1 (b_01 - (L10,01)^T a_10)
+    //
+    // Substituting this into the remaining equations leaves a system of size
+    // 2*m_nsp, where L10,10 is replaced by its Schur complement,
+    // L10,10 - L10,01 (L01,01)^-1 (L10,01)^T, and b_10 is replaced by
+    // b_10 - L10,01 (L01,01)^-1 b_01.
+    size_t nint = m_internal.size();
+    copy(m_b.begin(), m_b.begin() + 2*m_nsp, m_lrhs.begin());
+    if (nint) {
+        for (size_t c = 0; c < nint; c++) {
+            const double* col = m_L1001.ptrColumn(c);
+            double* w = &m_lwork[c*m_nsp];
+            double rd = 1.0 / m_L0101[c];
+            double b01 = m_b[2*m_nsp + m_internal[c]];
+            for (size_t i = 0; i < m_nsp; i++) {
+                w[i] = rd * col[i];
+                m_lrhs[m_nsp + i] -= w[i] * b01;
+            }
+        }
+        ct_dgemm(ctlapack::NoTranspose, ctlapack::Transpose, m_nsp, m_nsp,
+                 nint, -1.0, m_lwork.data(), m_nsp, m_L1001.ptrColumn(0),
+                 m_nsp, 1.0, m_Lmatrix.ptrColumn(m_nsp) + m_nsp, 2*m_nsp);
+    }
+
+    // Solve the reduced system. Each column of the reduced L matrix is
+    // proportional to the mole fraction of the corresponding species, so the
+    // factorization is done for the matrix with these factors divided out,
+    // which changes smoothly with the composition even when the mole
+    // fractions of minor species change by orders of magnitude. The unknowns
+    // of the scaled system are the products of the mole fractions and the
+    // elements of m_a.
+    if (m_lmatrix_reuse && m_lfactor_ok) {
+        // Start from the solution for the previous state, with the same
+        // scaled unknowns
+        for (size_t i = 0; i < 2*m_nsp; i++) {
+            m_a[i] *= m_molefracs_last[i % m_nsp] / m_molefracs[i % m_nsp];
+        }
+    }
+    if (!m_lmatrix_reuse || !m_lfactor_ok || !refineLMatrixSolution()) {
+        m_Lfactor.resize(2*m_nsp, 2*m_nsp);
+        for (size_t j = 0; j < 2*m_nsp; j++) {
+            const double* L = m_Lmatrix.ptrColumn(j);
+            double* F = m_Lfactor.ptrColumn(j);
+            double rx = 1.0 / m_molefracs[j % m_nsp];
+            for (size_t i = 0; i < 2*m_nsp; i++) {
+                F[i] = rx * L[i];
+            }
+        }
+        m_lfactor_ok = false;
+        m_Lfactor.factor();
+        m_lfactor_ok = true;
+        m_nfactor++;
+        copy(m_lrhs.begin(), m_lrhs.end(), m_a.begin());
+        m_Lfactor.solve(m_a.data());
+        for (size_t i = 0; i < 2*m_nsp; i++) {
+            m_a[i] /= m_molefracs[i % m_nsp];
+        }
+    }
+    m_nsolve++;
+
+    // back-substitute for the internal energy terms
+    fill(m_a.begin() + 2*m_nsp, m_a.end(), 0.0);
+    for (size_t c = 0; c < nint; c++) {
+        const double* col = m_L1001.ptrColumn(c);
+        size_t j = m_internal[c];
+        double sum = m_b[2*m_nsp + j];
+        for (size_t i = 0; i < m_nsp; i++) {
+            sum -= col[i] * m_a[m_nsp + i];
+        }
+        m_a[2*m_nsp + j] = sum / m_L0101[c];
+    }
+
     m_lmatrix_soln_ok = true;
     m_molefracs_last = m_molefracs;
-    // L matrix is overwritten with LU decomposition
-    m_l0000_ok = false;
+    m_l0000_ok = true;
+}
+
+bool MultiTransport::refineLMatrixSolution()
+{
+    const int max_iter = 5;
+    size_t n = 2*m_nsp;
+    double dxlast = BigNumber;
+    for (int iter = 0; iter < max_iter; iter++) {
+        // residual of the reduced system with the current L matrix
+        copy(m_lrhs.begin(), m_lrhs.end(), m_lresid.begin());
+        ct_dgemv(ctlapack::ColMajor, ctlapack::NoTranspose, n, n, -1.0,
+                 m_Lmatrix.ptrColumn(0), n, m_a.data(), 1, 1.0,
+                 m_lresid.data(), 1);
+        m_Lfactor.solve(m_lresid.data());
+
+        // The correction is for the scaled unknowns. See
+        // solveLMatrixEquation().
+        double dxmax = 0.0, xmax = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            double x = m_molefracs[i % m_nsp];
+            m_a[i] += m_lresid[i] / x;
+            dxmax = std::max(dxmax, std::abs(m_lresid[i]));
+            xmax = std::max(xmax, std::abs(x * m_a[i]));
+        }
+        if (dxmax <= m_lmatrix_rtol * xmax) {
+            return true;
+        } else if (dxmax > 0.5 * dxlast) {
+            // not converging fast enough to be worthwhile
+            return false;
+        }
+        dxlast = dxmax;
+    }
+    return false;
 }
 
 void MultiTransport::getSpeciesFluxes(size_t ndim, const doublereal* const grad_T,
@@ -499,9 +610,16 @@ void MultiTransport::updateThermal_T()
      */
     vector_fp cp(m_thermo->nSpecies());
     m_thermo->getCp_R_ref(&cp[0]);
+    m_internal.clear();
     for (size_t k = 0; k < m_nsp; k++) {
         m_cinternal[k] = cp[k] - 2.5;
+        if (hasInternalModes(k)) {
+            m_internal.push_back(k);
+        }
     }
+    m_L1001.resize(m_nsp, m_internal.size());
+    m_L0101.resize(m_internal.size());
+    m_lwork.resize(m_nsp * m_internal.size());
     m_thermal_tlast = m_thermo->temperature();
 }
 
@@ -516,22 +634,33 @@ bool MultiTransport::hasInternalModes(size_t j)
 void MultiTransport::eval_L0000(const doublereal* const x)
 {
     doublereal prefactor = 16.0*m_temp/25.0;
-    doublereal sum;
+
+    // The matrices are stored in column-major order, so sum the terms for
+    // each row one column at a time. Subtract-off the k=i term to account
+    // for the first delta function in Eq. (12.121)
+    double* sum = m_lresid.data();
     for (size_t i = 0; i < m_nsp; i++) {
-        // subtract-off the k=i term to account for the first delta
-        // function in Eq. (12.121)
-        sum = -x[i]/m_bdiff(i,i);
-        for (size_t k = 0; k < m_nsp; k++) {
-            sum += x[k]/m_bdiff(i,k);
+        sum[i] = -x[i]/m_bdiff(i,i);
+    }
+    for (size_t k = 0; k < m_nsp; k++) {
+        const double* dk = m_bdiff.ptrColumn(k);
+        for (size_t i = 0; i < m_nsp; i++) {
+            sum[i] += x[k]/dk[i];
         }
+    }
+    for (size_t i = 0; i < m_nsp; i++) {
+        sum[i] /= m_mw[i];
+    }
 
-        sum /= m_mw[i];
-        for (size_t j = 0; j != m_nsp; ++j) {
-            m_Lmatrix(i,j) = prefactor * x[j]
-                             * (m_mw[j] * sum + x[i]/m_bdiff(i,j));
+    for (size_t j = 0; j < m_nsp; j++) {
+        const double* dj = m_bdiff.ptrColumn(j);
+        double* L = m_Lmatrix.ptrColumn(j);
+        double c = prefactor * x[j];
+        for (size_t i = 0; i < m_nsp; i++) {
+            L[i] = c * (m_mw[j] * sum[i] + x[i]/dj[i]);
         }
         // diagonal term is zero
-        m_Lmatrix(i,i) = 0.0;
+        L[j] = 0.0;
     }
 }
 
@@ -543,25 +672,23 @@ void MultiTransport::eval_L0010(const doublereal* const x)
         xj = x[j];
         wj = m_mw[j];
         sum = 0.0;
+        // column j of L00,10 and column j of L10,00, which is row j of L00,10.
+        // m_bdiff and m_cstar are symmetric.
+        double* L0010 = m_Lmatrix.ptrColumn(j + m_nsp);
+        double* L1000 = m_Lmatrix.ptrColumn(j) + m_nsp;
+        const double* dj = m_bdiff.ptrColumn(j);
+        const double* cj = m_cstar.ptrColumn(j);
         for (size_t i = 0; i < m_nsp; i++) {
-            m_Lmatrix(i,j + m_nsp) = - prefactor * x[i] * xj * m_mw[i] *
-                                     (1.2 * m_cstar(j,i) - 1.0) /
-                                     ((wj + m_mw[i]) * m_bdiff(j,i));
+            double c = (1.2 * cj[i] - 1.0) / ((wj + m_mw[i]) * dj[i]);
+            L0010[i] = - prefactor * x[i] * xj * m_mw[i] * c;
+            L1000[i] = - prefactor * xj * x[i] * wj * c;
 
             // the next term is independent of "j";
             // need to do it for the "j,j" term
-            sum -= m_Lmatrix(i,j+m_nsp);
-        }
-        m_Lmatrix(j,j+m_nsp) += sum;
-    }
-}
-
-void MultiTransport::eval_L1000()
-{
-    for (size_t j = 0; j < m_nsp; j++) {
-        for (size_t i = 0; i < m_nsp; i++) {
-            m_Lmatrix(i+m_nsp,j) = m_Lmatrix(j,i+m_nsp);
+            sum -= L0010[i];
         }
+        L0010[j] += sum;
+        L1000[j] = L0010[j];
     }
 }
 
@@ -570,7 +697,7 @@ void MultiTransport::eval_L1010(const doublereal* x)
     const doublereal fiveover3pi = 5.0/(3.0*Pi);
     doublereal prefactor = (16.0*m_temp)/25.0;
     doublereal constant1, wjsq, constant2, constant3, constant4,
-               fourmj, threemjsq, sum, sumwij;;
+               fourmj, threemjsq, sum, sumwij;
     doublereal term1, term2;
 
     for (size_t j = 0; j < m_nsp; j++) {
@@ -583,23 +710,26 @@ void MultiTransport::eval_L1010(const doublereal* x)
         fourmj = 4.0*m_mw[j];
         threemjsq = 3.0*m_mw[j]*m_mw[j];
         sum = 0.0;
+        double* L = m_Lmatrix.ptrColumn(j + m_nsp) + m_nsp;
+        const double* dj = m_bdiff.ptrColumn(j);
+        const double* aj = m_astar.ptrColumn(j);
+        const double* bj = m_bstar.ptrColumn(j);
         for (size_t i = 0; i < m_nsp; i++) {
             sumwij = m_mw[i] + m_mw[j];
-            term1 = m_bdiff(i,j) * sumwij*sumwij;
-            term2 = fourmj*m_astar(i,j)*(1.0 + fiveover3pi*
-                                         (constant3 +
-                                          (m_crot[i]/m_rotrelax[i]))); //  see Eq. (12.125)
+            term1 = dj[i] * sumwij*sumwij;
+            term2 = fourmj*aj[i]*(1.0 + fiveover3pi*
+                                  (constant3 +
+                                   (m_crot[i]/m_rotrelax[i]))); //  see Eq. (12.125)
 
-            m_Lmatrix(i+m_nsp,j+m_nsp) = constant1*x[i]*m_mw[i] /(m_mw[j]*term1) *
-                                         (constant2 - threemjsq*m_bstar(i,j)
-                                          - term2*m_mw[j]);
+            L[i] = constant1*x[i]*m_mw[i] /(m_mw[j]*term1) *
+                   (constant2 - threemjsq*bj[i] - term2*m_mw[j]);
 
             sum += x[i] /(term1) *
                    (constant4 + m_mw[i]*m_mw[i]*
-                    (6.25 - 3.0*m_bstar(i,j)) + term2*m_mw[i]);
+                    (6.25 - 3.0*bj[i]) + term2*m_mw[i]);
         }
 
-        m_Lmatrix(j+m_nsp,j+m_nsp) -= sum*constant1;
+        L[j] -= sum*constant1;
     }
 }
 
@@ -607,56 +737,20 @@ void MultiTransport::eval_L1001(const doublereal* x)
 {
     doublereal prefactor = 32.00*m_temp/(5.00*Pi);
     doublereal constant, sum;
-    size_t n2 = 2*m_nsp;
-    int npoly = 0;
-    for (size_t j = 0; j < m_nsp; j++) {
+    for (size_t c = 0; c < m_internal.size(); c++) {
         // collect terms that depend only on "j"
-        if (hasInternalModes(j)) {
-            constant = prefactor*m_mw[j]*x[j]*m_crot[j]/(m_cinternal[j]*m_rotrelax[j]);
-            sum = 0.0;
-            for (size_t i = 0; i < m_nsp; i++) {
-                // see Eq. (12.127)
-                m_Lmatrix(i+m_nsp,j+n2) = constant * m_astar(j,i) * x[i] /
-                                          ((m_mw[j] + m_mw[i]) * m_bdiff(j,i));
-                sum += m_Lmatrix(i+m_nsp,j+n2);
-            }
-            npoly++;
-            m_Lmatrix(j+m_nsp,j+n2) += sum;
-        } else {
-            for (size_t i = 0; i < m_nsp; i++) {
-                m_Lmatrix(i+m_nsp,j+n2) = 0.0;
-            }
-        }
-    }
-}
-
-void MultiTransport::eval_L0001()
-{
-    size_t n2 = 2*m_nsp;
-    for (size_t j = 0; j < m_nsp; j++) {
-        for (size_t i = 0; i < m_nsp; i++) {
-            m_Lmatrix(i,j+n2) = 0.0;
-        }
-    }
-}
-
-void MultiTransport::eval_L0100()
-{
-    size_t n2 = 2*m_nsp;
-    for (size_t j = 0; j < m_nsp; j++) {
-        for (size_t i = 0; i < m_nsp; i++) {
-            m_Lmatrix(i+n2,j) = 0.0; // see Eq. (12.123)
-        }
-    }
-}
-
-void MultiTransport::eval_L0110()
-{
-    size_t n2 = 2*m_nsp;
-    for (size_t j = 0; j < m_nsp; j++) {
+        size_t j = m_internal[c];
+        constant = prefactor*m_mw[j]*x[j]*m_crot[j]/(m_cinternal[j]*m_rotrelax[j]);
+        sum = 0.0;
+        double* L = m_L1001.ptrColumn(c);
+        const double* dj = m_bdiff.ptrColumn(j);
+        const double* aj = m_astar.ptrColumn(j);
         for (size_t i = 0; i < m_nsp; i++) {
-            m_Lmatrix(i+n2,j+m_nsp) = m_Lmatrix(j+m_nsp,i+n2); // see Eq. (12.123)
+            // see Eq. (12.127)
+            L[i] = constant * aj[i] * x[i] / ((m_mw[j] + m_mw[i]) * dj[i]);
+            sum += L[i];
         }
+        L[j] += sum;
     }
 }
 
@@ -665,33 +759,28 @@ void MultiTransport::eval_L0101(const doublereal* x)
     const doublereal fivepi = 5.00*Pi;
     const doublereal eightoverpi = 8.0 / Pi;
     doublereal prefactor = 4.00*m_temp;
-    size_t n2 = 2*m_nsp;
-    doublereal constant1, constant2, diff_int, sum;
-    for (size_t i = 0; i < m_nsp; i++) {
-        if (hasInternalModes(i)) {
-            // collect terms that depend only on "i"
-            constant1 = prefactor*x[i]/m_cinternal[i];
-            constant2 = 12.00*m_mw[i]*m_crot[i] /
-                        (fivepi*m_cinternal[i]*m_rotrelax[i]);
-            sum = 0.0;
-            for (size_t k = 0; k < m_nsp; k++) {
-                // see Eq. (12.131)
-                diff_int = m_bdiff(i,k);
-                m_Lmatrix(k+n2,i+n2) = 0.0;
-                sum += x[k]/diff_int;
-                if (k != i) sum += x[k]*m_astar(i,k)*constant2 /
-                                       (m_mw[k]*diff_int);
-            }
-            // see Eq. (12.130)
-            m_Lmatrix(i+n2,i+n2) =
-                - eightoverpi*m_mw[i]*x[i]*x[i]*m_crot[i] /
-                (m_cinternal[i]*m_cinternal[i]*GasConstant*m_visc[i]*m_rotrelax[i])
-                - constant1*sum;
-        } else {
-            for (size_t k = 0; k < m_nsp; k++) {
-                m_Lmatrix(i+n2,i+n2) = 1.0;
+    doublereal constant1, constant2, sum;
+    for (size_t c = 0; c < m_internal.size(); c++) {
+        // collect terms that depend only on "i"
+        size_t i = m_internal[c];
+        constant1 = prefactor*x[i]/m_cinternal[i];
+        constant2 = 12.00*m_mw[i]*m_crot[i] /
+                    (fivepi*m_cinternal[i]*m_rotrelax[i]);
+        sum = 0.0;
+        const double* di = m_bdiff.ptrColumn(i);
+        const double* ai = m_astar.ptrColumn(i);
+        for (size_t k = 0; k < m_nsp; k++) {
+            // see Eq. (12.131)
+            sum += x[k]/di[k];
+            if (k != i) {
+                sum += x[k]*ai[k]*constant2 / (m_mw[k]*di[k]);
             }
         }
+        // see Eq. (12.130)
+        m_L0101[c] =
+            - eightoverpi*m_mw[i]*x[i]*x[i]*m_crot[i] /
+            (m_cinternal[i]*m_cinternal[i]*GasConstant*m_visc[i]*m_rotrelax[i])
+            - constant1*sum;
     }
 }
 
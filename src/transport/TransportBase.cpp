@@ -28,7 +28,7 @@ Transport::Transport(const Transport& right)
 
 Transport& Transport::operator=(const Transport& right)
 {
-    if (&right != this) {
+    if (&right == this) {
         return *this;
     }
     m_thermo = right.m_thermo;
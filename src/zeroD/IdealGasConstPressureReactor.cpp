@@ -137,6 +137,81 @@ void IdealGasConstPressureReactor::evalEqs(doublereal time, doublereal* y,
     resetSensitivity(params);
 }
 
+void IdealGasConstPressureReactor::addChemistryJacobian(double* jac,
+                                                        size_t ld,
+                                                        size_t start)
+{
+    if (!m_chem) {
+        return;
+    }
+    evalChemistryDerivatives();
+    m_thermo->getPartialMolarEnthalpies(m_hk.data());
+    const vector_fp& mw = m_thermo->molecularWeights();
+    const vector<size_t>& colStart = m_wdot_ddC.columnStarts();
+    const vector<size_t>& rowIndex = m_wdot_ddC.rowIndices();
+    const vector_fp& values = m_wdot_ddC.values();
+    size_t iT = start + 1; // temperature
+    size_t iY = start + 2; // mass fractions
+    double rho = m_thermo->density();
+    double T = m_thermo->temperature();
+    // s = sum_j Y_j / W_j, so that the density is rho = P / (R T s)
+    double s = 1.0 / m_thermo->meanMolecularWeight();
+
+    // The concentrations are C_j = rho Y_j / W_j, with
+    //     drho/dY_j = -rho / (s W_j) and drho/dT = -rho / T
+    // so for the species equations dY_k/dt = W_k wdot_k / rho:
+    //     d/dY_j = W_k / W_j dwdot_k/dC_j + (dY_k/dt - W_k D_k / rho) / (s W_j)
+    //     d/dT = W_k / rho (dwdot_k/dT - D_k / T) + dY_k/dt / T
+    // where D_k = sum_j C_j dwdot_k/dC_j. The species equations do not depend
+    // on the mass.
+    for (size_t j = 0; j < m_nsp; j++) {
+        for (size_t n = colStart[j]; n < colStart[j+1]; n++) {
+            size_t k = rowIndex[n];
+            jac[iY + k + ld * (iY + j)] += mw[k] / mw[j] * values[n];
+        }
+    }
+    for (size_t k = 0; k < m_nsp; k++) {
+        double f = mw[k] * m_wdot[k] / rho;
+        double g = (f - mw[k] * m_dwdot_dlnc[k] / rho) / s;
+        for (size_t j = 0; j < m_nsp; j++) {
+            jac[iY + k + ld * (iY + j)] += g / mw[j];
+        }
+        jac[iY + k + ld * iT] +=
+            mw[k] / rho * (m_wdot_ddT[k] - m_dwdot_dlnc[k] / T) + f / T;
+    }
+    if (!m_energy) {
+        return;
+    }
+
+    // Energy equation: dT/dt = -1 / (rho c_p) sum_k h_k wdot_k. The
+    // derivative of c_p with respect to temperature is evaluated by a
+    // forward difference.
+    double cp = m_thermo->cp_mass();
+    double dT = 1e-7 * T;
+    m_thermo->setTemperature(T + dT);
+    double dcpdT = (m_thermo->cp_mass() - cp) / dT;
+    m_thermo->restoreState(m_state);
+
+    double a = 1.0 / (rho * cp);
+    double S = 0.0, SD = 0.0, ST = 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        S += m_hk[k] * m_wdot[k];
+        SD += m_hk[k] * m_dwdot_dlnc[k];
+        ST += m_cpk[k] * m_wdot[k]
+              + m_hk[k] * (m_wdot_ddT[k] - m_dwdot_dlnc[k] / T);
+    }
+    double fT = - a * S;
+    for (size_t j = 0; j < m_nsp; j++) {
+        double sum = 0.0;
+        for (size_t n = colStart[j]; n < colStart[j+1]; n++) {
+            sum += m_hk[rowIndex[n]] * values[n];
+        }
+        jac[iT + ld * (iY + j)] += (- sum / cp + (a * SD + fT) / s
+                                    - fT * m_cpk[j] / cp) / mw[j];
+    }
+    jac[iT + ld * iT] -= a * ST + fT * (dcpdT / cp - 1.0 / T);
+}
+
 size_t IdealGasConstPressureReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
@@ -145,6 +145,77 @@ void IdealGasReactor::evalEqs(doublereal time, doublereal* y,
     resetSensitivity(params);
 }
 
+void IdealGasReactor::addChemistryJacobian(double* jac, size_t ld,
+                                           size_t start)
+{
+    if (!m_chem) {
+        return;
+    }
+    evalChemistryDerivatives();
+    m_thermo->getPartialMolarIntEnergies(m_uk.data());
+    const vector_fp& mw = m_thermo->molecularWeights();
+    const vector<size_t>& colStart = m_wdot_ddC.columnStarts();
+    const vector<size_t>& rowIndex = m_wdot_ddC.rowIndices();
+    const vector_fp& values = m_wdot_ddC.values();
+    size_t im = start; // mass
+    size_t iV = start + 1; // volume
+    size_t iT = start + 2; // temperature
+    size_t iY = start + 3; // mass fractions
+
+    // The concentrations are C_j = m Y_j / (V W_j), so for the species
+    // equations dY_k/dt = V W_k wdot_k / m:
+    //     d/dY_j = W_k / W_j dwdot_k/dC_j
+    //     d/dm = (-dY_k/dt + V W_k D_k / m) / m
+    //     d/dV = dY_k/dt / V - W_k D_k / m
+    // where D_k = sum_j C_j dwdot_k/dC_j.
+    for (size_t j = 0; j < m_nsp; j++) {
+        for (size_t n = colStart[j]; n < colStart[j+1]; n++) {
+            size_t k = rowIndex[n];
+            jac[iY + k + ld * (iY + j)] += mw[k] / mw[j] * values[n];
+        }
+    }
+    for (size_t k = 0; k < m_nsp; k++) {
+        double f = m_vol * mw[k] * m_wdot[k] / m_mass;
+        double fD = mw[k] * m_dwdot_dlnc[k] / m_mass;
+        jac[iY + k + ld * iT] += m_vol * mw[k] * m_wdot_ddT[k] / m_mass;
+        jac[iY + k + ld * im] += (m_vol * fD - f) / m_mass;
+        jac[iY + k + ld * iV] += f / m_vol - fD;
+    }
+    if (!m_energy) {
+        return;
+    }
+
+    // Energy equation: dT/dt = -V / (m c_v) sum_k u_k wdot_k. The
+    // derivative of c_v with respect to temperature is evaluated by a
+    // forward difference.
+    double cv = m_thermo->cv_mass();
+    double T = m_thermo->temperature();
+    double dT = 1e-7 * T;
+    m_thermo->setTemperature(T + dT);
+    double dcvdT = (m_thermo->cv_mass() - cv) / dT;
+    m_thermo->restoreState(m_state);
+
+    double a = m_vol / (m_mass * cv);
+    double S = 0.0, SD = 0.0, ST = 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        S += m_uk[k] * m_wdot[k];
+        SD += m_uk[k] * m_dwdot_dlnc[k];
+        ST += (m_cpk[k] - GasConstant) * m_wdot[k] + m_uk[k] * m_wdot_ddT[k];
+    }
+    double fT = - a * S;
+    for (size_t j = 0; j < m_nsp; j++) {
+        double sum = 0.0;
+        for (size_t n = colStart[j]; n < colStart[j+1]; n++) {
+            sum += m_uk[rowIndex[n]] * values[n];
+        }
+        jac[iT + ld * (iY + j)] -=
+            (sum + fT * (m_cpk[j] - GasConstant)) / (cv * mw[j]);
+    }
+    jac[iT + ld * iT] -= a * ST + fT * dcvdT / cv;
+    jac[iT + ld * im] -= (fT + a * SD) / m_mass;
+    jac[iT + ld * iV] += fT / m_vol + SD / (m_mass * cv);
+}
+
 size_t IdealGasReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
@@ -6,6 +6,7 @@
 #include "cantera/zeroD/FlowDevice.h"
 #include "cantera/zeroD/Wall.h"
 #include "cantera/thermo/SurfPhase.h"
+#include "cantera/thermo/GeneralSpeciesThermo.h"
 #include "cantera/zeroD/ReactorNet.h"
 
 #include <cfloat>
@@ -19,6 +20,7 @@ Reactor::Reactor() :
     m_vdot(0.0),
     m_Q(0.0),
     m_mass(0.0),
+    m_nasaThermo(0),
     m_chem(false),
     m_energy(true),
     m_nv(0),
@@ -108,6 +110,48 @@ void Reactor::initialize(doublereal t0)
     }
     m_work.resize(maxnt);
     std::sort(m_pnum.begin(), m_pnum.end());
+    setupIdealGasTemperature();
+}
+
+void Reactor::setupIdealGasTemperature()
+{
+    m_nasaThermo = 0;
+    m_nasaSpecies.clear();
+    m_nasaIndex.clear();
+    m_nasaTmid.clear();
+    m_nasaStart.clear();
+    if (m_thermo->eosType() != cIdealGas) {
+        return;
+    }
+    // The coefficients are read from the species thermo manager when they
+    // are used, so that changes such as modifyOneHf298() are picked up
+    auto spthermo = dynamic_cast<const GeneralSpeciesThermo*>(
+        &m_thermo->speciesThermo());
+    if (!spthermo) {
+        return;
+    }
+    const vector_fp& tmid = spthermo->nasaCoeffs()[0];
+    std::vector<std::pair<double, size_t> > order;
+    for (size_t k = 0; k < m_nsp; k++) {
+        size_t n = spthermo->nasaIndex(k);
+        if (n == npos) {
+            return;
+        }
+        order.emplace_back(tmid[n], k);
+    }
+    std::stable_sort(order.begin(), order.end());
+    for (size_t i = 0; i < m_nsp; i++) {
+        size_t k = order[i].second;
+        if (m_nasaTmid.empty() || order[i].first != m_nasaTmid.back()) {
+            m_nasaTmid.push_back(order[i].first);
+            m_nasaStart.push_back(i);
+        }
+        m_nasaSpecies.push_back(k);
+        m_nasaIndex.push_back(spthermo->nasaIndex(k));
+    }
+    m_nasaStart.push_back(m_nsp);
+    m_nasaMix.resize(12 * m_nasaTmid.size());
+    m_nasaThermo = spthermo;
 }
 
 size_t Reactor::nSensParams()
@@ -140,7 +184,10 @@ void Reactor::updateState(doublereal* y)
     m_vol = y[1];
     m_thermo->setMassFractions_NoNorm(y+3);
 
-    if (m_energy) {
+    if (m_energy && m_nasaThermo) {
+        m_thermo->setState_TR(idealGasTemperature(y[2] / m_mass),
+                              m_mass / m_vol);
+    } else if (m_energy) {
         // Use a damped Newton's method to determine the mixture temperature.
         // Tight tolerances are required both for Jacobian evaluation and for
         // sensitivity analysis to work correctly.
@@ -186,6 +233,73 @@ void Reactor::updateState(doublereal* y)
     m_thermo->saveState(m_state);
 }
 
+double Reactor::idealGasTemperature(double u)
+{
+    // For an ideal gas, u/R = T * sum_k (Y_k/M_k) * (h_k/RT - 1) and
+    // cv/R = sum_k (Y_k/M_k) * (cp_k/R - 1). Sum the coefficients of the
+    // polynomials for cp/R (a0...a4) and h/RT (a0...a5) over the species
+    // sharing each midpoint temperature.
+    const double* ym = m_thermo->moleFractdivMMW();
+    const std::vector<vector_fp>& c = m_nasaThermo->nasaCoeffs();
+    size_t ng = m_nasaTmid.size();
+    double sum_ym = 0.0;
+    for (size_t g = 0; g < ng; g++) {
+        // high temperature coefficients, then low temperature coefficients
+        double a[12] = {0.0};
+        for (size_t i = m_nasaStart[g]; i < m_nasaStart[g+1]; i++) {
+            double y = ym[m_nasaSpecies[i]];
+            size_t n = m_nasaIndex[i];
+            for (size_t j = 0; j < 6; j++) {
+                a[j] += y * c[1+j][n];
+                a[6+j] += y * c[8+j][n];
+            }
+            sum_ym += y;
+        }
+        std::copy(a, a + 12, &m_nasaMix[12*g]);
+    }
+
+    // Use a damped Newton's method to determine the mixture temperature,
+    // starting from the last temperature of the reactor
+    double T = temperature();
+    double dT = 100;
+    double dUprev = 1e10;
+    double dU = 1e10;
+    int i = 0;
+    double damp = 1.0;
+    while (abs(dT / T) > 10 * DBL_EPSILON) {
+        dUprev = dU;
+        double u_RT = -sum_ym;
+        double cv_R = -sum_ym;
+        for (size_t g = 0; g < ng; g++) {
+            const double* a = &m_nasaMix[12*g + ((T <= m_nasaTmid[g]) ? 6 : 0)];
+            double ct1 = a[1]*T;
+            double ct2 = a[2]*T*T;
+            double ct3 = a[3]*T*T*T;
+            double ct4 = a[4]*T*T*T*T;
+            cv_R += a[0] + ct1 + ct2 + ct3 + ct4;
+            u_RT += a[0] + 0.5*ct1 + 1.0/3.0*ct2 + 0.25*ct3 + 0.2*ct4 + a[5]/T;
+        }
+        dU = GasConstant * T * u_RT - u;
+        dT = dU / (GasConstant * cv_R);
+        // Reduce the damping coefficient if the magnitude of the error
+        // isn't decreasing
+        if (std::abs(dU) < std::abs(dUprev)) {
+            damp = 1.0;
+        } else {
+            damp *= 0.8;
+        }
+        dT = std::min(dT, 0.5 * T) * damp;
+        T -= dT;
+        i++;
+        if (i > 100) {
+            throw CanteraError("Reactor::updateState",
+                "no convergence\nU/m = {}\nT = {}\nrho = {}\n",
+                u, T, m_mass / m_vol);
+        }
+    }
+    return T;
+}
+
 void Reactor::updateSurfaceState(double* y)
 {
     size_t loc = 0;
@@ -393,6 +507,68 @@ size_t Reactor::componentIndex(const string& nm) const
     }
 }
 
+void Reactor::getJacobianPattern(vector<pair<size_t, size_t> >& pattern,
+                                 size_t start)
+{
+    if (!m_chem) {
+        return;
+    }
+    m_thermo->restoreState(m_state);
+    m_kin->getNetProductionRates_ddC(m_wdot_ddC);
+    size_t offset = start + componentIndex(m_thermo->speciesName(0));
+    const vector<size_t>& colStart = m_wdot_ddC.columnStarts();
+    const vector<size_t>& rowIndex = m_wdot_ddC.rowIndices();
+    for (size_t j = 0; j < m_nsp; j++) {
+        for (size_t n = colStart[j]; n < colStart[j+1]; n++) {
+            pattern.emplace_back(offset + rowIndex[n], offset + j);
+        }
+    }
+}
+
+void Reactor::evalJacobianElements(SparseMatrix& jac, size_t start)
+{
+    if (!m_chem) {
+        return;
+    }
+    m_thermo->restoreState(m_state);
+    m_kin->getNetProductionRates_ddC(m_wdot_ddC);
+    size_t offset = start + componentIndex(m_thermo->speciesName(0));
+    const vector_fp& mw = m_thermo->molecularWeights();
+    const vector<size_t>& colStart = m_wdot_ddC.columnStarts();
+    const vector<size_t>& rowIndex = m_wdot_ddC.rowIndices();
+    const vector_fp& values = m_wdot_ddC.values();
+    // dY_k/dt = wdot_k * W_k / rho and C_j = rho * Y_j / W_j, so
+    // d(dY_k/dt)/dY_j = W_k / W_j * dwdot_k/dC_j
+    for (size_t j = 0; j < m_nsp; j++) {
+        for (size_t n = colStart[j]; n < colStart[j+1]; n++) {
+            size_t k = rowIndex[n];
+            jac(offset + k, offset + j) += mw[k] / mw[j] * values[n];
+        }
+    }
+}
+
+void Reactor::evalChemistryDerivatives()
+{
+    m_thermo->restoreState(m_state);
+    m_kin->getNetProductionRates(m_wdot.data());
+    m_kin->getNetProductionRates_ddC(m_wdot_ddC);
+    m_wdot_ddT.resize(m_nsp);
+    m_kin->getNetProductionRates_ddT(m_wdot_ddT.data());
+    m_conc.resize(m_nsp);
+    m_thermo->getConcentrations(m_conc.data());
+    m_cpk.resize(m_nsp);
+    m_thermo->getPartialMolarCp(m_cpk.data());
+    m_dwdot_dlnc.assign(m_nsp, 0.0);
+    const vector<size_t>& colStart = m_wdot_ddC.columnStarts();
+    const vector<size_t>& rowIndex = m_wdot_ddC.rowIndices();
+    const vector_fp& values = m_wdot_ddC.values();
+    for (size_t j = 0; j < m_nsp; j++) {
+        for (size_t n = colStart[j]; n < colStart[j+1]; n++) {
+            m_dwdot_dlnc[rowIndex[n]] += values[n] * m_conc[j];
+        }
+    }
+}
+
 void Reactor::applySensitivity(double* params)
 {
     if (!params) {
@@ -0,0 +1,330 @@
+//! @file ReactorISAT.cpp
+#include "cantera/zeroD/ReactorISAT.h"
+
+using namespace std;
+
+namespace Cantera
+{
+
+ReactorISAT::ReactorISAT(ThermoPhase& thermo, Kinetics& kin) :
+    m_thermo(thermo),
+    m_nv(thermo.nSpecies() + 1),
+    m_dt(0.0),
+    m_pressure(0.0),
+    m_Tscale(1000.0),
+    m_tol(1.0e-4),
+    m_maxRadius(0.01),
+    m_memoryLimit(100 << 20),
+    m_root(-1),
+    m_nRecords(0),
+    m_nRetrieved(0),
+    m_nGrown(0),
+    m_nAdded(0),
+    m_nEvicted(0)
+{
+    if (kin.nPhases() != 1 || &kin.thermo(0) != &thermo) {
+        throw CanteraError("ReactorISAT::ReactorISAT", "Kinetics manager "
+            "must be defined for the single phase '{}'", thermo.id());
+    }
+    m_reactor.setThermoMgr(thermo);
+    m_reactor.setKineticsMgr(kin);
+    m_net.addReactor(m_reactor);
+    m_z.resize(m_nv);
+    m_zout.resize(m_nv);
+    m_work.resize(m_nv);
+}
+
+void ReactorISAT::setTimeStep(double dt)
+{
+    if (dt != m_dt) {
+        clear();
+        m_dt = dt;
+    }
+}
+
+void ReactorISAT::setTemperatureScale(double Tscale)
+{
+    clear();
+    m_Tscale = Tscale;
+}
+
+void ReactorISAT::advance()
+{
+    if (m_dt <= 0.0) {
+        throw CanteraError("ReactorISAT::advance",
+                           "Time step must be positive.");
+    }
+    // Allow for round-off error in the pressure computed from the density
+    double P = m_thermo.pressure();
+    if (std::abs(P - m_pressure) > 1e-10 * P) {
+        clear();
+        m_pressure = P;
+    }
+    size_t n = m_nv;
+    double* z = m_z.data();
+    double* zout = m_zout.data();
+    double* dz = m_work.data();
+    z[0] = m_thermo.temperature() / m_Tscale;
+    m_thermo.getMassFractions(z + 1);
+
+    size_t r = npos;
+    if (m_nRecords) {
+        r = findLeaf(z);
+        Record& rec = m_records[r];
+        for (size_t j = 0; j < n; j++) {
+            dz[j] = z[j] - rec.z0[j];
+        }
+        double g2 = 0.0;
+        for (size_t j = 0; j < n; j++) {
+            double Mdz = 0.0;
+            for (size_t i = 0; i < n; i++) {
+                Mdz += rec.M[i + n*j] * dz[i];
+            }
+            g2 += Mdz * dz[j];
+        }
+        if (g2 <= 1.0) {
+            // Retrieve the linear approximation
+            for (size_t i = 0; i < n; i++) {
+                zout[i] = rec.z1[i];
+            }
+            for (size_t j = 0; j < n; j++) {
+                for (size_t i = 0; i < n; i++) {
+                    zout[i] += rec.A[i + n*j] * dz[j];
+                }
+            }
+            m_thermo.setState_TPY(zout[0] * m_Tscale, m_pressure, zout + 1);
+            m_nRetrieved++;
+            touch(r);
+            return;
+        }
+    }
+
+    integrate(z, zout);
+
+    if (r != npos) {
+        // Check the error of the linear approximation
+        Record& rec = m_records[r];
+        double err2 = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            double e = zout[i] - rec.z1[i];
+            for (size_t j = 0; j < n; j++) {
+                e -= rec.A[i + n*j] * dz[j];
+            }
+            err2 += e * e;
+        }
+        if (err2 <= m_tol * m_tol) {
+            // Grow the EOA to the minimum volume ellipsoid which contains the
+            // current EOA and the query point:
+            //     M' = M + (1/g^2 - 1) / g^2 (M dz) (M dz)^T
+            // where g^2 = dz^T M dz.
+            vector_fp Mdz(n, 0.0);
+            double g2 = 0.0;
+            for (size_t j = 0; j < n; j++) {
+                for (size_t i = 0; i < n; i++) {
+                    Mdz[i] += rec.M[i + n*j] * dz[j];
+                }
+            }
+            for (size_t i = 0; i < n; i++) {
+                g2 += Mdz[i] * dz[i];
+            }
+            double c = (1.0 / g2 - 1.0) / g2;
+            for (size_t j = 0; j < n; j++) {
+                for (size_t i = 0; i < n; i++) {
+                    rec.M[i + n*j] += c * Mdz[i] * Mdz[j];
+                }
+            }
+            m_nGrown++;
+            touch(r);
+            m_thermo.setState_TPY(zout[0] * m_Tscale, m_pressure, zout + 1);
+            return;
+        }
+    }
+
+    addRecord(z, zout);
+    m_nAdded++;
+    m_thermo.setState_TPY(zout[0] * m_Tscale, m_pressure, zout + 1);
+}
+
+void ReactorISAT::clear()
+{
+    m_records.clear();
+    m_nodes.clear();
+    m_freeRecords.clear();
+    m_freeNodes.clear();
+    m_lru.clear();
+    m_root = -1;
+    m_nRecords = 0;
+}
+
+void ReactorISAT::integrate(const double* z0, double* z)
+{
+    m_thermo.setMassFractions_NoNorm(z0 + 1);
+    m_thermo.setState_TP(z0[0] * m_Tscale, m_pressure);
+    m_reactor.syncState();
+    m_net.setInitialTime(0.0);
+    m_net.advance(m_dt);
+    z[0] = m_thermo.temperature() / m_Tscale;
+    m_thermo.getMassFractions(z + 1);
+}
+
+void ReactorISAT::mappingGradient(const double* z0, const double* z1,
+                                  double* A)
+{
+    size_t n = m_nv;
+    vector_fp zp(z0, z0 + n), zq(n);
+    for (size_t j = 0; j < n; j++) {
+        // Forward differences, so that the perturbed mass fractions are
+        // never negative
+        double h = 1.0e-6 * std::max(std::abs(z0[j]), 1.0);
+        zp[j] = z0[j] + h;
+        integrate(zp.data(), zq.data());
+        for (size_t i = 0; i < n; i++) {
+            A[i + n*j] = (zq[i] - z1[i]) / h;
+        }
+        zp[j] = z0[j];
+    }
+}
+
+size_t ReactorISAT::findLeaf(const double* z) const
+{
+    int c = m_root;
+    while (c >= 0) {
+        const Node& node = m_nodes[c];
+        double vz = 0.0;
+        for (size_t i = 0; i < m_nv; i++) {
+            vz += node.v[i] * z[i];
+        }
+        c = (vz > node.a) ? node.right : node.left;
+    }
+    return -1 - c;
+}
+
+void ReactorISAT::addRecord(const double* z0, const double* z1)
+{
+    size_t n = m_nv;
+    size_t maxRecords = std::max<size_t>(m_memoryLimit / recordSize(), 1);
+    while (m_nRecords >= maxRecords) {
+        evict();
+    }
+
+    size_t r;
+    if (m_freeRecords.empty()) {
+        r = m_records.size();
+        m_records.emplace_back();
+    } else {
+        r = m_freeRecords.back();
+        m_freeRecords.pop_back();
+    }
+    Record& rec = m_records[r];
+    rec.z0.assign(z0, z0 + n);
+    rec.z1.assign(z1, z1 + n);
+    rec.A.resize(n * n);
+    mappingGradient(z0, z1, rec.A.data());
+
+    // Initial EOA: the region where the change in the mapping is less than
+    // the tolerance, M = A^T A / tol^2, with the semi-axes limited to
+    // m_maxRadius.
+    rec.M.assign(n * n, 0.0);
+    double rtol2 = 1.0 / (m_tol * m_tol);
+    for (size_t j = 0; j < n; j++) {
+        for (size_t i = 0; i <= j; i++) {
+            double sum = 0.0;
+            for (size_t k = 0; k < n; k++) {
+                sum += rec.A[k + n*i] * rec.A[k + n*j];
+            }
+            rec.M[i + n*j] = rec.M[j + n*i] = sum * rtol2;
+        }
+        rec.M[j + n*j] += 1.0 / (m_maxRadius * m_maxRadius);
+    }
+
+    m_lru.push_front(r);
+    rec.lru = m_lru.begin();
+    int leaf = -1 - static_cast<int>(r);
+    if (m_nRecords == 0) {
+        rec.parent = -1;
+        m_root = leaf;
+    } else {
+        // Split the closest leaf with the plane bisecting the two records
+        size_t s = findLeaf(z0);
+        Record& sib = m_records[s];
+        size_t k;
+        if (m_freeNodes.empty()) {
+            k = m_nodes.size();
+            m_nodes.emplace_back();
+        } else {
+            k = m_freeNodes.back();
+            m_freeNodes.pop_back();
+        }
+        Node& node = m_nodes[k];
+        node.v.resize(n);
+        node.a = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            node.v[i] = z0[i] - sib.z0[i];
+            node.a += 0.5 * node.v[i] * (z0[i] + sib.z0[i]);
+        }
+        int sibLeaf = -1 - static_cast<int>(s);
+        node.parent = sib.parent;
+        replaceChild(sib.parent, sibLeaf, static_cast<int>(k));
+        node.left = sibLeaf;
+        node.right = leaf;
+        sib.parent = static_cast<int>(k);
+        rec.parent = static_cast<int>(k);
+    }
+    m_nRecords++;
+}
+
+void ReactorISAT::evict()
+{
+    size_t r = m_lru.back();
+    m_lru.pop_back();
+    Record& rec = m_records[r];
+    int leaf = -1 - static_cast<int>(r);
+    if (rec.parent < 0) {
+        m_root = -1;
+    } else {
+        // Replace the parent node with the sibling of the record
+        int p = rec.parent;
+        Node& node = m_nodes[p];
+        int sibling = (node.left == leaf) ? node.right : node.left;
+        replaceChild(node.parent, p, sibling);
+        node.v.clear();
+        m_freeNodes.push_back(p);
+    }
+    rec.z0.clear();
+    rec.z1.clear();
+    rec.A.clear();
+    rec.M.clear();
+    m_freeRecords.push_back(r);
+    m_nRecords--;
+    m_nEvicted++;
+}
+
+void ReactorISAT::replaceChild(int parent, int oldChild, int newChild)
+{
+    if (parent < 0) {
+        m_root = newChild;
+    } else if (m_nodes[parent].left == oldChild) {
+        m_nodes[parent].left = newChild;
+    } else {
+        m_nodes[parent].right = newChild;
+    }
+    if (newChild >= 0) {
+        m_nodes[newChild].parent = parent;
+    } else {
+        m_records[-1 - newChild].parent = parent;
+    }
+}
+
+void ReactorISAT::touch(size_t r)
+{
+    m_lru.splice(m_lru.begin(), m_lru, m_records[r].lru);
+}
+
+size_t ReactorISAT::recordSize() const
+{
+    // compositions, gradient and EOA of the record, and one tree node
+    return sizeof(Record) + sizeof(Node)
+           + sizeof(double) * (2 * m_nv * m_nv + 3 * m_nv);
+}
+
+}
@@ -2,7 +2,9 @@
 #include "cantera/zeroD/ReactorNet.h"
 #include "cantera/zeroD/FlowDevice.h"
 #include "cantera/zeroD/Wall.h"
+#include "cantera/numerics/SparseLU.h"
 
+#include <cfloat>
 #include <cstdio>
 
 using namespace std;
@@ -15,7 +17,7 @@ ReactorNet::ReactorNet() :
     m_nv(0), m_rtol(1.0e-9), m_rtolsens(1.0e-4),
     m_atols(1.0e-15), m_atolsens(1.0e-4),
     m_maxstep(0.0), m_maxErrTestFails(0),
-    m_verbose(false), m_ntotpar(0)
+    m_verbose(false), m_ntotpar(0), m_linearSolverType("DENSE")
 {
     m_integ = newIntegrator("CVODE");
 
@@ -73,9 +75,27 @@ void ReactorNet::initialize()
     m_integ->setSensitivityTolerances(m_rtolsens, m_atolsens);
     m_integ->setMaxStepSize(m_maxstep);
     m_integ->setMaxErrTestFails(m_maxErrTestFails);
+    if (m_linearSolverType == "GMRES") {
+        m_integ->setProblemType(GMRES + PRECON);
+        if (!m_precon) {
+            m_precon.reset(new SparseLUPreconditioner());
+        }
+        vector<pair<size_t, size_t> > pattern;
+        for (n = 0; n < m_reactors.size(); n++) {
+            m_reactors[n]->getJacobianPattern(pattern, m_start[n]);
+        }
+        m_jac.resize(m_nv, m_nv);
+        m_jac.setPattern(pattern);
+    } else if (m_linearSolverType == "DENSE_ANALYTIC") {
+        m_integ->setProblemType(DENSE + JAC);
+        m_ydot_nochem.resize(m_nv);
+    } else {
+        m_integ->setProblemType(DENSE + NOJAC);
+    }
     if (m_verbose) {
         writelog("Number of equations: {:d}\n", neq());
         writelog("Maximum time step:   {:14.6g}\n", m_maxstep);
+        writelog("Linear solver:       {}\n", m_linearSolverType);
     }
     m_integ->initialize(m_time, *this);
     m_integrator_init = true;
@@ -167,6 +187,80 @@ void ReactorNet::evalJacobian(doublereal t, doublereal* y,
     }
 }
 
+void ReactorNet::evalJacobian(double t, double* y, double* ydot, double* p,
+                              double* jac)
+{
+    // Disable the homogeneous chemistry in the reactors which provide the
+    // derivatives of the reaction terms
+    vector<size_t> analytic;
+    for (size_t n = 0; n < m_reactors.size(); n++) {
+        if (m_reactors[n]->chemistryEnabled() &&
+            m_reactors[n]->hasChemistryJacobian()) {
+            m_reactors[n]->disableChemistry();
+            analytic.push_back(n);
+        }
+    }
+
+    // Finite difference Jacobian of the remaining terms
+    m_ydot_nochem.resize(m_nv);
+    double* f0 = m_ydot_nochem.data();
+    try {
+        eval(t, y, f0, p);
+        for (size_t n = 0; n < m_nv; n++) {
+            double ysave = y[n];
+            double dy = std::sqrt(DBL_EPSILON) * std::max(std::abs(ysave), 1.0);
+            y[n] = ysave + dy;
+            dy = y[n] - ysave;
+            eval(t, y, m_ydot.data(), p);
+            double* col = jac + m_nv * n;
+            for (size_t m = 0; m < m_nv; m++) {
+                col[m] = (m_ydot[m] - f0[m]) / dy;
+            }
+            y[n] = ysave;
+        }
+    } catch (...) {
+        for (size_t n : analytic) {
+            m_reactors[n]->enableChemistry();
+        }
+        throw;
+    }
+
+    // Reaction terms
+    updateState(y);
+    for (size_t n : analytic) {
+        m_reactors[n]->enableChemistry();
+        m_reactors[n]->addChemistryJacobian(jac, m_nv, m_start[n]);
+    }
+}
+
+void ReactorNet::setLinearSolverType(const std::string& type)
+{
+    if (type != "DENSE" && type != "GMRES" && type != "DENSE_ANALYTIC") {
+        throw CanteraError("ReactorNet::setLinearSolverType",
+                           "Unknown linear solver type '{}'", type);
+    }
+    m_linearSolverType = type;
+    m_init = false;
+}
+
+void ReactorNet::preconditionerSetup(double t, double* y, double gamma,
+                                     bool reuseJacobian)
+{
+    if (!reuseJacobian) {
+        updateState(y);
+        m_jac.zero();
+        for (size_t n = 0; n < m_reactors.size(); n++) {
+            m_reactors[n]->evalJacobianElements(m_jac, m_start[n]);
+        }
+    }
+    m_precon->setup(m_jac, gamma);
+}
+
+void ReactorNet::preconditionerSolve(const double* rhs, double* x)
+{
+    m_precon->solve(rhs, x);
+}
+
 void ReactorNet::updateState(doublereal* y)
 {
     checkFinite("y", y, m_nv);
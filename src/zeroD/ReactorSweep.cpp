@@ -0,0 +1,120 @@
+//! @file ReactorSweep.cpp
+#include "cantera/zeroD/ReactorSweep.h"
+#include "cantera/zeroD/ReactorNet.h"
+#include "cantera/zeroD/ReactorFactory.h"
+
+using namespace std;
+
+namespace Cantera
+{
+
+ReactorSweep::ReactorSweep(ThermoPhase& thermo, Kinetics& kin) :
+    m_thermo(thermo),
+    m_kin(kin),
+    m_nsp(thermo.nSpecies()),
+    m_reactorType("IdealGasReactor"),
+    m_rtol(1.0e-9),
+    m_atol(1.0e-15),
+    m_nThreads(0)
+{
+    if (kin.nPhases() != 1 || &kin.thermo(0) != &thermo) {
+        throw CanteraError("ReactorSweep::ReactorSweep", "Kinetics manager "
+            "must be defined for the single phase '{}'", thermo.id());
+    }
+}
+
+size_t ReactorSweep::addCase(double T, double P, const double* Y, double tEnd)
+{
+    m_T0.push_back(T);
+    m_P0.push_back(P);
+    m_Y0.insert(m_Y0.end(), Y, Y + m_nsp);
+    m_tEnd.push_back(tEnd);
+    return nCases() - 1;
+}
+
+void ReactorSweep::clear()
+{
+    m_T0.clear();
+    m_P0.clear();
+    m_Y0.clear();
+    m_tEnd.clear();
+    m_T.clear();
+    m_P.clear();
+    m_Y.clear();
+}
+
+void ReactorSweep::run()
+{
+    if (!m_pool) {
+        m_pool.reset(new ThreadPool(m_nThreads));
+    }
+    // Copies of the phase and kinetics objects are made on this thread, since
+    // the prototype objects are not safe to access from several threads.
+    m_workers.resize(m_pool->nThreads());
+    for (auto& w : m_workers) {
+        if (!w.thermo) {
+            w.thermo.reset(m_thermo.duplMyselfAsThermoPhase());
+            w.kin.reset(m_kin.duplMyselfAsKinetics({w.thermo.get()}));
+        }
+    }
+
+    size_t n = nCases();
+    double nan = std::numeric_limits<double>::quiet_NaN();
+    m_T.assign(n, nan);
+    m_P.assign(n, nan);
+    m_Y.assign(n * m_nsp, nan);
+    m_pool->run(n, [this](size_t i, size_t w) { integrate(i, w); });
+}
+
+void ReactorSweep::integrate(size_t i, size_t w)
+{
+    ThermoPhase& thermo = *m_workers[w].thermo;
+    thermo.setState_TPY(m_T0[i], m_P0[i], &m_Y0[i*m_nsp]);
+
+    unique_ptr<ReactorBase> rb(newReactor(m_reactorType));
+    Reactor* r = dynamic_cast<Reactor*>(rb.get());
+    if (!r) {
+        throw CanteraError("ReactorSweep::integrate", "Reactor type '{}' "
+            "cannot be used with a Kinetics manager", m_reactorType);
+    }
+    r->setThermoMgr(thermo);
+    r->setKineticsMgr(*m_workers[w].kin);
+
+    ReactorNet net;
+    net.addReactor(*r);
+    net.setTolerances(m_rtol, m_atol);
+    net.advance(m_tEnd[i]);
+
+    m_T[i] = thermo.temperature();
+    m_P[i] = thermo.pressure();
+    thermo.getMassFractions(&m_Y[i*m_nsp]);
+}
+
+double ReactorSweep::temperature(size_t i) const
+{
+    if (i >= m_T.size()) {
+        throw IndexError("ReactorSweep::temperature", "results", i,
+                         m_T.size()-1);
+    }
+    return m_T[i];
+}
+
+double ReactorSweep::pressure(size_t i) const
+{
+    if (i >= m_P.size()) {
+        throw IndexError("ReactorSweep::pressure", "results", i,
+                         m_P.size()-1);
+    }
+    return m_P[i];
+}
+
+void ReactorSweep::getMassFractions(size_t i, double* Y) const
+{
+    if (i >= m_T.size()) {
+        throw IndexError("ReactorSweep::getMassFractions", "results", i,
+                         m_T.size()-1);
+    }
+    copy(m_Y.begin() + i*m_nsp, m_Y.begin() + (i+1)*m_nsp, Y);
+}
+
+}
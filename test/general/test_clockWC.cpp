@@ -0,0 +1,47 @@
+#include "gtest/gtest.h"
+#include "cantera/base/clockWC.h"
+#include <thread>
+
+namespace Cantera
+{
+
+TEST(clockWC, counts_sleeping_time)
+{
+    // The process CPU time would not include the time spent sleeping
+    clockWC timer;
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    double t = timer.secondsWC();
+    EXPECT_GE(t, 0.045);
+    EXPECT_LT(t, 0.5);
+}
+
+TEST(clockWC, threads_not_added)
+{
+    // The process CPU time would add up the time used by each thread
+    clockWC timer;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 4; i++) {
+        threads.emplace_back([]() {
+            clockWC busy;
+            while (busy.secondsWC() < 0.05) {
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    double t = timer.secondsWC();
+    EXPECT_GE(t, 0.045);
+    EXPECT_LT(t, 0.19);
+}
+
+TEST(clockWC, start)
+{
+    clockWC timer;
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_GE(timer.secondsWC(), 0.015);
+    EXPECT_EQ(timer.start(), 0.0);
+    EXPECT_LT(timer.secondsWC(), 0.015);
+}
+
+}
@@ -0,0 +1,162 @@
+#include "gtest/gtest.h"
+#include "cantera/base/ctml.h"
+#include "cantera/base/stringUtils.h"
+#include <fstream>
+
+namespace Cantera
+{
+
+//! Compare two CTML trees, ignoring comments, the formatting of numbers and
+//! whitespace in the node values.
+void compareTrees(const XML_Node& a, const XML_Node& b)
+{
+    ASSERT_EQ(a.name(), b.name());
+    std::string path = a.name() + " " + a.attrib("id") + a.attrib("name");
+    EXPECT_EQ(a.attribsConst(), b.attribsConst()) << path;
+
+    std::vector<std::string> va, vb;
+    tokenizeString(a.value(), va);
+    tokenizeString(b.value(), vb);
+    ASSERT_EQ(va.size(), vb.size()) << path;
+    for (size_t i = 0; i < va.size(); i++) {
+        if (va[i] != vb[i]) {
+            EXPECT_DOUBLE_EQ(fpValueCheck(va[i]), fpValueCheck(vb[i])) << path;
+        }
+    }
+
+    std::vector<XML_Node*> ca, cb;
+    for (auto c : a.children()) {
+        if (c->name() != "comment") {
+            ca.push_back(c);
+        }
+    }
+    for (auto c : b.children()) {
+        if (c->name() != "comment") {
+            cb.push_back(c);
+        }
+    }
+    ASSERT_EQ(ca.size(), cb.size()) << path;
+    for (size_t i = 0; i < ca.size(); i++) {
+        compareTrees(*ca[i], *cb[i]);
+    }
+}
+
+TEST(ct2ctml_native, compare_to_xml)
+{
+    XML_Node native, ref;
+    ASSERT_TRUE(ct2ctml_native("../data/steam-reforming.cti", native, true));
+    std::ifstream xmlfile("../data/steam-reforming.xml");
+    ref.build(xmlfile);
+    compareTrees(native, ref);
+}
+
+TEST(ct2ctml_native, gas_reactions)
+{
+    XML_Node root;
+    ASSERT_TRUE(ct2ctml_native(
+        "units(length='cm', quantity='mol', act_energy='cal/mol')\n"
+        "ideal_gas(name='gas', elements='H O Ar', species='gri30: H H2 O2 "
+        "HO2 AR', reactions='all',\n"
+        "          initial_state=state(temperature=300.0, pressure=OneAtm))\n"
+        "three_body_reaction('2 H + M <=> H2 + M', [1.0e18, -1.0, 0.0],\n"
+        "                    efficiencies='H2:0 AR:0.63')\n"
+        "falloff_reaction('H + O2 (+ AR) <=> HO2 (+ AR)',\n"
+        "                 kf=[4.65e12, 0.44, 0.0],\n"
+        "                 kf0=[6.366e20, -1.72, 524.8],\n"
+        "                 falloff=Troe(A=0.5, T3=1e-30, T1=1e30))\n"
+        "reaction('H2 + O2 => 2 H + O2', [1.0e13, 0, 2 * 5000],\n"
+        "         order='H2:0.5', options='duplicate')\n", root));
+
+    ASSERT_EQ(root.name(), "ctml");
+    XML_Node& phase = root.child("phase");
+    EXPECT_EQ(phase["id"], "gas");
+    EXPECT_EQ(phase.child("speciesArray")["datasrc"], "gri30.xml#species_data");
+    EXPECT_DOUBLE_EQ(getFloat(phase.child("state"), "pressure"), OneAtm);
+    EXPECT_EQ(phase.child("kinetics")["model"], "GasKinetics");
+
+    std::vector<XML_Node*> R = root.child("reactionData").getChildren("reaction");
+    ASSERT_EQ(R.size(), (size_t) 3);
+
+    // 2 H + M: rate constant in (cm^3/mol)^2/s
+    EXPECT_EQ(R[0]->attrib("type"), "threeBody");
+    XML_Node& k0 = R[0]->child("rateCoeff").child("Arrhenius");
+    EXPECT_NEAR(fpValue(k0.child("A").value()), 1.0e12, 1e3);
+    EXPECT_EQ(R[0]->child("rateCoeff").child("efficiencies").value(),
+              "H2:0 AR:0.63");
+    EXPECT_EQ(R[0]->child("reactants").value(), "H:2.0");
+
+    // Explicit third body
+    EXPECT_EQ(R[1]->attrib("type"), "falloff");
+    XML_Node& rc = R[1]->child("rateCoeff");
+    EXPECT_EQ(rc.child("efficiencies").value(), "AR:1.0");
+    EXPECT_EQ(rc.child("efficiencies")["default"], "0.0");
+    std::vector<XML_Node*> rates = rc.getChildren("Arrhenius");
+    ASSERT_EQ(rates.size(), (size_t) 2);
+    EXPECT_NEAR(fpValue(rates[0]->child("A").value()), 4.65e9, 1e3);
+    EXPECT_EQ(rates[1]->attrib("name"), "k0");
+    EXPECT_NEAR(fpValue(rates[1]->child("A").value()), 6.366e14, 1e8);
+    EXPECT_EQ(rates[1]->child("E")["units"], "cal/mol");
+    EXPECT_EQ(rc.child("falloff")["type"], "Troe");
+    EXPECT_EQ(rc.child("falloff").value(), "0.5 1e-30 1e+30");
+    EXPECT_EQ(R[1]->child("reactants").value(), "H:1.0 O2:1");
+
+    // Irreversible reaction with a fractional reaction order
+    EXPECT_EQ(R[2]->attrib("reversible"), "no");
+    EXPECT_EQ(R[2]->attrib("duplicate"), "yes");
+    EXPECT_EQ(R[2]->child("equation").value(), "H2 + O2 =] 2 H + O2");
+    XML_Node& k2 = R[2]->child("rateCoeff").child("Arrhenius");
+    EXPECT_DOUBLE_EQ(fpValue(k2.child("E").value()), 10000.0);
+    EXPECT_EQ(R[2]->getChildren("order").size(), (size_t) 2);
+    // rate constant in (cm^3/mol)^0.5/s
+    EXPECT_NEAR(fpValue(k2.child("A").value()), 1.0e13 * sqrt(1e-3), 1e6);
+}
+
+TEST(ct2ctml_native, species)
+{
+    XML_Node root;
+    ASSERT_TRUE(ct2ctml_native(
+        "species(name = 'AR+', atoms = ' Ar:1 E:-1 ',\n"
+        "    thermo = (NASA([200.00, 1000.00], [2.5, 0.0, 0.0, 0.0, 0.0,\n"
+        "                  -745.375, 4.37967491]),\n"
+        "              NASA([1000.00, 6000.00], [2.5, 0.0, 0.0, 0.0, 0.0,\n"
+        "                  -745.375, 4.37967491])),\n"
+        "    transport = gas_transport(geom = 'atom', diam = 3.33,\n"
+        "                              well_depth = 136.50),\n"
+        "    note = \"\"\"multi-line\n"
+        "note\"\"\")\n", root));
+    XML_Node& sp = root.child("speciesData").child("species");
+    EXPECT_EQ(sp["name"], "AR+");
+    EXPECT_EQ(sp.child("atomArray").value(), "Ar:1 E:-1");
+    EXPECT_EQ(sp.child("charge").value(), "1");
+    std::vector<XML_Node*> nasa = sp.child("thermo").getChildren("NASA");
+    ASSERT_EQ(nasa.size(), (size_t) 2);
+    EXPECT_EQ(nasa[1]->attrib("Tmin"), "1000.0");
+    EXPECT_EQ(nasa[1]->attrib("P0"), "100000.0");
+    vector_fp coeffs;
+    getFloatArray(nasa[0]->child("floatArray"), coeffs, false);
+    ASSERT_EQ(coeffs.size(), (size_t) 7);
+    EXPECT_DOUBLE_EQ(coeffs[5], -745.375);
+    EXPECT_EQ(stripws(sp.child("transport").child("LJ_diameter").value()),
+              "3.330");
+    EXPECT_EQ(sp.child("note").value(), "multi-line\nnote");
+
+    EXPECT_THROW(ct2ctml_native("species(name='H', atoms='H:1')\n"
+                                "species(name='H', atoms='H:1')\n", root),
+                 CanteraError);
+}
+
+TEST(ct2ctml_native, unsupported_input)
+{
+    // Input using Python statements or unknown entries is left for the
+    // Python converter
+    XML_Node root("doc");
+    EXPECT_FALSE(ct2ctml_native("for i in range(3):\n    pass\n", root));
+    EXPECT_FALSE(ct2ctml_native("import math\n", root));
+    EXPECT_FALSE(ct2ctml_native("liquid_vapor(name='water', "
+                                "elements='O H', species='H2O')\n", root));
+    EXPECT_FALSE(ct2ctml_native("x = [1, 2, 3][0]\n", root));
+    EXPECT_EQ(root.name(), "doc");
+    EXPECT_EQ(root.nChildren(), (size_t) 0);
+}
+
+}
@@ -1,5 +1,8 @@
 #include "gtest/gtest.h"
 #include "cantera/numerics/BandMatrix.h"
+#include "cantera/numerics/SparseLU.h"
+#include "cantera/numerics/BlockTridiagLU.h"
+#include "cantera/numerics/DenseMatrix.h"
 
 using namespace Cantera;
 
@@ -103,3 +106,221 @@ TEST_F(BandMatrixTest, checkRowsColumns) {
     EXPECT_EQ((size_t) 0, i);
     EXPECT_DOUBLE_EQ(1, s);
 }
+
+TEST(SparseMatrix, patternAndValues)
+{
+    SparseMatrix A(3, 4);
+    A.setPattern({{0, 0}, {2, 0}, {1, 1}, {0, 3}, {2, 3}, {2, 0}});
+    EXPECT_EQ((size_t) 5, A.nNonzeros());
+    A(0, 0) = 1.0;
+    A(2, 0) = 2.0;
+    A(1, 1) = 3.0;
+    A(0, 3) = 4.0;
+    A(2, 3) += 5.0;
+    EXPECT_DOUBLE_EQ(2.0, A.value(2, 0));
+    EXPECT_DOUBLE_EQ(0.0, A.value(1, 2));
+    EXPECT_EQ(npos, A.index(1, 2));
+    EXPECT_THROW(A(1, 2), CanteraError);
+
+    vector_fp x{1, 2, 3, 4};
+    vector_fp b(3);
+    A.mult(x.data(), b.data());
+    EXPECT_DOUBLE_EQ(17.0, b[0]);
+    EXPECT_DOUBLE_EQ(6.0, b[1]);
+    EXPECT_DOUBLE_EQ(22.0, b[2]);
+}
+
+TEST(SparseMatrix, assign)
+{
+    SparseMatrix A(3, 3), B(3, 3), C;
+    A.setPattern({{0, 0}, {1, 2}, {2, 1}});
+    B.setPattern({{0, 0}, {1, 2}, {2, 1}});
+    A(1, 2) = 4.0;
+    B(1, 2) = 1.0;
+    const double* values = B.values().data();
+    B.assign(A);
+    EXPECT_EQ(values, B.values().data());
+    EXPECT_DOUBLE_EQ(4.0, B.value(1, 2));
+
+    // Different pattern
+    C.assign(A);
+    EXPECT_EQ((size_t) 3, C.nRows());
+    EXPECT_EQ((size_t) 3, C.nNonzeros());
+    EXPECT_DOUBLE_EQ(4.0, C.value(1, 2));
+}
+
+TEST(SparseMatrix, matrixProduct)
+{
+    SparseMatrix A(3, 3), B(3, 2), C;
+    A.setPattern({{0, 0}, {1, 0}, {1, 1}, {2, 2}, {0, 2}});
+    B.setPattern({{0, 0}, {2, 0}, {1, 1}});
+    DenseMatrix Ad(3, 3), Bd(3, 2), Cs;
+    for (size_t j = 0; j < 3; j++) {
+        for (size_t i = 0; i < 3; i++) {
+            if (A.index(i, j) != npos) {
+                A(i, j) = Ad(i, j) = 1.0 + i + 2*j;
+            }
+            if (j < 2 && B.index(i, j) != npos) {
+                B(i, j) = Bd(i, j) = 3.0 - i + j;
+            }
+        }
+    }
+    C.setProductPattern(A, B);
+    C.setProduct(A, B);
+    C.toDense(Cs);
+    for (size_t i = 0; i < 3; i++) {
+        for (size_t j = 0; j < 2; j++) {
+            double c = 0.0;
+            for (size_t k = 0; k < 3; k++) {
+                c += Ad(i, k) * Bd(k, j);
+            }
+            EXPECT_DOUBLE_EQ(c, Cs(i, j));
+        }
+    }
+}
+
+TEST(SparseLU, solve_linear_system)
+{
+    // An "arrow" matrix with one dense row and column, plus a few other
+    // entries which generate fill-in
+    size_t n = 12;
+    std::vector<std::pair<size_t, size_t> > pattern;
+    for (size_t i = 0; i < n; i++) {
+        pattern.emplace_back(i, i);
+        pattern.emplace_back(i, 5);
+        pattern.emplace_back(5, i);
+        pattern.emplace_back(i, (3*i + 1) % n);
+    }
+    SparseMatrix A(n, n);
+    A.setPattern(pattern);
+    DenseMatrix Ad;
+    SparseLU lu;
+    for (int trial = 0; trial < 2; trial++) {
+        for (size_t j = 0; j < n; j++) {
+            for (size_t k = A.columnStarts()[j]; k < A.columnStarts()[j+1]; k++) {
+                size_t i = A.rowIndices()[k];
+                A.values()[k] = (i == j) ? 10.0 + i : 1.0 / (1 + i + trial * j);
+            }
+        }
+        A.toDense(Ad);
+        lu.factor(A);
+        EXPECT_GE(lu.nFactorNonzeros(), A.nNonzeros());
+        EXPECT_LT(lu.nFactorNonzeros(), n * n);
+
+        vector_fp b(n), x(n);
+        for (size_t i = 0; i < n; i++) {
+            b[i] = x[i] = 1.0 + 0.5 * i;
+        }
+        lu.solve(x.data());
+        vector_fp Ax(n);
+        Ad.mult(x.data(), Ax.data());
+        for (size_t i = 0; i < n; i++) {
+            EXPECT_NEAR(b[i], Ax[i], 1e-13 * b[i]);
+        }
+    }
+}
+
+TEST(SparseLU, preconditioner)
+{
+    SparseMatrix J(3, 3);
+    J.setPattern({{0, 1}, {1, 0}, {2, 1}});
+    J(0, 1) = 2.0;
+    J(1, 0) = -1.0;
+    J(2, 1) = 4.0;
+    SparseLUPreconditioner P;
+    double gamma = 0.5;
+    P.setup(J, gamma);
+    vector_fp b{1.0, 2.0, 3.0}, x(3), r(3);
+    P.solve(b.data(), x.data());
+    // Residual of (I - gamma*J) x = b
+    J.mult(x.data(), r.data());
+    for (size_t i = 0; i < 3; i++) {
+        EXPECT_NEAR(b[i], x[i] - gamma * r[i], 1e-14);
+    }
+}
+
+TEST(BlockTridiagLU, solve_linear_system)
+{
+    // Blocks of different sizes, including an empty block which decouples
+    // the blocks on either side of it
+    std::vector<size_t> sizes{2, 3, 3, 0, 1, 4};
+    size_t n = 13;
+    BlockTridiagLU lu;
+    lu.setBlockSizes(sizes);
+    ASSERT_EQ(n, lu.size());
+    BandMatrix A(n, 6, 6);
+    size_t i0 = 0;
+    for (size_t j = 0; j < sizes.size(); j++) {
+        size_t i1 = i0 + sizes[j];
+        size_t k0 = (j > 0) ? i0 - sizes[j-1] : i0;
+        size_t k1 = (j + 1 < sizes.size()) ? i1 + sizes[j+1] : i1;
+        for (size_t i = i0; i < i1; i++) {
+            for (size_t k = k0; k < k1; k++) {
+                A(i, k) = (i == k) ? 0.5 : 1.0 / (1.0 + i + 2.0 * k);
+                lu.value(i, k) = A(i, k);
+            }
+        }
+        i0 = i1;
+    }
+    // A zero in the first pivot position requires pivoting within the block
+    A(0, 0) = 0.0;
+    lu.value(0, 0) = 0.0;
+    // Blocks are stored in column-major order
+    EXPECT_DOUBLE_EQ(A(3, 4), lu.block(1, 1)[1 + 3*2]);
+    EXPECT_DOUBLE_EQ(A(4, 1), lu.block(1, 0)[2 + 3*1]);
+    EXPECT_DOUBLE_EQ(A(1, 4), lu.block(0, 1)[1 + 2*2]);
+    // Elements outside of the block-tridiagonal structure are zero
+    EXPECT_EQ(0.0, lu.value(0, 5));
+    EXPECT_EQ(0.0, lu.value(8, 7));
+
+    ASSERT_EQ(0, lu.factor());
+    vector_fp b(n), x(n), Ax(n);
+    for (size_t i = 0; i < n; i++) {
+        b[i] = x[i] = 1.0 + 0.5 * i;
+    }
+    lu.solve(x.data());
+    A.mult(x.data(), Ax.data());
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_NEAR(b[i], Ax[i], 1e-13 * b[i]);
+    }
+
+    // Compare with the solution using the banded LU factorization
+    vector_fp x2(b);
+    A.solve(x2.data());
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_NEAR(x2[i], x[i], 1e-12 * std::abs(x2[i]));
+    }
+
+    // The matrix is not modified by the factorization
+    EXPECT_DOUBLE_EQ(A(3, 5), lu.value(3, 5));
+}
+
+TEST(BlockTridiagLU, singular_block)
+{
+    BlockTridiagLU lu;
+    lu.setBlockSizes({2, 2});
+    for (size_t i = 0; i < 4; i++) {
+        lu.value(i, i) = 1.0;
+    }
+    lu.value(2, 2) = 0.0;
+    EXPECT_EQ(3, lu.factor()); // 1 + index of the row with a zero pivot
+    EXPECT_THROW(lu.block(0, 2), CanteraError);
+}
+
+TEST(BlockTridiagLU, ill_conditioned_block)
+{
+    // The second diagonal block is nearly singular, but has no zero pivot
+    BlockTridiagLU lu;
+    lu.setBlockSizes({1, 2});
+    lu.value(0, 0) = 1.0;
+    lu.value(1, 1) = 1.0;
+    lu.value(1, 2) = 1.0;
+    lu.value(2, 1) = 1.0;
+    lu.value(2, 2) = 1.0 + 1e-13;
+    EXPECT_EQ(2, lu.factor()); // 1 + index of the first row of the block
+    lu.setMinRcond(1e-15);
+    EXPECT_EQ(0, lu.factor());
+    lu.value(2, 2) = 2.0;
+    lu.setMinRcond(1e-10);
+    EXPECT_EQ(0, lu.factor());
+}
@@ -0,0 +1,86 @@
+#include "gtest/gtest.h"
+#include "cantera/base/ThreadPool.h"
+#include "cantera/base/ctexceptions.h"
+#include <atomic>
+
+namespace Cantera
+{
+
+TEST(ThreadPool, all_tasks_once)
+{
+    ThreadPool pool(4);
+    EXPECT_EQ(pool.nThreads(), (size_t) 4);
+    std::vector<int> count(1000, 0);
+    std::vector<size_t> worker(1000);
+    pool.run(count.size(), [&](size_t i, size_t w) {
+        count[i]++;
+        worker[i] = w;
+    });
+    for (size_t i = 0; i < count.size(); i++) {
+        EXPECT_EQ(count[i], 1);
+        EXPECT_LT(worker[i], pool.nThreads());
+    }
+
+    // The pool can be reused
+    pool.run(count.size(), [&](size_t i, size_t w) { count[i]++; });
+    for (size_t i = 0; i < count.size(); i++) {
+        EXPECT_EQ(count[i], 2);
+    }
+    pool.run(0, [&](size_t i, size_t w) { count[i]++; });
+}
+
+TEST(ThreadPool, single_thread)
+{
+    ThreadPool pool(1);
+    std::vector<size_t> order;
+    pool.run(10, [&](size_t i, size_t w) {
+        EXPECT_EQ(w, (size_t) 0);
+        order.push_back(i);
+    });
+    for (size_t i = 0; i < order.size(); i++) {
+        EXPECT_EQ(order[i], i);
+    }
+}
+
+TEST(ThreadPool, no_concurrent_use_of_worker)
+{
+    ThreadPool pool(3);
+    std::vector<std::atomic<int>> busy(pool.nThreads());
+    for (auto& b : busy) {
+        b = 0;
+    }
+    std::atomic<int> errors(0);
+    pool.run(300, [&](size_t i, size_t w) {
+        if (busy[w]++ != 0) {
+            errors++;
+        }
+        // Uneven task costs, to exercise work stealing
+        volatile double x = 0;
+        for (size_t j = 0; j < (i % 17) * 1000; j++) {
+            x += j;
+        }
+        busy[w]--;
+    });
+    EXPECT_EQ(errors, 0);
+}
+
+TEST(ThreadPool, exceptions)
+{
+    ThreadPool pool(4);
+    std::atomic<int> ncalls(0);
+    try {
+        pool.run(100, [&](size_t i, size_t w) {
+            ncalls++;
+            if (i == 17 || i == 63) {
+                throw CanteraError("task", "failed task {}", i);
+            }
+        });
+        FAIL() << "Expected an exception";
+    } catch (CanteraError& err) {
+        EXPECT_NE(err.getMessage().find("failed task 17"), std::string::npos);
+    }
+    // All other tasks are still evaluated
+    EXPECT_EQ(ncalls, 100);
+}
+
+}
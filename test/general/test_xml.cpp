@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 #include "cantera/base/xml.h"
+#include <chrono>
 #include <fstream>
 
 namespace Cantera
@@ -27,4 +28,93 @@ TEST(XML_Node, read_write)
     }
 }
 
+TEST(XML_Node, build_quirks)
+{
+    std::stringstream s;
+    s << "<?xml version=\"1.0\"?>\n"
+      << "<!-- header comment -->\n"
+      << "<ctml>\n"
+      << "  <!-- a > b -->\n"
+      << "  <phase dim=\"3\" id=\"gas\" >\n"
+      << "    <state/>\n"
+      << "    <x   a = \"1\"  b=\"two words\" a=\"3\"/>\n"
+      << "    <array size=\"4\">\n"
+      << "      1.0, 2.0,\n"
+      << "          3.0,   4.0\n"
+      << "    </array>\n"
+      << "  </phase>\n"
+      << "</ctml>\n";
+    XML_Node root;
+    root.build(s);
+    EXPECT_EQ(root.name(), "ctml");
+    EXPECT_EQ(root.lineNumber(), 2); // line numbers are zero-based
+    ASSERT_EQ(root.nChildren(), (size_t) 3);
+    EXPECT_TRUE(root.child(0).isComment());
+    EXPECT_EQ(root.child(0).value(), " header comment ");
+    EXPECT_TRUE(root.child(1).isComment());
+    EXPECT_EQ(root.child(1).value(), " a > b ");
+
+    XML_Node& phase = root.child("phase");
+    EXPECT_EQ(phase["dim"], "3");
+    EXPECT_EQ(phase["id"], "gas");
+    EXPECT_EQ(phase.lineNumber(), 4);
+    ASSERT_EQ(phase.nChildren(), (size_t) 3);
+    EXPECT_EQ(phase.child(0).name(), "state");
+    EXPECT_EQ(phase.child(0).value(), "");
+    EXPECT_EQ(phase.child(1)["a"], "3");
+    EXPECT_EQ(phase.child(1)["b"], "two words");
+
+    XML_Node& array = phase.child("array");
+    EXPECT_EQ(array["size"], "4");
+    EXPECT_EQ(array.lineNumber(), 7);
+    EXPECT_EQ(array.value(), "1.0, 2.0,\n 3.0,   4.0");
+}
+
+TEST(XML_Node, build_mismatch)
+{
+    std::stringstream s("<ctml>\n<phase>\n</species>\n</ctml>\n");
+    XML_Node root;
+    EXPECT_THROW(root.build(s), CanteraError);
+}
+
+TEST(XML_Node, parse_throughput)
+{
+    // Generate a large document resembling a CTML species database
+    std::stringstream out;
+    out << "<?xml version=\"1.0\"?>\n<ctml>\n  <speciesData id=\"species\">\n";
+    size_t nsp = 20000;
+    for (size_t k = 0; k < nsp; k++) {
+        out << "    <!-- species " << k << " -->\n"
+            << "    <species name=\"S" << k << "\">\n"
+            << "      <atomArray>C:1 H:4 </atomArray>\n"
+            << "      <thermo>\n"
+            << "        <NASA Tmax=\"1000.0\" Tmin=\"200.0\" P0=\"100000.0\">\n"
+            << "           <floatArray name=\"coeffs\" size=\"7\">\n"
+            << "             5.149876130E+00,  -1.367097880E-02,   4.918005990E-05,\n"
+            << "             -4.847430260E-08,   1.666939560E-11,  -1.024664760E+04,\n"
+            << "             -4.641303760E+00</floatArray>\n"
+            << "        </NASA>\n"
+            << "      </thermo>\n"
+            << "    </species>\n";
+    }
+    out << "  </speciesData>\n</ctml>\n";
+    std::string text = out.str();
+
+    std::stringstream in(text);
+    XML_Node root;
+    auto t0 = std::chrono::steady_clock::now();
+    root.build(in);
+    double dt = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - t0).count();
+
+    ASSERT_EQ(root.child("speciesData").nChildren(), 2 * nsp);
+    XML_Node& last = root.child("speciesData").child(2 * nsp - 1);
+    EXPECT_EQ(last["name"], "S" + std::to_string(nsp - 1));
+    EXPECT_EQ(last.lineNumber(), 12 * static_cast<int>(nsp) - 8);
+    double rate = text.size() / 1.0e6 / std::max(dt, 1e-9);
+    RecordProperty("MB_per_second", std::to_string(rate));
+    std::cout << "Parsed " << text.size() / 1.0e6 << " MB in " << dt
+              << " s (" << rate << " MB/s)" << std::endl;
+}
+
 }
@@ -0,0 +1,113 @@
+#include "gtest/gtest.h"
+#include "cantera/kinetics/importKinetics.h"
+#include "cantera/kinetics/GasKinetics.h"
+#include "cantera/thermo/IdealGasPhase.h"
+
+namespace Cantera
+{
+
+class BatchProductionRates : public testing::Test
+{
+public:
+    void setup(const std::string& infile, const std::string& phase) {
+        thermo.reset(new IdealGasPhase(infile, phase));
+        std::vector<ThermoPhase*> phases { thermo.get() };
+        importKinetics(thermo->xml(), phases, &kin);
+    }
+
+    // Add a state to the batch, perturbing the composition so that each
+    // state is different
+    void addState(double T, double P, const std::string& X) {
+        size_t kk = thermo->nSpecies();
+        thermo->setState_TPX(T, P, X);
+        vector_fp x(kk);
+        thermo->getMoleFractions(x.data());
+        for (size_t k = 0; k < kk; k++) {
+            x[k] += 1e-4 * ((k + TT.size()) % 7);
+        }
+        thermo->setState_TPX(T, P, x.data());
+        TT.push_back(T);
+        PP.push_back(P);
+        YY.resize(YY.size() + kk);
+        thermo->getMassFractions(&YY[YY.size() - kk]);
+    }
+
+    void check() {
+        size_t kk = thermo->nSpecies();
+        size_t M = TT.size();
+        vector_fp wdot_batch(M * kk), wdot(kk);
+
+        // Evaluate a single state first, to check that the batch evaluation
+        // does not affect cached values
+        thermo->setState_TPY(TT[0], PP[0], &YY[0]);
+        vector_fp wdot0(kk);
+        kin.getNetProductionRates(wdot0.data());
+
+        kin.getBatchNetProductionRates(M, TT.data(), PP.data(), YY.data(),
+                                       wdot_batch.data());
+        EXPECT_DOUBLE_EQ(TT.back(), thermo->temperature());
+
+        thermo->setState_TPY(TT[0], PP[0], &YY[0]);
+        kin.getNetProductionRates(wdot.data());
+        for (size_t k = 0; k < kk; k++) {
+            EXPECT_DOUBLE_EQ(wdot0[k], wdot[k]);
+        }
+
+        for (size_t m = 0; m < M; m++) {
+            thermo->setState_TPY(TT[m], PP[m], &YY[m*kk]);
+            kin.getNetProductionRates(wdot.data());
+            double scale = 0.0;
+            for (size_t k = 0; k < kk; k++) {
+                scale = std::max(scale, std::abs(wdot[k]));
+            }
+            for (size_t k = 0; k < kk; k++) {
+                EXPECT_NEAR(wdot[k], wdot_batch[m*kk + k], 1e-10 * scale)
+                    << "state " << m << ", species " << thermo->speciesName(k);
+            }
+        }
+    }
+
+    std::unique_ptr<IdealGasPhase> thermo;
+    GasKinetics kin;
+    vector_fp TT, PP, YY;
+};
+
+TEST_F(BatchProductionRates, gri30)
+{
+    setup("gri30.xml", "gri30");
+    std::string X = "CH4:0.3, O2:0.6, N2:2, H:0.01, OH:0.02, H2O:0.1, "
+                    "CO:0.05, CH3:0.01, HO2:0.001, CH2O:0.002, AR:0.05";
+    // Enough states to require more than one block
+    for (int m = 0; m < 70; m++) {
+        addState(800 + 20 * m, OneAtm * (1 + m % 4), X);
+    }
+    check();
+}
+
+TEST_F(BatchProductionRates, pdep)
+{
+    setup("../data/pdep-test.xml", "gas");
+    std::string X = "H:1.0, R1A:1.0, R1B:1.0, R2:1.0, R3:1.0, R4:1.0, "
+        "R5:1.0, R6:1.0, P1:0.5, P2A:0.2, P2B:0.3, P4:0.5, P6A:0.3";
+    for (int m = 0; m < 7; m++) {
+        addState(600 + 150 * m, OneAtm * pow(3.0, m - 2), X);
+    }
+    check();
+}
+
+TEST_F(BatchProductionRates, fractionalOrders)
+{
+    setup("../data/frac.xml", "gas");
+    addState(2000, 4*OneAtm, "H2O:0.5, OH:.05, H:0.1, O2:0.15, H2:0.2");
+    addState(1200, OneAtm, "H2O:0.1, OH:.01, H:0.001, O2:0.3, H2:0.6");
+    check();
+}
+
+TEST_F(BatchProductionRates, singleState)
+{
+    setup("gri30.xml", "gri30");
+    addState(1500, OneAtm, "CH4:1, O2:2, N2:7.52");
+    check();
+}
+
+}
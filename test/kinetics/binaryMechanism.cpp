@@ -0,0 +1,151 @@
+#include "gtest/gtest.h"
+#include "cantera/kinetics/BinaryMechanism.h"
+#include "cantera/kinetics/importKinetics.h"
+#include "cantera/kinetics/GasKinetics.h"
+#include "cantera/thermo/IdealGasPhase.h"
+#include "cantera/transport/TransportFactory.h"
+#include "cantera/base/ctml.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace Cantera
+{
+
+void compareRates(Kinetics& kin1, Kinetics& kin2)
+{
+    size_t nr = kin1.nReactions();
+    ASSERT_EQ(nr, kin2.nReactions());
+    vector_fp kf1(nr), kf2(nr), kr1(nr), kr2(nr);
+    kin1.getFwdRateConstants(kf1.data());
+    kin2.getFwdRateConstants(kf2.data());
+    kin1.getRevRateConstants(kr1.data());
+    kin2.getRevRateConstants(kr2.data());
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_EQ(kin1.reactionString(i), kin2.reactionString(i));
+        EXPECT_EQ(kin1.reactionType(i), kin2.reactionType(i));
+        EXPECT_NEAR(kf1[i], kf2[i], 1e-12 * kf1[i]) << kin1.reactionString(i);
+        EXPECT_NEAR(kr1[i], kr2[i], 1e-12 * kr1[i]) << kin1.reactionString(i);
+    }
+}
+
+TEST(BinaryMechanism, gri30)
+{
+    IdealGasPhase gas1("gri30.xml", "gri30");
+    GasKinetics kin1;
+    std::vector<ThermoPhase*> phases { &gas1 };
+    importKinetics(gas1.xml(), phases, &kin1);
+    std::unique_ptr<Transport> tran1(newTransportMgr("Mix", &gas1));
+    writeBinaryMechanism("gri30-test.ctb", gas1, &kin1, tran1.get());
+
+    BinaryMechanism mech("gri30-test.ctb");
+    ASSERT_TRUE(mech.hasKinetics());
+    ASSERT_TRUE(mech.hasTransport());
+    IdealGasPhase gas2;
+    GasKinetics kin2;
+    mech.importPhase(gas2);
+    mech.importKinetics(gas2, kin2);
+    std::unique_ptr<Transport> tran2(mech.newTransport(gas2));
+    std::remove("gri30-test.ctb");
+
+    EXPECT_EQ(gas1.id(), gas2.id());
+    ASSERT_EQ(gas1.nElements(), gas2.nElements());
+    ASSERT_EQ(gas1.nSpecies(), gas2.nSpecies());
+    EXPECT_DOUBLE_EQ(gas1.temperature(), gas2.temperature());
+    EXPECT_DOUBLE_EQ(gas1.pressure(), gas2.pressure());
+    EXPECT_EQ(tran1->model(), tran2->model());
+
+    size_t kk = gas1.nSpecies();
+    for (double T : {300.0, 1200.0, 2500.0}) {
+        gas1.setState_TPX(T, OneAtm, "CH4:1, O2:2, N2:7.52, H:1e-3, OH:1e-3");
+        gas2.setState_TPX(T, OneAtm, "CH4:1, O2:2, N2:7.52, H:1e-3, OH:1e-3");
+        vector_fp mu1(kk), mu2(kk), d1(kk), d2(kk);
+        gas1.getChemPotentials(mu1.data());
+        gas2.getChemPotentials(mu2.data());
+        for (size_t k = 0; k < kk; k++) {
+            EXPECT_EQ(gas1.speciesName(k), gas2.speciesName(k));
+            EXPECT_DOUBLE_EQ(gas1.molecularWeight(k), gas2.molecularWeight(k));
+            EXPECT_DOUBLE_EQ(mu1[k], mu2[k]);
+        }
+        compareRates(kin1, kin2);
+
+        EXPECT_DOUBLE_EQ(tran1->viscosity(), tran2->viscosity());
+        EXPECT_DOUBLE_EQ(tran1->thermalConductivity(),
+                         tran2->thermalConductivity());
+        tran1->getMixDiffCoeffs(d1.data());
+        tran2->getMixDiffCoeffs(d2.data());
+        for (size_t k = 0; k < kk; k++) {
+            EXPECT_DOUBLE_EQ(d1[k], d2[k]);
+        }
+    }
+}
+
+TEST(BinaryMechanism, pdep)
+{
+    // PLOG and Chebyshev reactions, without transport
+    XML_Node* phase_node = get_XML_File("../data/pdep-test.xml");
+    IdealGasPhase gas1;
+    GasKinetics kin1;
+    buildSolutionFromXML(*phase_node, "gas", "phase", &gas1, &kin1);
+    writeBinaryMechanism("pdep-test.ctb", gas1, &kin1);
+
+    BinaryMechanism mech("pdep-test.ctb");
+    EXPECT_FALSE(mech.hasTransport());
+    IdealGasPhase gas2;
+    GasKinetics kin2;
+    mech.importPhase(gas2);
+    mech.importKinetics(gas2, kin2);
+    std::remove("pdep-test.ctb");
+    EXPECT_THROW(mech.newTransport(gas2), CanteraError);
+
+    for (double P : {0.01 * OneAtm, OneAtm, 80 * OneAtm}) {
+        gas1.setState_TPX(1100, P, "H:1.0, R1A:1.0, R2:1.0, R3:1.0, R4:1.0");
+        gas2.setState_TPX(1100, P, "H:1.0, R1A:1.0, R2:1.0, R3:1.0, R4:1.0");
+        compareRates(kin1, kin2);
+    }
+}
+
+TEST(BinaryMechanism, invalidFile)
+{
+    {
+        std::ofstream out("invalid.ctb", std::ios::binary);
+        out << "<?xml version='1.0'?>\n<ctml/>\n";
+    }
+    EXPECT_THROW(BinaryMechanism("invalid.ctb"), CanteraError);
+    std::remove("invalid.ctb");
+    EXPECT_THROW(BinaryMechanism("no-such-file.ctb"), CanteraError);
+}
+
+TEST(BinaryMechanism, corruptCount)
+{
+    IdealGasPhase gas1("h2o2.xml", "ohmech");
+    std::unique_ptr<Transport> tran1(newTransportMgr("Mix", &gas1));
+    writeBinaryMechanism("corrupt.ctb", gas1, 0, tran1.get());
+    std::string data;
+    {
+        std::ifstream in("corrupt.ctb", std::ios::binary);
+        data.assign(std::istreambuf_iterator<char>(in),
+                    std::istreambuf_iterator<char>());
+    }
+
+    // The transport section starts with the model and mode, followed by the
+    // number of viscosity fits. Replace that count with a huge value.
+    uint64_t offset;
+    memcpy(&offset, &data[16 + 2 * sizeof(uint64_t)], sizeof(offset));
+    ASSERT_LT(offset + 12, data.size());
+    uint32_t count = 0xffffffff;
+    memcpy(&data[offset + 8], &count, sizeof(count));
+    {
+        std::ofstream out("corrupt.ctb", std::ios::binary);
+        out.write(data.data(), data.size());
+    }
+
+    BinaryMechanism mech("corrupt.ctb");
+    std::remove("corrupt.ctb");
+    IdealGasPhase gas2;
+    mech.importPhase(gas2);
+    EXPECT_THROW(mech.newTransport(gas2), CanteraError);
+}
+
+}
@@ -0,0 +1,123 @@
+#include "gtest/gtest.h"
+#include "cantera/kinetics/importKinetics.h"
+#include "cantera/kinetics/GasKinetics.h"
+#include "cantera/thermo/IdealGasPhase.h"
+#include "cantera/numerics/SparseMatrix.h"
+
+namespace Cantera
+{
+
+class ProductionRateDerivatives : public testing::Test
+{
+public:
+    void setup(const std::string& infile, const std::string& phase) {
+        thermo.reset(new IdealGasPhase(infile, phase));
+        std::vector<ThermoPhase*> phases { thermo.get() };
+        importKinetics(thermo->xml(), phases, &kin);
+    }
+
+    // Set the state, with a small amount of every species present so that
+    // second-order terms do not affect the finite difference approximations
+    void setState(double T, double P, const std::string& X) {
+        thermo->setState_TPX(T, P, X);
+        vector_fp x(thermo->nSpecies());
+        thermo->getMoleFractions(x.data());
+        for (auto& xk : x) {
+            xk += 1e-3;
+        }
+        thermo->setState_TPX(T, P, x.data());
+    }
+
+    // Compare the analytic derivatives with respect to concentration against
+    // central finite differences, or forward differences for species where
+    // the central difference would require a negative concentration
+    void check_ddC(double rtol) {
+        size_t kk = thermo->nSpecies();
+        SparseMatrix dwdot;
+        kin.getNetProductionRates_ddC(dwdot);
+        ASSERT_EQ(kk, dwdot.nRows());
+        ASSERT_EQ(kk, dwdot.nColumns());
+
+        vector_fp conc(kk), wdot1(kk), wdot2(kk);
+        thermo->getConcentrations(conc.data());
+        double ctot = thermo->molarDensity();
+        for (size_t j = 0; j < kk; j++) {
+            double c0 = conc[j];
+            double dc = 1e-6 * ctot;
+            conc[j] = c0 + dc;
+            thermo->setConcentrations(conc.data());
+            kin.getNetProductionRates(wdot1.data());
+            double c2 = std::max(c0 - dc, 0.0);
+            conc[j] = c2;
+            thermo->setConcentrations(conc.data());
+            kin.getNetProductionRates(wdot2.data());
+            conc[j] = c0;
+            thermo->setConcentrations(conc.data());
+            for (size_t k = 0; k < kk; k++) {
+                double fd = (wdot1[k] - wdot2[k]) / (c0 + dc - c2);
+                double scale = std::abs(fd) + 1e-6 * maxAbs(wdot1) / ctot;
+                EXPECT_NEAR(fd, dwdot.value(k, j), rtol * scale)
+                    << "species " << thermo->speciesName(k) << " wrt "
+                    << thermo->speciesName(j);
+            }
+        }
+    }
+
+    void check_ddT(double rtol) {
+        size_t kk = thermo->nSpecies();
+        vector_fp dwdot(kk), wdot1(kk), wdot2(kk);
+        kin.getNetProductionRates_ddT(dwdot.data());
+        double T = thermo->temperature();
+        double dT = 1e-4 * T;
+        thermo->setTemperature(T + dT);
+        kin.getNetProductionRates(wdot1.data());
+        thermo->setTemperature(T - dT);
+        kin.getNetProductionRates(wdot2.data());
+        thermo->setTemperature(T);
+        for (size_t k = 0; k < kk; k++) {
+            double fd = (wdot1[k] - wdot2[k]) / (2 * dT);
+            EXPECT_NEAR(fd, dwdot[k], rtol * (std::abs(fd) + 1e-8 * maxAbs(wdot1)));
+        }
+    }
+
+    double maxAbs(const vector_fp& x) {
+        double m = 0.0;
+        for (double v : x) {
+            m = std::max(m, std::abs(v));
+        }
+        return m;
+    }
+
+    std::unique_ptr<IdealGasPhase> thermo;
+    GasKinetics kin;
+};
+
+TEST_F(ProductionRateDerivatives, gri30)
+{
+    setup("gri30.xml", "gri30");
+    setState(1500, 2 * OneAtm,
+        "CH4:0.3, O2:0.6, N2:2, H:0.01, OH:0.02, H2O:0.1, CO:0.05, CH3:0.01, "
+        "HO2:0.001, H2O2:0.0003, CH2O:0.002, C2H4:0.001, AR:0.05");
+    check_ddC(1e-4);
+    check_ddT(1e-4);
+}
+
+TEST_F(ProductionRateDerivatives, pdep)
+{
+    setup("../data/pdep-test.xml", "gas");
+    setState(900, 8 * OneAtm,
+        "H:1.0, R1A:1.0, R1B:1.0, R2:1.0, R3:1.0, R4:1.0, R5:1.0, R6:1.0, "
+        "P1:0.5, P2A:0.2, P2B:0.3, P3A:0.2, P3B:0.1, P4:0.5, P5A:0.1, "
+        "P5B:0.2, P6A:0.3, P6B:0.1");
+    check_ddC(1e-4);
+    check_ddT(1e-4);
+}
+
+TEST_F(ProductionRateDerivatives, fractionalOrders)
+{
+    setup("../data/frac.xml", "gas");
+    setState(2000, 4*OneAtm, "H2O:0.5, OH:.05, H:0.1, O2:0.15, H2:0.2");
+    check_ddC(1e-4);
+}
+
+}
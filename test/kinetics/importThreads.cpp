@@ -0,0 +1,115 @@
+#include "gtest/gtest.h"
+#include "cantera/kinetics/importKinetics.h"
+#include "cantera/kinetics/GasKinetics.h"
+#include "cantera/thermo/IdealGasPhase.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/base/ctml.h"
+
+namespace Cantera
+{
+
+class ImportThreads : public testing::Test
+{
+public:
+    ~ImportThreads() {
+        setImportThreads(1);
+    }
+
+    // Import the phase and kinetics defined by `phase` using `nThreads`
+    // threads, and return the message of the exception that is thrown
+    std::string importError(XML_Node& phase, size_t nThreads) {
+        setImportThreads(nThreads);
+        try {
+            IdealGasPhase gas(phase);
+            GasKinetics kin;
+            std::vector<ThermoPhase*> phases { &gas };
+            importKinetics(phase, phases, &kin);
+        } catch (CanteraError& err) {
+            return err.getMessage();
+        }
+        return "";
+    }
+};
+
+TEST_F(ImportThreads, gri30)
+{
+    setImportThreads(1);
+    IdealGasPhase gas1("gri30.xml", "gri30");
+    GasKinetics kin1;
+    std::vector<ThermoPhase*> phases1 { &gas1 };
+    importKinetics(gas1.xml(), phases1, &kin1);
+
+    setImportThreads(4);
+    EXPECT_EQ(importThreads(), (size_t) 4);
+    IdealGasPhase gas2("gri30.xml", "gri30");
+    GasKinetics kin2;
+    std::vector<ThermoPhase*> phases2 { &gas2 };
+    importKinetics(gas2.xml(), phases2, &kin2);
+
+    size_t kk = gas1.nSpecies();
+    ASSERT_EQ(kk, gas2.nSpecies());
+    gas1.setState_TPX(1500, OneAtm, "CH4:1, O2:2, N2:7.52, H:1e-3, OH:1e-3");
+    gas2.setState_TPX(1500, OneAtm, "CH4:1, O2:2, N2:7.52, H:1e-3, OH:1e-3");
+    vector_fp cp1(kk), cp2(kk);
+    gas1.getPartialMolarCp(cp1.data());
+    gas2.getPartialMolarCp(cp2.data());
+    for (size_t k = 0; k < kk; k++) {
+        EXPECT_EQ(gas1.speciesName(k), gas2.speciesName(k));
+        EXPECT_DOUBLE_EQ(gas1.molecularWeight(k), gas2.molecularWeight(k));
+        EXPECT_DOUBLE_EQ(cp1[k], cp2[k]);
+    }
+
+    size_t nr = kin1.nReactions();
+    ASSERT_EQ(nr, kin2.nReactions());
+    vector_fp kf1(nr), kf2(nr), kr1(nr), kr2(nr);
+    kin1.getFwdRateConstants(kf1.data());
+    kin2.getFwdRateConstants(kf2.data());
+    kin1.getRevRateConstants(kr1.data());
+    kin2.getRevRateConstants(kr2.data());
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_EQ(kin1.reactionString(i), kin2.reactionString(i));
+        EXPECT_EQ(kin1.reactionType(i), kin2.reactionType(i));
+        EXPECT_DOUBLE_EQ(kf1[i], kf2[i]) << kin1.reactionString(i);
+        EXPECT_DOUBLE_EQ(kr1[i], kr2[i]) << kin1.reactionString(i);
+    }
+}
+
+TEST_F(ImportThreads, speciesErrors)
+{
+    XML_Node root;
+    get_XML_File("h2o2.xml")->copy(&root);
+    std::vector<XML_Node*> species =
+        root.findByName("speciesData")->getChildren("species");
+    ASSERT_GT(species.size(), (size_t) 6);
+    // Mixed parameterizations for the third species; too many regions for the
+    // sixth species. Only the first of these errors should be reported.
+    species[2]->child("thermo").addChild("Shomate");
+    species[5]->child("thermo").addChild("NASA");
+    XML_Node* phase = root.findID("ohmech");
+    ASSERT_TRUE(phase != 0);
+
+    std::string serial = importError(*phase, 1);
+    EXPECT_NE(serial.find("mixed"), std::string::npos) << serial;
+    EXPECT_EQ(serial, importError(*phase, 4));
+    EXPECT_EQ(serial, importError(*phase, 0));
+}
+
+TEST_F(ImportThreads, reactionErrors)
+{
+    XML_Node root;
+    get_XML_File("h2o2.xml")->copy(&root);
+    std::vector<XML_Node*> reactions =
+        root.findByName("reactionData")->getChildren("reaction");
+    ASSERT_GT(reactions.size(), (size_t) 12);
+    reactions[4]->addAttribute("type", "foo");
+    reactions[12]->addAttribute("type", "bar");
+    XML_Node* phase = root.findID("ohmech");
+    ASSERT_TRUE(phase != 0);
+
+    std::string serial = importError(*phase, 1);
+    EXPECT_NE(serial.find("'foo'"), std::string::npos) << serial;
+    EXPECT_EQ(serial, importError(*phase, 4));
+    EXPECT_EQ(serial, importError(*phase, 0));
+}
+
+}
@@ -141,6 +141,33 @@ TEST_F(FracCoeffTest, EquilibriumConstants)
     EXPECT_NEAR(exp(-deltaG0_1/RT) * pow(pRef/RT, -0.5), Kc[1], 1e-13 * Kc[1]);
 }
 
+TEST(GasKinetics, ReverseRateConstants)
+{
+    IdealGasPhase thermo("gri30.xml", "gri30");
+    std::vector<ThermoPhase*> phases { &thermo };
+    GasKinetics kin;
+    importKinetics(thermo.xml(), phases, &kin);
+    size_t nr = kin.nReactions();
+    vector_fp kf(nr), kr(nr), Kc(nr);
+    for (double T : {1500.0, 800.0}) {
+        thermo.setState_TPX(T, 2*OneAtm, "CH4:1, O2:2, N2:7.52, H:0.01, OH:0.01");
+        kin.getFwdRateConstants(kf.data());
+        kin.getEquilibriumConstants(Kc.data());
+        kin.getRevRateConstants(kr.data());
+        size_t nIrrev = 0;
+        for (size_t i = 0; i < nr; i++) {
+            if (kin.isReversible(i)) {
+                EXPECT_NEAR(kf[i] / Kc[i], kr[i], 1e-12 * kr[i])
+                    << kin.reactionString(i);
+            } else {
+                EXPECT_EQ(0.0, kr[i]) << kin.reactionString(i);
+                nIrrev++;
+            }
+        }
+        EXPECT_GT(nIrrev, (size_t) 0);
+    }
+}
+
 class NegativePreexponentialFactor : public testing::Test
 {
 public:
@@ -209,4 +236,42 @@ TEST(InterfaceReaction, CoverageDependency) {
     EXPECT_NEAR(kf[1], 3.7e20 * exp(-(67.4e6-6e6*0.3)/(GasConstant*T)), 1e-14*kf[1]);
 }
 
+
+TEST(ArrheniusRateMgr, MatchesScalarEvaluation)
+{
+    std::vector<Arrhenius> rates {
+        Arrhenius(3.87e1, 2.7, 3150.0), // all terms
+        Arrhenius(1.2e14, -0.86, 0.0), // Ea = 0
+        Arrhenius(2.0e10, 0.0, 24000.0), // b = 0
+        Arrhenius(5.0e10, 0.0, 0.0), // constant
+        Arrhenius(-1.5e8, 1.5, -500.0), // negative A and Ea
+    };
+    Rate1<Arrhenius> mgr;
+    for (size_t i = 0; i < rates.size(); i++) {
+        // install in reverse order to check the scatter into 'values'
+        mgr.install(rates.size() - 1 - i, rates[i]);
+    }
+    ASSERT_EQ(rates.size(), mgr.nReactions());
+
+    vector_fp values(rates.size());
+    for (double T : {300.0, 1000.0, 2500.0}) {
+        mgr.update(T, log(T), values.data());
+        for (size_t i = 0; i < rates.size(); i++) {
+            EXPECT_DOUBLE_EQ(rates[i].updateRC(log(T), 1.0/T),
+                             values[rates.size() - 1 - i]);
+        }
+    }
+
+    // Replacing a rate can move it to a different group
+    Arrhenius newRate(1.0e12, 0.5, 100.0);
+    mgr.replace(1, newRate);
+    double T = 1500.0;
+    mgr.update(T, log(T), values.data());
+    EXPECT_DOUBLE_EQ(newRate.updateRC(log(T), 1.0/T), values[1]);
+    EXPECT_DOUBLE_EQ(rates[0].updateRC(log(T), 1.0/T), values[4]);
+    EXPECT_DOUBLE_EQ(rates[2].updateRC(log(T), 1.0/T), values[2]);
+    EXPECT_DOUBLE_EQ(rates[4].updateRC(log(T), 1.0/T), values[0]);
+    EXPECT_DOUBLE_EQ(0.5, mgr.effectiveTemperatureExponent(3));
+}
+
 }
@@ -0,0 +1,151 @@
+#include "gtest/gtest.h"
+#include "cantera/kinetics/importKinetics.h"
+#include "cantera/kinetics/GasKinetics.h"
+#include "cantera/thermo/IdealGasPhase.h"
+
+namespace Cantera
+{
+
+class DynamicReduction : public testing::Test
+{
+public:
+    DynamicReduction() : thermo("gri30.xml", "gri30") {
+        std::vector<ThermoPhase*> phases { &thermo };
+        importKinetics(thermo.xml(), phases, &kin);
+        nr = kin.nReactions();
+        kk = thermo.nSpecies();
+        targets = {"CH4", "O2", "CO2", "H2O"};
+    }
+
+    // Rates of progress and production rates of the full mechanism
+    void getFullRates() {
+        ropf0.resize(nr);
+        ropr0.resize(nr);
+        wdot0.resize(kk);
+        kin.getFwdRatesOfProgress(ropf0.data());
+        kin.getRevRatesOfProgress(ropr0.data());
+        kin.getNetProductionRates(wdot0.data());
+    }
+
+    IdealGasPhase thermo;
+    GasKinetics kin;
+    size_t nr, kk;
+    std::vector<std::string> targets;
+    vector_fp ropf0, ropr0, wdot0;
+};
+
+TEST_F(DynamicReduction, activeSet)
+{
+    thermo.setState_TPX(900, OneAtm, "CH4:1, O2:2, N2:7.52, CH3:1e-6, H:1e-7");
+    getFullRates();
+
+    vector_fp kf0(nr);
+    kin.getFwdRateConstants(kf0.data());
+
+    kin.setDynamicReduction(0.05, targets);
+    vector_fp ropf(nr), ropr(nr), wdot(kk), kf(nr);
+    kin.getFwdRatesOfProgress(ropf.data());
+    kin.getRevRatesOfProgress(ropr.data());
+    kin.getNetProductionRates(wdot.data());
+
+    size_t nActive = kin.nActiveReactions();
+    EXPECT_GT(nActive, (size_t) 0);
+    EXPECT_LT(nActive, nr);
+    size_t count = 0;
+    for (size_t i = 0; i < nr; i++) {
+        if (kin.isActiveReaction(i)) {
+            count++;
+            EXPECT_DOUBLE_EQ(ropf0[i], ropf[i]) << kin.reactionString(i);
+            EXPECT_NEAR(ropr0[i], ropr[i], 1e-12 * std::abs(ropr0[i]))
+                << kin.reactionString(i);
+        } else {
+            EXPECT_EQ(0.0, ropf[i]);
+            EXPECT_EQ(0.0, ropr[i]);
+        }
+    }
+    EXPECT_EQ(nActive, count);
+
+    // The rate constants are reported for all reactions, and the rates of
+    // progress of the inactive reactions remain zero
+    thermo.setState_TPX(950, OneAtm, "CH4:1, O2:2, N2:7.52, CH3:1e-6, H:1e-7");
+    kin.getFwdRateConstants(kf.data());
+    kin.getFwdRatesOfProgress(ropf.data());
+    for (size_t i = 0; i < nr; i++) {
+        if (!kin.isActiveReaction(i)) {
+            EXPECT_EQ(0.0, ropf[i]) << kin.reactionString(i);
+        }
+    }
+    kin.setDynamicReduction(0.0, targets);
+    kin.getFwdRateConstants(kf0.data());
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_NEAR(kf0[i], kf[i], 1e-12 * kf0[i]) << kin.reactionString(i);
+    }
+
+    // The consumption of the fuel and oxidizer is retained
+    for (const auto& name : {"CH4", "O2"}) {
+        size_t k = thermo.speciesIndex(name);
+        EXPECT_NEAR(wdot0[k], wdot[k], 0.05 * std::abs(wdot0[k])) << name;
+    }
+}
+
+TEST_F(DynamicReduction, disable)
+{
+    thermo.setState_TPX(1400, 2*OneAtm, "CH4:1, O2:2, N2:7.52, OH:1e-4, H:1e-4");
+    getFullRates();
+
+    kin.setDynamicReduction(0.1, targets);
+    vector_fp wdot(kk);
+    kin.getNetProductionRates(wdot.data());
+    EXPECT_LT(kin.nActiveReactions(), nr);
+
+    kin.setDynamicReduction(0.0, targets);
+    EXPECT_EQ(nr, kin.nActiveReactions());
+    vector_fp ropf(nr), ropr(nr);
+    kin.getFwdRatesOfProgress(ropf.data());
+    kin.getRevRatesOfProgress(ropr.data());
+    kin.getNetProductionRates(wdot.data());
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_DOUBLE_EQ(ropf0[i], ropf[i]);
+        EXPECT_DOUBLE_EQ(ropr0[i], ropr[i]);
+    }
+    for (size_t k = 0; k < kk; k++) {
+        EXPECT_DOUBLE_EQ(wdot0[k], wdot[k]);
+    }
+}
+
+TEST_F(DynamicReduction, periodicUpdate)
+{
+    size_t interval = 3;
+    thermo.setState_TPX(800, OneAtm, "CH4:1, O2:2, N2:7.52, CH3:1e-8");
+    kin.setDynamicReduction(0.02, targets, interval);
+    vector_fp wdot(kk);
+    kin.getNetProductionRates(wdot.data());
+    size_t nActive0 = kin.nActiveReactions();
+
+    // The active set is kept until the rates have been evaluated 'interval'
+    // more times
+    std::string X = "CH4:1, O2:2, N2:7.52, H:1e-3, O:1e-3, OH:1e-3, HO2:1e-4, "
+                    "CH3:1e-3, CH2O:1e-3, HCO:1e-4, CO:0.01, H2:1e-2";
+    for (size_t n = 0; n < interval; n++) {
+        thermo.setState_TPX(1800 + n, OneAtm, X);
+        kin.getNetProductionRates(wdot.data());
+        EXPECT_EQ(nActive0, kin.nActiveReactions());
+    }
+    thermo.setState_TPX(1800 + interval, OneAtm, X);
+    kin.getNetProductionRates(wdot.data());
+    size_t nActive1 = kin.nActiveReactions();
+    EXPECT_GT(nActive1, nActive0);
+
+    kin.updateActiveReactions();
+    EXPECT_EQ(nActive1, kin.nActiveReactions());
+}
+
+TEST_F(DynamicReduction, invalidTarget)
+{
+    EXPECT_THROW(kin.setDynamicReduction(0.1, {"CH4", "XYZ"}),
+                 CanteraError);
+    EXPECT_THROW(kin.setDynamicReduction(0.1, {}), CanteraError);
+    EXPECT_THROW(kin.updateActiveReactions(), CanteraError);
+}
+
+}
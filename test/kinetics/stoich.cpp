@@ -0,0 +1,100 @@
+#include "gtest/gtest.h"
+#include "cantera/kinetics/importKinetics.h"
+#include "cantera/kinetics/GasKinetics.h"
+#include "cantera/thermo/IdealGasPhase.h"
+
+namespace Cantera
+{
+
+class TestStoichKinetics : public GasKinetics
+{
+public:
+    using GasKinetics::m_reactantStoich;
+    using GasKinetics::m_revProductStoich;
+    using GasKinetics::m_irrevProductStoich;
+};
+
+class StoichManagerTest : public testing::Test
+{
+public:
+    void setup(const std::string& file, const std::string& id) {
+        thermo.reset(new IdealGasPhase(file, id));
+        std::vector<ThermoPhase*> phases { thermo.get() };
+        importKinetics(thermo->xml(), phases, &kin);
+        nr = kin.nReactions();
+        kk = thermo->nSpecies();
+    }
+
+    // Compare the species rates computed using the compressed representation
+    // with those computed using the lists of C1, C2, C3 and C_AnyN objects
+    void compare(const StoichManagerN& stoich) {
+        StoichManagerN compressed = stoich;
+        compressed.finalize();
+        StoichManagerN lists = stoich;
+        lists.setCompressed(false);
+
+        vector_fp S(kk), R(nr);
+        for (size_t k = 0; k < kk; k++) {
+            S[k] = 0.1 + 0.01 * ((7 * k) % 13);
+        }
+        for (size_t i = 0; i < nr; i++) {
+            R[i] = 1.0 + 0.1 * ((3 * i) % 11) - 0.5 * (i % 2);
+        }
+
+        vector_fp S1(S), S2(S);
+        compressed.incrementSpecies(R.data(), S1.data());
+        lists.incrementSpecies(R.data(), S2.data());
+        expectNear(S1, S2);
+        compressed.decrementSpecies(R.data(), S1.data());
+        compressed.decrementSpecies(R.data(), S1.data());
+        lists.decrementSpecies(R.data(), S2.data());
+        lists.decrementSpecies(R.data(), S2.data());
+        expectNear(S1, S2);
+    }
+
+    void expectNear(const vector_fp& x, const vector_fp& y) {
+        ASSERT_EQ(x.size(), y.size());
+        for (size_t i = 0; i < x.size(); i++) {
+            EXPECT_NEAR(x[i], y[i], 1e-14 * std::max(std::abs(y[i]), 1.0))
+                << i;
+        }
+    }
+
+    std::unique_ptr<IdealGasPhase> thermo;
+    TestStoichKinetics kin;
+    size_t nr, kk;
+};
+
+TEST_F(StoichManagerTest, gri30)
+{
+    setup("gri30.xml", "gri30");
+    compare(kin.m_reactantStoich);
+    compare(kin.m_revProductStoich);
+    compare(kin.m_irrevProductStoich);
+}
+
+TEST_F(StoichManagerTest, fractional)
+{
+    setup("../data/frac.xml", "gas");
+    compare(kin.m_reactantStoich);
+    compare(kin.m_revProductStoich);
+    compare(kin.m_irrevProductStoich);
+}
+
+TEST_F(StoichManagerTest, netProductionRates)
+{
+    setup("gri30.xml", "gri30");
+    thermo->setState_TPX(1500, OneAtm,
+                         "CH4:1, O2:2, N2:7.52, H:0.01, OH:0.02, CH3:0.01");
+    vector_fp cdot(kk), ddot(kk), wdot(kk);
+    kin.getCreationRates(cdot.data());
+    kin.getDestructionRates(ddot.data());
+    kin.getNetProductionRates(wdot.data());
+    for (size_t k = 0; k < kk; k++) {
+        EXPECT_NEAR(cdot[k] - ddot[k], wdot[k],
+                    1e-12 * std::max(cdot[k], ddot[k]) + 1e-300)
+            << thermo->speciesName(k);
+    }
+}
+
+}
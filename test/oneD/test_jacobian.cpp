@@ -0,0 +1,287 @@
+#include "gtest/gtest.h"
+#include "cantera/oneD/Sim1D.h"
+#include "cantera/oneD/Inlet1D.h"
+#include "cantera/oneD/StFlow.h"
+#include "cantera/IdealGasMix.h"
+#include "cantera/transport.h"
+
+namespace Cantera
+{
+
+class FlameJacobian : public testing::Test
+{
+public:
+    FlameJacobian() : gas("h2o2.xml", "ohmech"), flow(&gas) {
+        std::string X = "H2:1.1, O2:1, AR:5";
+        size_t npts = 20;
+        gas.setState_TPX(300, OneAtm, X);
+        vector_fp yin(gas.nSpecies()), yout(gas.nSpecies());
+        gas.getMassFractions(yin.data());
+        double rho_in = gas.density();
+        gas.equilibrate("HP");
+        gas.getMassFractions(yout.data());
+        double Tad = gas.temperature();
+        double rho_out = gas.density();
+        gas.setState_TPY(300, OneAtm, yin.data());
+
+        vector_fp z(npts);
+        for (size_t i = 0; i < npts; i++) {
+            z[i] = 0.02 * i / (npts - 1);
+        }
+        flow.setupGrid(npts, z.data());
+        trans.reset(newTransportMgr("Mix", &gas));
+        flow.setTransport(*trans);
+        flow.setKinetics(gas);
+        flow.setPressure(OneAtm);
+        inlet.setMoleFractions(X);
+        inlet.setMdot(0.5 * rho_in);
+        inlet.setTemperature(300);
+
+        std::vector<Domain1D*> domains { &inlet, &flow, &outlet };
+        sim.reset(new Sim1D(domains));
+        vector_fp locs{0.0, 0.4, 1.0};
+        vector_fp v{0.5, 0.5*rho_in/rho_out, 0.5*rho_in/rho_out};
+        sim->setInitialGuess("u", locs, v);
+        v = {300, Tad, Tad};
+        sim->setInitialGuess("T", locs, v);
+        for (size_t k = 0; k < gas.nSpecies(); k++) {
+            v = {yin[k], yout[k], yout[k]};
+            sim->setInitialGuess(gas.speciesName(k), locs, v);
+        }
+        sim->setFixedTemperature(900.0);
+    }
+
+    // Compare the Jacobian computed with and without coloring. The residuals
+    // are summed in a different order when the residual is evaluated at all
+    // points, so the columns differ by round-off error amplified by the
+    // finite difference.
+    void check() {
+        size_t n = sim->size();
+        vector_fp x(sim->solution(), sim->solution() + n);
+        vector_fp r(n);
+        MultiJac& jac = sim->OneDim::jacobian();
+
+        sim->setJacobianColoring(false);
+        sim->OneDim::eval(npos, x.data(), r.data(), 0.0, 0);
+        jac.eval(x.data(), r.data(), 0.0);
+        vector_fp J1(n * n);
+        for (size_t i = 0; i < n; i++) {
+            for (size_t j = 0; j < n; j++) {
+                J1[i*n + j] = jac(i, j);
+            }
+        }
+
+        sim->setJacobianColoring(true);
+        sim->OneDim::eval(npos, x.data(), r.data(), 0.0, 0);
+        jac.eval(x.data(), r.data(), 0.0);
+        for (size_t i = 0; i < n; i++) {
+            double rowmax = 0.0;
+            for (size_t j = 0; j < n; j++) {
+                rowmax = std::max(rowmax, std::abs(J1[i*n + j]));
+            }
+            for (size_t j = 0; j < n; j++) {
+                EXPECT_NEAR(J1[i*n + j], jac(i, j), 1e-8 * rowmax)
+                    << "row " << i << ", column " << j;
+            }
+            EXPECT_EQ(x[i], sim->solution()[i]);
+        }
+    }
+
+    // Compare the Jacobian and the Newton step computed with the
+    // block-tridiagonal and banded storage and factorizations
+    void checkSolver() {
+        size_t n = sim->size();
+        vector_fp x(sim->solution(), sim->solution() + n);
+        vector_fp r(n), step1(n), step2(n);
+        MultiJac& jac = sim->OneDim::jacobian();
+        sim->OneDim::eval(npos, x.data(), r.data(), 0.0, 0);
+        double rdt = 1e4;
+        jac.eval(x.data(), r.data(), 0.0);
+        jac.updateTransient(rdt, sim->transientMask().data());
+        vector_fp J1(n * n);
+        for (size_t i = 0; i < n; i++) {
+            for (size_t j = 0; j < n; j++) {
+                J1[i*n + j] = jac(i, j);
+            }
+        }
+        ASSERT_EQ(0, jac.solve(r.data(), step1.data()));
+        EXPECT_FALSE(jac.blockFactored());
+
+        // The Jacobian is copied to the block-tridiagonal storage
+        sim->setBlockTridiagonalSolver(true);
+        for (size_t i = 0; i < n; i++) {
+            for (size_t j = 0; j < n; j++) {
+                ASSERT_EQ(J1[i*n + j], jac(i, j)) << i << ", " << j;
+            }
+        }
+        ASSERT_EQ(0, jac.solve(r.data(), step2.data()));
+        EXPECT_TRUE(jac.blockFactored());
+        double stepmax = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            stepmax = std::max(stepmax, std::abs(step1[i]));
+        }
+        for (size_t i = 0; i < n; i++) {
+            EXPECT_NEAR(step1[i], step2[i], 1e-10 * stepmax)
+                << "component " << i;
+        }
+
+        // The Jacobian evaluated in the block-tridiagonal storage is the same,
+        // and is copied back to the banded storage
+        jac.eval(x.data(), r.data(), 0.0);
+        jac.updateTransient(rdt, sim->transientMask().data());
+        sim->setBlockTridiagonalSolver(false);
+        for (size_t i = 0; i < n; i++) {
+            for (size_t j = 0; j < n; j++) {
+                ASSERT_EQ(J1[i*n + j], jac(i, j)) << i << ", " << j;
+            }
+        }
+    }
+
+    IdealGasMix gas;
+    FreeFlame flow;
+    Inlet1D inlet;
+    Outlet1D outlet;
+    std::unique_ptr<Transport> trans;
+    std::unique_ptr<Sim1D> sim;
+};
+
+TEST_F(FlameJacobian, energy)
+{
+    flow.solveEnergyEqn();
+    check();
+}
+
+TEST_F(FlameJacobian, fixedTemperature)
+{
+    flow.fixTemperature();
+    check();
+}
+
+TEST_F(FlameJacobian, radiation)
+{
+    flow.solveEnergyEqn();
+    flow.enableRadiation(true);
+    flow.setBoundaryEmissivities(0.5, 0.3);
+    check();
+}
+
+TEST_F(FlameJacobian, threads)
+{
+    flow.solveEnergyEqn();
+    flow.setNumThreads(3);
+    check();
+}
+
+TEST_F(FlameJacobian, transientMask)
+{
+    // Evaluating the Jacobian one point at a time must not clear the
+    // transient mask set by the evaluation of the residual at all points,
+    // since the mask is used to add the transient terms to the Jacobian.
+    flow.solveEnergyEqn();
+    sim->setJacobianColoring(false);
+    size_t n = sim->size();
+    vector_fp x(sim->solution(), sim->solution() + n);
+    vector_fp r(n);
+    sim->OneDim::eval(npos, x.data(), r.data(), 0.0, 0);
+    vector_int mask = sim->transientMask();
+    ASSERT_GT(std::count(mask.begin(), mask.end(), 1), 2 * sim->points());
+
+    MultiJac& jac = sim->OneDim::jacobian();
+    jac.eval(x.data(), r.data(), 0.0);
+    EXPECT_EQ(mask, sim->transientMask());
+
+    // The transient terms are subtracted from the diagonal for all of the
+    // components included in the mask
+    vector_fp ssdiag(n);
+    for (size_t i = 0; i < n; i++) {
+        ssdiag[i] = jac(i, i);
+    }
+    double rdt = 1e4;
+    jac.updateTransient(rdt, sim->transientMask().data());
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_DOUBLE_EQ(ssdiag[i] - mask[i] * rdt, jac(i, i));
+    }
+}
+
+TEST_F(FlameJacobian, blockTridiagonalSolver)
+{
+    EXPECT_FALSE(sim->blockTridiagonalSolver());
+    flow.solveEnergyEqn();
+    checkSolver();
+}
+
+TEST_F(FlameJacobian, blockTridiagonalSolve)
+{
+    // The solution found using the block-tridiagonal solver should agree with
+    // the solution found using the banded solver
+    flow.fixTemperature();
+    size_t n = sim->size();
+    vector_fp x0(sim->solution(), sim->solution() + n);
+    vector_fp x1;
+    for (bool blocks : {false, true}) {
+        sim->setSolution(x0.data());
+        sim->setBlockTridiagonalSolver(blocks);
+        sim->solve(0, false);
+        EXPECT_EQ(blocks, sim->OneDim::jacobian().blockFactored());
+        if (x1.empty()) {
+            x1.assign(sim->solution(), sim->solution() + n);
+        } else {
+            for (size_t i = 0; i < n; i++) {
+                EXPECT_NEAR(x1[i], sim->solution()[i],
+                            1e-5 * (1 + std::abs(x1[i])));
+            }
+        }
+    }
+}
+
+TEST_F(FlameJacobian, adaptiveJacobian)
+{
+    // The solution found with adaptive Jacobian reuse should agree with the
+    // default solution, and statistics should be saved for the single grid
+    flow.fixTemperature();
+    size_t n = sim->size();
+    vector_fp x0(sim->solution(), sim->solution() + n);
+    vector_fp x1;
+    for (bool adaptive : {false, true}) {
+        sim->setSolution(x0.data());
+        sim->clearStats();
+        sim->setAdaptiveJacobian(adaptive);
+        sim->solve(0, false);
+        ASSERT_EQ(sim->gridSizeStats().size(), 1u);
+        EXPECT_EQ(sim->gridSizeStats()[0], sim->points());
+        EXPECT_EQ(sim->newtonStepStats().size(), 1u);
+        EXPECT_EQ(sim->timeStepStats().size(), 1u);
+        EXPECT_GT(sim->newtonStepStats()[0], 0);
+        EXPECT_GT(sim->jacobianCountStats()[0], 0);
+        EXPECT_GE(sim->factorTimeStats()[0], 0.0);
+        EXPECT_GE(sim->solveTimeStats()[0], 0.0);
+        if (x1.empty()) {
+            x1.assign(sim->solution(), sim->solution() + n);
+        } else {
+            for (size_t i = 0; i < n; i++) {
+                EXPECT_NEAR(x1[i], sim->solution()[i],
+                            1e-5 * (1 + std::abs(x1[i])));
+            }
+        }
+    }
+
+    // No statistics are saved for the current grid after clearing them
+    sim->clearStats();
+    EXPECT_EQ(sim->gridSizeStats().size(), 0u);
+    EXPECT_EQ(sim->evalCountStats().size(), 0u);
+    EXPECT_EQ(sim->jacobianCountStats().size(), 0u);
+    EXPECT_EQ(sim->newtonStepStats().size(), 0u);
+    EXPECT_EQ(sim->timeStepStats().size(), 0u);
+    EXPECT_EQ(sim->factorTimeStats().size(), 0u);
+}
+
+} // namespace Cantera
+
+int main(int argc, char** argv)
+{
+    printf("Running main() from test_jacobian.cpp\n");
+    testing::InitGoogleTest(&argc, argv);
+    int result = RUN_ALL_TESTS();
+    Cantera::appdelete();
+    return result;
+}
@@ -104,6 +104,50 @@ TEST_F(SpeciesThermoInterpTypeTest, install_shomate)
     EXPECT_DOUBLE_EQ(p2.cp_mass(), p.cp_mass());
 }
 
+TEST(GeneralSpeciesThermo, mixedNasa)
+{
+    // Species using NasaPoly2 are evaluated together, and are not consecutive
+    std::vector<shared_ptr<SpeciesThermoInterpType>> stit {
+        make_shared<NasaPoly2>(200, 3500, 101325, o2_nasa_coeffs),
+        make_shared<ConstCpPoly>(200, 5000, 101325, c_h2),
+        make_shared<NasaPoly2>(200, 3500, 101325, h2o_nasa_coeffs),
+        make_shared<ShomatePoly2>(200, 6000, 101325, co2_shomate_coeffs),
+        make_shared<NasaPoly2>(200, 3500, 101325, oh_nasa_coeffs)
+    };
+    GeneralSpeciesThermo sp;
+    for (size_t k = 0; k < stit.size(); k++) {
+        sp.install_STIT(k, stit[k]);
+    }
+    GeneralSpeciesThermo copy(sp);
+
+    size_t K = stit.size();
+    vector_fp cp(K), h(K), s(K);
+    for (double T : {300.0, 1000.0, 1700.0}) {
+        sp.update(T, cp.data(), h.data(), s.data());
+        for (size_t k = 0; k < K; k++) {
+            double cpk, hk, sk;
+            stit[k]->updatePropertiesTemp(T, &cpk, &hk, &sk);
+            EXPECT_DOUBLE_EQ(cpk, cp[k]) << "k = " << k << ", T = " << T;
+            EXPECT_DOUBLE_EQ(hk, h[k]) << "k = " << k << ", T = " << T;
+            EXPECT_DOUBLE_EQ(sk, s[k]) << "k = " << k << ", T = " << T;
+        }
+    }
+
+    double Htest = -250e6;
+    sp.modifyOneHf298(2, Htest);
+    EXPECT_DOUBLE_EQ(Htest, sp.reportOneHf298(2));
+    sp.update(298.15, cp.data(), h.data(), s.data());
+    EXPECT_DOUBLE_EQ(Htest, h[2] * 298.15 * GasConstant);
+    sp.update(1500, cp.data(), h.data(), s.data());
+    double cpk, hk, sk;
+    stit[2]->updatePropertiesTemp(1500, &cpk, &hk, &sk);
+    EXPECT_DOUBLE_EQ(hk, h[2]);
+
+    // The copy is not affected
+    copy.update(298.15, cp.data(), h.data(), s.data());
+    EXPECT_NEAR(-241.826e6, h[2] * 298.15 * GasConstant, 1e5);
+}
+
 TEST(Shomate, modifyParameters)
 {
     ShomatePoly2 S1(200, 6000, 101325, co2_shomate_coeffs);
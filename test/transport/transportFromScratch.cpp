@@ -12,6 +12,9 @@
 
 #include "../thermo/thermo_data.h"
 
+#include <cstdio>
+#include <fstream>
+
 using namespace Cantera;
 
 class TransportFromScratch : public testing::Test
@@ -101,6 +104,51 @@ TEST_F(TransportFromScratch, mixDiffCoeffs)
     }
 }
 
+TEST_F(TransportFromScratch, mixDiffCoeffsFromBinary)
+{
+    MixTransport tr;
+    tr.init(ref.get());
+    size_t K = ref->nSpecies();
+    vector_fp D(K), Dmole(K), Dmass(K), X(K), mw = ref->molecularWeights();
+    Array2D bdiff(K, K);
+    const char* comps[] = {"H2:0.5, O2:0.3, H2O:0.2", "H2:0.1, H2O:0.9", "O2:1"};
+    for (double T : {400.0, 1500.0}) {
+        // Change the composition at a fixed temperature, where the binary
+        // diffusion coefficients are reused
+        for (const char* comp : comps) {
+            ref->setState_TPX(T, 5e5, comp);
+            tr.getMixDiffCoeffs(D.data());
+            tr.getMixDiffCoeffsMole(Dmole.data());
+            tr.getMixDiffCoeffsMass(Dmass.data());
+            tr.getBinaryDiffCoeffs(K, &bdiff(0,0));
+            ref->getMoleFractions(X.data());
+            double mmw = ref->meanMolecularWeight();
+            for (size_t k = 0; k < K; k++) {
+                X[k] = std::max(X[k], Tiny);
+            }
+            double sumxw = 0.0;
+            for (size_t k = 0; k < K; k++) {
+                sumxw += X[k] * mw[k];
+            }
+            for (size_t k = 0; k < K; k++) {
+                double sum1 = 0.0, sum2 = 0.0;
+                for (size_t j = 0; j < K; j++) {
+                    if (j != k) {
+                        sum1 += X[j] / bdiff(k,j);
+                        sum2 += X[j] * mw[j] / bdiff(k,j);
+                    }
+                }
+                double Dk = (sumxw - X[k] * mw[k]) / (mmw * sum1);
+                double Dk_mole = (1 - X[k]) / sum1;
+                double Dk_mass = 1.0 / (sum1 + sum2 * X[k] / (mmw - mw[k] * X[k]));
+                EXPECT_NEAR(Dk, D[k], 1e-12 * Dk) << comp;
+                EXPECT_NEAR(Dk_mole, Dmole[k], 1e-12 * Dk_mole) << comp;
+                EXPECT_NEAR(Dk_mass, Dmass[k], 1e-12 * Dk_mass) << comp;
+            }
+        }
+    }
+}
+
 TEST_F(TransportFromScratch, viscosity)
 {
     Transport* trRef = newTransportMgr("Mix", ref.get());
@@ -166,6 +214,338 @@ TEST_F(TransportFromScratch, thermalConductivityMulti)
     }
 }
 
+TEST_F(TransportFromScratch, copyMix)
+{
+    std::unique_ptr<Transport> tr(newTransportMgr("Mix", ref.get()));
+    std::unique_ptr<Transport> copy(tr->duplMyselfAsTransport());
+    copy->setThermo(*test);
+    EXPECT_EQ(tr->model(), copy->model());
+
+    size_t K = ref->nSpecies();
+    vector_fp Dref(K), Dcopy(K);
+    for (int i = 0; i < 5; i++) {
+        double T = 300 + 222*i;
+        ref->setState_TPX(T, 5e5, "H2:0.5, O2:0.3, H2O:0.2");
+        test->setState_TPX(T, 5e5, "H2:0.5, O2:0.3, H2O:0.2");
+        EXPECT_DOUBLE_EQ(tr->viscosity(), copy->viscosity());
+        EXPECT_DOUBLE_EQ(tr->thermalConductivity(),
+                         copy->thermalConductivity());
+        tr->getMixDiffCoeffs(Dref.data());
+        copy->getMixDiffCoeffs(Dcopy.data());
+        for (size_t k = 0; k < K; k++) {
+            EXPECT_DOUBLE_EQ(Dref[k], Dcopy[k]) << "k = " << k;
+        }
+    }
+}
+
+TEST_F(TransportFromScratch, copyMulti)
+{
+    std::unique_ptr<Transport> tr(newTransportMgr("Multi", ref.get()));
+    std::unique_ptr<Transport> copy(tr->duplMyselfAsTransport());
+    copy->setThermo(*test);
+    EXPECT_EQ(tr->model(), copy->model());
+
+    size_t K = ref->nSpecies();
+    Array2D Dref(K, K), Dcopy(K, K);
+    vector_fp DTref(K), DTcopy(K);
+    for (int i = 0; i < 5; i++) {
+        double T = 300 + 222*i;
+        ref->setState_TPX(T, 5e5, "H2:0.5, O2:0.3, H2O:0.2");
+        test->setState_TPX(T, 5e5, "H2:0.5, O2:0.3, H2O:0.2");
+        EXPECT_DOUBLE_EQ(tr->thermalConductivity(),
+                         copy->thermalConductivity());
+        tr->getMultiDiffCoeffs(K, &Dref(0,0));
+        copy->getMultiDiffCoeffs(K, &Dcopy(0,0));
+        tr->getThermalDiffCoeffs(DTref.data());
+        copy->getThermalDiffCoeffs(DTcopy.data());
+        for (size_t k = 0; k < K; k++) {
+            EXPECT_DOUBLE_EQ(DTref[k], DTcopy[k]) << "k = " << k;
+            for (size_t j = 0; j < K; j++) {
+                EXPECT_DOUBLE_EQ(Dref(k,j), Dcopy(k,j)) << "k = " << k << ", j = " << j;
+            }
+        }
+    }
+}
+
+TEST_F(TransportFromScratch, tabulatedMix)
+{
+    std::unique_ptr<Transport> trRef(newTransportMgr("Mix", ref.get()));
+    MixTransport trTest;
+    trTest.init(ref.get());
+    EXPECT_FALSE(trTest.tabulated());
+    trTest.setTabulation(true, 1e-8);
+    EXPECT_TRUE(trTest.tabulated());
+    EXPECT_GT(trTest.nTabulationPoints(), 4u);
+
+    size_t K = ref->nSpecies();
+    vector_fp Dref(K), Dtest(K), vref(K), vtest(K);
+    Array2D bdiffRef(K, K), bdiffTest(K, K);
+    for (int i = 0; i < 20; i++) {
+        double T = 250 + 167.3*i;
+        ref->setState_TPX(T, 5e5, "H2:0.5, O2:0.3, H2O:0.2");
+        EXPECT_NEAR(trRef->viscosity(), trTest.viscosity(),
+                    1e-7 * trRef->viscosity()) << "T = " << T;
+        EXPECT_NEAR(trRef->thermalConductivity(), trTest.thermalConductivity(),
+                    1e-7 * trRef->thermalConductivity()) << "T = " << T;
+        trRef->getSpeciesViscosities(vref.data());
+        trTest.getSpeciesViscosities(vtest.data());
+        trRef->getMixDiffCoeffs(Dref.data());
+        trTest.getMixDiffCoeffs(Dtest.data());
+        trRef->getBinaryDiffCoeffs(K, &bdiffRef(0,0));
+        trTest.getBinaryDiffCoeffs(K, &bdiffTest(0,0));
+        for (size_t k = 0; k < K; k++) {
+            EXPECT_NEAR(vref[k], vtest[k], 2e-8 * vref[k]) << "T = " << T;
+            EXPECT_NEAR(Dref[k], Dtest[k], 1e-7 * Dref[k]) << "T = " << T;
+            for (size_t j = 0; j < K; j++) {
+                EXPECT_NEAR(bdiffRef(k,j), bdiffTest(k,j),
+                            1e-8 * bdiffRef(k,j)) << "T = " << T;
+            }
+        }
+    }
+
+    // Outside the tabulated range, the polynomial fits are used
+    double T = 1.1 * ref->maxTemp();
+    ref->setState_TPX(T, 5e5, "H2:0.5, O2:0.3, H2O:0.2");
+    EXPECT_DOUBLE_EQ(trRef->viscosity(), trTest.viscosity());
+
+    trTest.setTabulation(false);
+    EXPECT_FALSE(trTest.tabulated());
+    EXPECT_EQ(trTest.nTabulationPoints(), 0u);
+    ref->setState_TPX(900, 5e5, "H2:0.5, O2:0.3, H2O:0.2");
+    EXPECT_DOUBLE_EQ(trRef->viscosity(), trTest.viscosity());
+}
+
+TEST_F(TransportFromScratch, tabulatedMulti)
+{
+    MultiTransport trRef, trTest;
+    trRef.init(ref.get(), CK_Mode);
+    trTest.init(ref.get(), CK_Mode);
+    trTest.setTabulation(true, 1e-8);
+
+    size_t K = ref->nSpecies();
+    Array2D Dref(K, K), Dtest(K, K);
+    for (int i = 0; i < 10; i++) {
+        double T = 300 + 321*i;
+        ref->setState_TPX(T, 5e5, "H2:0.5, O2:0.3, H2O:0.2");
+        EXPECT_NEAR(trRef.thermalConductivity(), trTest.thermalConductivity(),
+                    1e-7 * trRef.thermalConductivity()) << "T = " << T;
+        trRef.getMultiDiffCoeffs(K, &Dref(0,0));
+        trTest.getMultiDiffCoeffs(K, &Dtest(0,0));
+        for (size_t k = 0; k < K; k++) {
+            for (size_t j = 0; j < K; j++) {
+                EXPECT_NEAR(Dref(k,j), Dtest(k,j), 1e-7 * std::abs(Dref(k,j)))
+                    << "T = " << T << ", k = " << k << ", j = " << j;
+            }
+        }
+    }
+}
+
+TEST_F(TransportFromScratch, batchMix)
+{
+    for (int mode : {0, CK_Mode}) {
+        MixTransport tr;
+        tr.init(ref.get(), mode);
+        size_t K = ref->nSpecies();
+        size_t n = 150; // more than one block of states
+        vector_fp T(n), P(n), X(n*K), visc(n), cond(n), D(n*K), Dref(K);
+        for (size_t i = 0; i < n; i++) {
+            T[i] = 300 + 17.1*i;
+            P[i] = 1e5 + 3e3*i;
+            for (size_t k = 0; k < K; k++) {
+                // unnormalized, with some species absent
+                X[i*K + k] = ((i + k) % 4 == 0) ? 0.0 : 1.0 + (i*(k+3)) % 7;
+            }
+        }
+        tr.getBatchViscosity(n, T.data(), X.data(), visc.data());
+        tr.getBatchThermalConductivity(n, T.data(), X.data(), cond.data());
+        tr.getBatchMixDiffCoeffs(n, T.data(), P.data(), X.data(), D.data());
+        for (size_t i = 0; i < n; i++) {
+            ref->setState_TPX(T[i], P[i], &X[i*K]);
+            EXPECT_NEAR(tr.viscosity(), visc[i], 1e-12 * visc[i]);
+            EXPECT_NEAR(tr.thermalConductivity(), cond[i], 1e-12 * cond[i]);
+            tr.getMixDiffCoeffs(Dref.data());
+            for (size_t k = 0; k < K; k++) {
+                EXPECT_NEAR(Dref[k], D[i*K + k], 1e-12 * Dref[k]);
+            }
+        }
+    }
+}
+
+TEST_F(TransportFromScratch, batchMixTabulated)
+{
+    // With a loose tolerance, the tabulated properties differ from the fits
+    // by much more than round-off, so the batched methods must use the table
+    // for the states where the single-state methods do
+    for (int mode : {0, CK_Mode}) {
+        MixTransport tr, trFits;
+        tr.init(ref.get(), mode);
+        trFits.init(ref.get(), mode);
+        tr.setTabulation(true, 1e-4);
+        size_t K = ref->nSpecies();
+        size_t n = 150; // includes temperatures above the tabulated range
+        vector_fp T(n), P(n), X(n*K), visc(n), cond(n), D(n*K), Dref(K);
+        for (size_t i = 0; i < n; i++) {
+            T[i] = 300 + 25.3*i;
+            P[i] = 1e5 + 3e3*i;
+            for (size_t k = 0; k < K; k++) {
+                X[i*K + k] = 1.0 + (i*(k+3)) % 7;
+            }
+        }
+        ASSERT_GT(T[n-1], ref->maxTemp());
+        tr.getBatchViscosity(n, T.data(), X.data(), visc.data());
+        tr.getBatchThermalConductivity(n, T.data(), X.data(), cond.data());
+        tr.getBatchMixDiffCoeffs(n, T.data(), P.data(), X.data(), D.data());
+        double maxTableError = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            ref->setState_TPX(T[i], P[i], &X[i*K]);
+            EXPECT_NEAR(tr.viscosity(), visc[i], 1e-12 * visc[i]);
+            EXPECT_NEAR(tr.thermalConductivity(), cond[i], 1e-12 * cond[i]);
+            tr.getMixDiffCoeffs(Dref.data());
+            for (size_t k = 0; k < K; k++) {
+                EXPECT_NEAR(Dref[k], D[i*K + k], 1e-12 * Dref[k]);
+            }
+            maxTableError = std::max(maxTableError,
+                std::abs(trFits.viscosity() / visc[i] - 1.0));
+        }
+        EXPECT_GT(maxTableError, 1e-9);
+    }
+}
+
+TEST_F(TransportFromScratch, multiLMatrixReuse)
+{
+    MultiTransport trRef, trTest;
+    trRef.init(ref.get());
+    trTest.init(ref.get());
+    trTest.setLMatrixReuse(true, 1e-10);
+
+    size_t K = ref->nSpecies();
+    vector_fp DTref(K), DTtest(K), X(K);
+    for (int i = 0; i < 20; i++) {
+        double T = 400 + 1.0*i;
+        X[0] = 0.5 - 0.002*i;
+        X[1] = 0.3;
+        X[2] = 0.2 + 0.002*i;
+        ref->setState_TPX(T, 5e5, X.data());
+        EXPECT_NEAR(trRef.thermalConductivity(), trTest.thermalConductivity(),
+                    1e-9 * trRef.thermalConductivity()) << "T = " << T;
+        trRef.getThermalDiffCoeffs(DTref.data());
+        trTest.getThermalDiffCoeffs(DTtest.data());
+        for (size_t k = 0; k < K; k++) {
+            EXPECT_NEAR(DTref[k], DTtest[k], 1e-9 * std::abs(DTref[k]))
+                << "T = " << T << ", k = " << k;
+        }
+    }
+    EXPECT_EQ(trRef.nLMatrixFactorizations(), 20);
+    EXPECT_EQ(trTest.nLMatrixSolves(), 20);
+    EXPECT_LT(trTest.nLMatrixFactorizations(), 10);
+}
+
+void compareFits(const GasTransportFits& f1, const GasTransportFits& f2)
+{
+    EXPECT_EQ(f1.mode, f2.mode);
+    EXPECT_EQ(f1.visccoeffs, f2.visccoeffs);
+    EXPECT_EQ(f1.condcoeffs, f2.condcoeffs);
+    EXPECT_EQ(f1.diffcoeffs, f2.diffcoeffs);
+    EXPECT_EQ(f1.poly, f2.poly);
+    EXPECT_EQ(f1.omega22, f2.omega22);
+    EXPECT_EQ(f1.astar, f2.astar);
+    EXPECT_EQ(f1.bstar, f2.bstar);
+    EXPECT_EQ(f1.cstar, f2.cstar);
+}
+
+TEST_F(TransportFromScratch, parallelFits)
+{
+    for (int mode : {0, CK_Mode}) {
+        MixTransport trSerial, trParallel;
+        trSerial.init(ref.get(), mode);
+        GasTransport::setFitThreads(3);
+        trParallel.init(ref.get(), mode);
+        GasTransport::setFitThreads(1);
+        GasTransportFits f1, f2;
+        trSerial.getFits(f1);
+        trParallel.getFits(f2);
+        compareFits(f1, f2);
+    }
+}
+
+TEST_F(TransportFromScratch, fitCache)
+{
+    MixTransport trRef;
+    trRef.init(ref.get());
+    EXPECT_EQ(trRef.fitCacheFile(), "");
+    GasTransportFits fRef;
+    trRef.getFits(fRef);
+
+    GasTransport::setFitCache(".");
+    MixTransport tr1, tr2, tr3;
+    MultiTransport tr4;
+    tr1.init(ref.get()); // writes the cache file
+    std::string filename = tr1.fitCacheFile();
+    ASSERT_NE(filename, "");
+    tr2.init(ref.get()); // reads the cache file
+    tr4.init(ref.get()); // same fitting mode as MixTransport
+    EXPECT_EQ(tr2.fitCacheFile(), filename);
+    EXPECT_EQ(tr4.fitCacheFile(), filename);
+    {
+        // An invalid cache file is ignored and replaced
+        std::ofstream out(filename, std::ios::binary);
+        out << "not a cache file";
+    }
+    tr3.init(ref.get());
+    EXPECT_EQ(tr3.fitCacheFile(), filename);
+
+    // A different fitting mode or species property uses a different file
+    MixTransport tr5, tr6;
+    tr5.init(ref.get(), CK_Mode);
+    EXPECT_NE(tr5.fitCacheFile(), filename);
+    std::remove(tr5.fitCacheFile().c_str());
+    tH2O->diameter *= 1.01;
+    tr6.init(test.get());
+    EXPECT_NE(tr6.fitCacheFile(), filename);
+    std::remove(tr6.fitCacheFile().c_str());
+    GasTransport::setFitCache("");
+
+    for (GasTransport* tr : std::vector<GasTransport*>{&tr1, &tr2, &tr3, &tr4}) {
+        GasTransportFits f;
+        tr->getFits(f);
+        compareFits(fRef, f);
+    }
+    ref->setState_TPX(600, 2e5, "H2:0.1, O2:0.6, H2O:0.3");
+    EXPECT_DOUBLE_EQ(trRef.viscosity(), tr2.viscosity());
+    EXPECT_DOUBLE_EQ(trRef.thermalConductivity(), tr2.thermalConductivity());
+    std::remove(filename.c_str());
+}
+
+TEST_F(TransportFromScratch, invalidFits)
+{
+    MixTransport trRef;
+    trRef.init(ref.get());
+    GasTransportFits fits;
+    trRef.getFits(fits);
+
+    MixTransport tr1;
+    tr1.setFits(fits);
+    tr1.init(ref.get());
+
+    // Fits with a missing coefficient are rejected
+    GasTransportFits f2 = fits;
+    f2.condcoeffs.back().pop_back();
+    MixTransport tr2;
+    tr2.setFits(f2);
+    EXPECT_THROW(tr2.init(ref.get()), CanteraError);
+
+    GasTransportFits f3 = fits;
+    f3.bstar[0].pop_back();
+    MixTransport tr3;
+    tr3.setFits(f3);
+    EXPECT_THROW(tr3.init(ref.get()), CanteraError);
+
+    // Fits from a different fitting mode are rejected
+    MixTransport tr4;
+    tr4.setFits(fits);
+    EXPECT_THROW(tr4.init(ref.get(), CK_Mode), CanteraError);
+}
+
 int main(int argc, char** argv)
 {
     printf("Running main() from transportFromScratch.cpp\n");
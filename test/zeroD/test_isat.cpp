@@ -0,0 +1,208 @@
+#include "gtest/gtest.h"
+#include "cantera/zerodim.h"
+#include "cantera/kinetics/importKinetics.h"
+#include "cantera/kinetics/GasKinetics.h"
+#include "cantera/thermo/IdealGasPhase.h"
+
+namespace Cantera
+{
+
+//! ISAT table using an analytic, mass conserving mapping instead of the
+//! reactor integration, so that the errors of the table can be checked
+//! exactly.
+class TestISAT : public ReactorISAT
+{
+public:
+    TestISAT(ThermoPhase& thermo, Kinetics& kin) : ReactorISAT(thermo, kin) {
+        a = thermo.speciesIndex("H2") + 1;
+        b = thermo.speciesIndex("H2O") + 1;
+    }
+
+    using ReactorISAT::recordSize;
+
+    void mapping(const double* z0, double* z) {
+        std::copy(z0, z0 + m_nv, z);
+        z[0] += 0.2 * z0[a] * z0[b] + 0.05 * z0[0] * z0[0];
+        z[a] -= 0.1 * z0[a] * z0[a];
+        z[b] += 0.1 * z0[a] * z0[a];
+    }
+
+    virtual void integrate(const double* z0, double* z) {
+        mapping(z0, z);
+    }
+
+    // Scaled error of the tabulated mapping of the state (T, P, Y)
+    double error(double T, double P, const double* Y) {
+        size_t n = m_nv;
+        vector_fp z0(n), z(n);
+        z0[0] = T / 1000.0;
+        std::copy(Y, Y + n - 1, z0.begin() + 1);
+        mapping(z0.data(), z.data());
+        m_thermo.setState_TPY(T, P, Y);
+        advance();
+        double err = std::pow(m_thermo.temperature() / 1000.0 - z[0], 2);
+        for (size_t k = 0; k < n - 1; k++) {
+            err += std::pow(m_thermo.massFraction(k) - z[k+1], 2);
+        }
+        return std::sqrt(err);
+    }
+
+    size_t a, b;
+};
+
+class ReactorISATTest : public testing::Test
+{
+public:
+    ReactorISATTest() : gas("h2o2.xml", "ohmech") {
+        std::vector<ThermoPhase*> phases { &gas };
+        importKinetics(gas.xml(), phases, &kin);
+        gas.setState_TPX(1200, OneAtm, "H2:2, O2:1, H2O:0.5, AR:4");
+        Y0.resize(gas.nSpecies());
+        gas.getMassFractions(Y0.data());
+    }
+
+    // Perturb the mass fractions of H2 and H2O of the reference state
+    void perturbed(double dY1, double dY2, vector_fp& Y) {
+        Y = Y0;
+        Y[gas.speciesIndex("H2")] += dY1;
+        Y[gas.speciesIndex("H2O")] += dY2;
+        Y[gas.speciesIndex("AR")] -= dY1 + dY2;
+    }
+
+    IdealGasPhase gas;
+    GasKinetics kin;
+    vector_fp Y0;
+};
+
+TEST_F(ReactorISATTest, retrieve_and_add)
+{
+    TestISAT isat(gas, kin);
+    isat.setTimeStep(1e-5);
+    isat.setTolerance(1e-4);
+    EXPECT_NEAR(isat.error(1200, OneAtm, Y0.data()), 0.0, 1e-14);
+    EXPECT_EQ(isat.nAdded(), (size_t) 1);
+    EXPECT_EQ(isat.nRecords(), (size_t) 1);
+
+    EXPECT_NEAR(isat.error(1200.01, OneAtm, Y0.data()), 0.0, 1e-4);
+    EXPECT_EQ(isat.nRetrieved(), (size_t) 1);
+
+    // Far from the existing record
+    EXPECT_NEAR(isat.error(1500, OneAtm, Y0.data()), 0.0, 1e-14);
+    EXPECT_EQ(isat.nAdded(), (size_t) 2);
+    EXPECT_EQ(isat.nDirect(), (size_t) 2);
+    EXPECT_EQ(isat.nRecords(), (size_t) 2);
+}
+
+TEST_F(ReactorISATTest, accuracy)
+{
+    TestISAT isat(gas, kin);
+    isat.setTimeStep(1e-5);
+    double tol = 1e-4;
+    isat.setTolerance(tol);
+    vector_fp Y;
+    for (int i = 0; i < 400; i++) {
+        double T = 1200 + 25.0 * ((i * 7) % 20) / 20;
+        perturbed(0.01 * ((i * 3) % 11) / 11, 0.01 * ((i * 5) % 13) / 13, Y);
+        EXPECT_LT(isat.error(T, OneAtm, Y.data()), tol) << i;
+    }
+    EXPECT_GT(isat.nRetrieved(), (size_t) 0);
+    EXPECT_GT(isat.nGrown(), (size_t) 0);
+    EXPECT_EQ(isat.nAdded(), isat.nRecords());
+    EXPECT_EQ(isat.nRetrieved() + isat.nDirect(), (size_t) 400);
+}
+
+TEST_F(ReactorISATTest, memory_limit)
+{
+    TestISAT isat(gas, kin);
+    isat.setTimeStep(1e-5);
+    isat.setMemoryLimit(3 * isat.recordSize());
+    for (int i = 0; i < 10; i++) {
+        isat.error(1000 + 100 * i, OneAtm, Y0.data());
+        EXPECT_EQ(isat.nRecords(), (size_t) std::min(i + 1, 3));
+    }
+    EXPECT_EQ(isat.nAdded(), (size_t) 10);
+    EXPECT_EQ(isat.nEvicted(), (size_t) 7);
+    EXPECT_LE(isat.memoryUsage(), 3 * isat.recordSize());
+
+    // The most recently used records are kept
+    isat.error(1800, OneAtm, Y0.data());
+    EXPECT_EQ(isat.nRetrieved(), (size_t) 1);
+    isat.error(1700, OneAtm, Y0.data());
+    EXPECT_EQ(isat.nRetrieved(), (size_t) 2);
+
+    // Adding a record removes the least recently used one (T = 1900)
+    isat.error(1000, OneAtm, Y0.data());
+    EXPECT_EQ(isat.nAdded(), (size_t) 11);
+    isat.error(1900, OneAtm, Y0.data());
+    EXPECT_EQ(isat.nAdded(), (size_t) 12);
+    isat.error(1000, OneAtm, Y0.data());
+    EXPECT_EQ(isat.nRetrieved(), (size_t) 3);
+}
+
+TEST_F(ReactorISATTest, h2o2_reactor)
+{
+    // Tabulation of the integration by the ReactorNet, compared with a
+    // separate reactor network advanced directly from each state
+    double dt = 1e-6;
+    double tol = 1e-4;
+    gas.setState_TPX(1400, OneAtm, "H2:2, O2:1, H2O:0.5, AR:4, H:0.01, "
+                     "O:0.005, OH:0.01");
+    gas.getMassFractions(Y0.data());
+    ReactorISAT isat(gas, kin);
+    isat.setTimeStep(dt);
+    isat.setTolerance(tol);
+    isat.setIntegratorTolerances(1e-10, 1e-16);
+
+    IdealGasPhase gas2("h2o2.xml", "ohmech");
+    GasKinetics kin2;
+    std::vector<ThermoPhase*> phases { &gas2 };
+    importKinetics(gas2.xml(), phases, &kin2);
+    size_t kk = gas.nSpecies();
+
+    vector_fp Y, Y1(kk), Y2(kk);
+    for (int i = 0; i < 60; i++) {
+        double T = 1400 + 2.0 * ((i * 7) % 10) / 10;
+        double P = (i < 40) ? OneAtm : 1.5 * OneAtm;
+        perturbed(0.002 * ((i * 3) % 11) / 11, 0.002 * ((i * 5) % 13) / 13, Y);
+        gas.setState_TPY(T, P, Y.data());
+        isat.advance();
+        gas.getMassFractions(Y1.data());
+
+        gas2.setState_TPY(T, P, Y.data());
+        IdealGasConstPressureReactor r;
+        r.setThermoMgr(gas2);
+        r.setKineticsMgr(kin2);
+        ReactorNet net;
+        net.addReactor(r);
+        net.setTolerances(1e-10, 1e-16);
+        net.advance(dt);
+        gas2.getMassFractions(Y2.data());
+
+        double err = std::pow((gas.temperature() - gas2.temperature()) / 1000,
+                              2);
+        for (size_t k = 0; k < kk; k++) {
+            err += std::pow(Y1[k] - Y2[k], 2);
+        }
+        EXPECT_LT(std::sqrt(err), tol) << i;
+        EXPECT_NEAR(gas.pressure(), P, 1e-8 * P) << i;
+    }
+    // The pressure change clears the table, so some records are added again
+    EXPECT_GT(isat.nRetrieved(), (size_t) 0);
+    EXPECT_GT(isat.nGrown(), (size_t) 0);
+    EXPECT_GT(isat.nAdded(), (size_t) 1);
+    EXPECT_LT(isat.nRecords(), isat.nAdded());
+}
+
+TEST_F(ReactorISATTest, clear_on_pressure_change)
+{
+    TestISAT isat(gas, kin);
+    isat.setTimeStep(1e-5);
+    isat.error(1200, OneAtm, Y0.data());
+    isat.error(1200, 2 * OneAtm, Y0.data());
+    EXPECT_EQ(isat.nAdded(), (size_t) 2);
+    EXPECT_EQ(isat.nRecords(), (size_t) 1);
+    isat.setTimeStep(2e-5);
+    EXPECT_EQ(isat.nRecords(), (size_t) 0);
+}
+
+}
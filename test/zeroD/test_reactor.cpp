@@ -0,0 +1,204 @@
+#include "gtest/gtest.h"
+#include "cantera/zerodim.h"
+#include "cantera/IdealGasMix.h"
+
+namespace Cantera
+{
+
+class TestReactor : public Reactor
+{
+public:
+    using Reactor::updateState;
+
+    //! Use the general method for finding the temperature
+    void useGeneralTemperature() {
+        m_nasaThermo = 0;
+    }
+};
+
+TEST(Reactor, updateStateIdealGas)
+{
+    IdealGasMix gas("h2o2.xml", "ohmech");
+    gas.setState_TPX(1200, OneAtm, "H2:2, O2:1, OH:0.01, AR:4");
+    TestReactor r, rgen;
+    r.insert(gas);
+    r.initialize();
+    rgen.insert(gas);
+    rgen.initialize();
+    rgen.useGeneralTemperature();
+    vector_fp y(r.neq()), y2(r.neq());
+    r.getState(y.data());
+
+    // Change the internal energy and the composition, and compare with the
+    // temperature found using the ThermoPhase object
+    for (int i = 0; i < 10; i++) {
+        y2 = y;
+        y2[2] *= (i % 2) ? 1.0 + 0.1 * i : 1.0 - 0.1 * i;
+        y2[3] *= 1.0 + 0.05 * i;
+        y2[4] *= 1.0 - 0.05 * i;
+        r.updateState(y2.data());
+        double T = r.temperature();
+        EXPECT_NEAR(gas.intEnergy_mass() * y2[0], y2[2],
+                    1e-12 * std::abs(y2[2]));
+        EXPECT_DOUBLE_EQ(gas.density(), y2[0] / y2[1]);
+        rgen.updateState(y2.data());
+        EXPECT_NEAR(rgen.temperature(), T, 1e-12 * T);
+    }
+}
+
+TEST(Reactor, updateStateModifiedThermo)
+{
+    IdealGasMix gas("h2o2.xml", "ohmech");
+    gas.setState_TPX(1500, OneAtm, "H2:2, O2:1, OH:0.1, H2O:0.5, AR:4");
+    TestReactor r, rgen;
+    r.insert(gas);
+    r.initialize();
+    rgen.insert(gas);
+    rgen.initialize();
+    rgen.useGeneralTemperature();
+    vector_fp y(r.neq());
+    r.getState(y.data());
+
+    // Changes to the species thermo after initialize() are used
+    size_t k = gas.speciesIndex("OH");
+    gas.modifyOneHf298SS(k, gas.Hf298SS(k) + 2e7);
+    r.updateState(y.data());
+    double T = r.temperature();
+    EXPECT_NEAR(gas.intEnergy_mass() * y[0], y[2], 1e-12 * std::abs(y[2]));
+    rgen.updateState(y.data());
+    EXPECT_NEAR(rgen.temperature(), T, 1e-12 * T);
+    EXPECT_GT(std::abs(T - 1500), 1.0);
+}
+
+
+class TestReactorNet : public ReactorNet
+{
+public:
+    using ReactorNet::initialize;
+};
+
+class ReactorJacobianTest : public testing::Test
+{
+public:
+    ReactorJacobianTest()
+        : gas("h2o2.xml", "ohmech")
+        , gas2("h2o2.xml", "ohmech")
+    {
+        gas.setState_TPX(1200, OneAtm,
+            "H2:2, O2:1, H:0.01, O:0.005, OH:0.02, HO2:1e-3, H2O2:1e-4, "
+            "H2O:0.3, AR:4");
+        gas2.setState_TPX(300, OneAtm, "H2:1, O2:1, AR:2");
+    }
+
+    // Compare the Jacobian computed by the network with a central difference
+    // approximation of the full right hand side. The errors in each row are
+    // scaled by the largest change in the row due to a change of each
+    // component by its own magnitude.
+    void checkJacobian(ReactorNet& net, double rtol) {
+        size_t n = net.neq();
+        vector_fp y(n), ydot(n), jac(n*n), fp(n), fm(n);
+        net.getState(y.data());
+        net.eval(0.0, y.data(), ydot.data(), nullptr);
+        net.evalJacobian(0.0, y.data(), ydot.data(), nullptr, jac.data());
+
+        vector_fp fd(n*n), scale(n);
+        for (size_t j = 0; j < n; j++) {
+            scale[j] = std::max(std::abs(y[j]), 1e-6);
+            double ysave = y[j];
+            double h = 1e-6 * scale[j];
+            y[j] = ysave + h;
+            net.eval(0.0, y.data(), fp.data(), nullptr);
+            y[j] = ysave - h;
+            net.eval(0.0, y.data(), fm.data(), nullptr);
+            y[j] = ysave;
+            for (size_t i = 0; i < n; i++) {
+                fd[i + n*j] = (fp[i] - fm[i]) / (2 * h);
+            }
+        }
+        for (size_t i = 0; i < n; i++) {
+            double rowMax = 0.0;
+            for (size_t j = 0; j < n; j++) {
+                rowMax = std::max(rowMax, std::abs(fd[i + n*j]) * scale[j]);
+            }
+            for (size_t j = 0; j < n; j++) {
+                EXPECT_NEAR(jac[i + n*j] * scale[j], fd[i + n*j] * scale[j],
+                            rtol * rowMax + 1e-14) << "i = " << i << ", j = " << j;
+            }
+        }
+
+        // The reaction terms are restored after evaluating the Jacobian
+        net.eval(0.0, y.data(), fp.data(), nullptr);
+        for (size_t i = 0; i < n; i++) {
+            EXPECT_NEAR(ydot[i], fp[i], 1e-12 * std::abs(ydot[i]) + 1e-14);
+        }
+    }
+
+    IdealGasMix gas, gas2;
+};
+
+TEST_F(ReactorJacobianTest, IdealGasReactor)
+{
+    IdealGasReactor r;
+    r.insert(gas);
+    TestReactorNet net;
+    net.addReactor(r);
+    net.setLinearSolverType("DENSE_ANALYTIC");
+    net.initialize();
+    checkJacobian(net, 1e-5);
+}
+
+TEST_F(ReactorJacobianTest, IdealGasReactorNoEnergy)
+{
+    IdealGasReactor r;
+    r.insert(gas);
+    r.setEnergy(0);
+    TestReactorNet net;
+    net.addReactor(r);
+    net.setLinearSolverType("DENSE_ANALYTIC");
+    net.initialize();
+    checkJacobian(net, 1e-5);
+}
+
+TEST_F(ReactorJacobianTest, IdealGasConstPressureReactor)
+{
+    IdealGasConstPressureReactor r;
+    r.insert(gas);
+    TestReactorNet net;
+    net.addReactor(r);
+    net.setLinearSolverType("DENSE_ANALYTIC");
+    net.initialize();
+    checkJacobian(net, 1e-5);
+}
+
+TEST_F(ReactorJacobianTest, WallsAndInlets)
+{
+    // The terms due to the walls and flow devices are computed by finite
+    // differences, and are combined with the analytic reaction terms
+    IdealGasReactor r1;
+    r1.insert(gas);
+    IdealGasConstPressureReactor r2;
+    r2.insert(gas);
+    Reservoir res;
+    res.insert(gas2);
+    Wall w;
+    w.install(r1, r2);
+    w.setHeatTransferCoeff(200.0);
+    w.setExpansionRateCoeff(1e-4);
+    MassFlowController mfc;
+    mfc.install(res, r2);
+    mfc.setMassFlowRate(0.05);
+    TestReactorNet net;
+    net.addReactor(r1);
+    net.addReactor(r2);
+    net.setLinearSolverType("DENSE_ANALYTIC");
+    net.initialize();
+    checkJacobian(net, 1e-5);
+}
+
+TEST(ReactorNet, badLinearSolverType)
+{
+    ReactorNet net;
+    EXPECT_THROW(net.setLinearSolverType("SPARSE"), CanteraError);
+}
+
+}
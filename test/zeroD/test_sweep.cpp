@@ -0,0 +1,112 @@
+#include "gtest/gtest.h"
+#include "cantera/zerodim.h"
+#include "cantera/kinetics/importKinetics.h"
+#include "cantera/kinetics/GasKinetics.h"
+#include "cantera/thermo/IdealGasPhase.h"
+
+namespace Cantera
+{
+
+class ReactorSweepTest : public testing::Test
+{
+public:
+    ReactorSweepTest() : gas("h2o2.xml", "ohmech") {
+        std::vector<ThermoPhase*> phases { &gas };
+        importKinetics(gas.xml(), phases, &kin);
+    }
+
+    void addCases(ReactorSweep& sweep) {
+        for (size_t i = 0; i < 12; i++) {
+            gas.setState_TPX(1000 + 25 * i, OneAtm * (1 + i % 3),
+                             "H2:2, O2:1, AR:4");
+            sweep.addCase(gas.temperature(), gas.pressure(),
+                          gas.massFractions(), 1e-4);
+        }
+    }
+
+    IdealGasPhase gas;
+    GasKinetics kin;
+};
+
+TEST_F(ReactorSweepTest, matches_serial)
+{
+    ReactorSweep sweep(gas, kin);
+    sweep.setNumThreads(4);
+    addCases(sweep);
+    sweep.run();
+    ASSERT_EQ(sweep.nCases(), (size_t) 12);
+
+    size_t kk = gas.nSpecies();
+    vector_fp Y(kk);
+    for (size_t i = 0; i < sweep.nCases(); i++) {
+        // Set the state the same way as ReactorSweep, so that the results
+        // are not affected by round-off in the composition conversion
+        gas.setState_TPX(1000 + 25 * i, OneAtm * (1 + i % 3),
+                         "H2:2, O2:1, AR:4");
+        gas.getMassFractions(Y.data());
+        gas.setState_TPY(gas.temperature(), gas.pressure(), Y.data());
+        IdealGasReactor r;
+        r.setThermoMgr(gas);
+        r.setKineticsMgr(kin);
+        ReactorNet net;
+        net.addReactor(r);
+        net.advance(1e-4);
+        EXPECT_DOUBLE_EQ(gas.temperature(), sweep.temperature(i));
+        EXPECT_DOUBLE_EQ(gas.pressure(), sweep.pressure(i));
+        sweep.getMassFractions(i, Y.data());
+        for (size_t k = 0; k < kk; k++) {
+            EXPECT_DOUBLE_EQ(gas.massFraction(k), Y[k]);
+        }
+    }
+    // Later cases are hotter and should have reacted further
+    EXPECT_GT(sweep.temperature(11) - 1275, sweep.temperature(0) - 1000);
+}
+
+TEST_F(ReactorSweepTest, independent_of_thread_count)
+{
+    ReactorSweep serial(gas, kin);
+    serial.setNumThreads(1);
+    addCases(serial);
+    serial.run();
+
+    ReactorSweep parallel(gas, kin);
+    parallel.setNumThreads(5);
+    addCases(parallel);
+    parallel.setReactorType("IdealGasConstPressureReactor");
+    parallel.run();
+    // Rerun with the same settings as the serial case, reusing the copies
+    // of the phase and kinetics objects
+    parallel.setReactorType("IdealGasReactor");
+    parallel.run();
+
+    size_t kk = gas.nSpecies();
+    vector_fp Y1(kk), Y2(kk);
+    for (size_t i = 0; i < serial.nCases(); i++) {
+        EXPECT_EQ(serial.temperature(i), parallel.temperature(i));
+        serial.getMassFractions(i, Y1.data());
+        parallel.getMassFractions(i, Y2.data());
+        for (size_t k = 0; k < kk; k++) {
+            EXPECT_EQ(Y1[k], Y2[k]);
+        }
+    }
+}
+
+TEST_F(ReactorSweepTest, bad_reactor_type)
+{
+    ReactorSweep sweep(gas, kin);
+    addCases(sweep);
+    sweep.setReactorType("Reservoir");
+    EXPECT_THROW(sweep.run(), CanteraError);
+    EXPECT_THROW(sweep.temperature(20), IndexError);
+}
+
+} // namespace Cantera
+
+int main(int argc, char** argv)
+{
+    printf("Running main() from test_sweep.cpp\n");
+    testing::InitGoogleTest(&argc, argv);
+    int result = RUN_ALL_TESTS();
+    Cantera::appdelete();
+    return result;
+}